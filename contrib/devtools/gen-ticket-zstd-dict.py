@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 The Pastel Core developers
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or https://www.opensource.org/licenses/mit-license.php.
+'''
+Generate zstd dictionary header for the v2 ticket compressor (src/compress-dict/ticket-dict-v<ID>.h).
+
+Modes:
+  template - build raw-content dictionary from the Pastel ticket json skeletons
+             (field names and their base64 encodings), no chain data required
+  train    - train dictionary with `zstd --train` on the tickets dumped from a running
+             pasteld node (chain snapshot) using `pastel-cli tickets list <type> all`
+
+Dictionary is a part of the consensus data format once tickets compressed with it are in the blockchain:
+NEVER regenerate an existing dictionary version - always use a new dictionary id and
+register the new header in src/datacompressor.cpp.
+
+Examples:
+  gen-ticket-zstd-dict.py template --id 1
+  gen-ticket-zstd-dict.py train --id 2 --cli "pastel-cli -datadir=/snapshot" --max-size 32768
+'''
+import argparse
+import base64
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+SRC_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..', 'src'))
+# ticket types with large json payloads compressed in P2FMS transactions
+TICKET_TYPES = ['nft', 'act', 'action', 'action-act', 'id', 'sell', 'buy', 'trade', 'royalty', 'username', 'ethereumaddress']
+# ticket json fields containing base64-encoded payloads
+PAYLOAD_FIELDS = ['nft_ticket', 'action_ticket']
+
+NFT_TICKET_SKELETON = [
+    '{"nft_ticket_version":1,"author":"', '","blocknum":', ',"block_hash":"', '","copies":', ',"royalty":',
+    ',"green":false,"app_ticket":"', ',"green":true,"app_ticket":"', '"}',
+]
+ACTION_TICKET_SKELETON = [
+    '{"action_ticket_version":1,"caller":"', '","blocknum":', ',"block_hash":"', '","action_type":"sense","api_ticket":"',
+    '","action_type":"cascade","api_ticket":"', '"}',
+]
+APP_TICKET_SKELETON = [
+    '{"creator_name":"', '","creator_website":"', '","creator_written_statement":"', '","nft_title":"', '","nft_type":"image",',
+    '"nft_series_name":"', '","nft_keyword_set":"', '","total_copies":', ',"youtube_url":"', '","preview_hash":"',
+    '","thumbnail1_hash":"', '","thumbnail2_hash":"', '","data_hash":"', '","original_file_size_in_bytes":', ',"file_type":"image/png",',
+    '"make_publicly_accessible":true,', '"dd_and_fingerprints_ic":', ',"dd_and_fingerprints_max":', ',"dd_and_fingerprints_ids":["',
+    '"],"rq_ic":', ',"rq_max":', ',"rq_oti":"', '","rq_ids":["', '"]}',
+    '{"data_hash":"', '","file_name":"', '","dd_and_fingerprints_ic":', ',"dd_and_fingerprints_max":',
+]
+SIGNATURES_SKELETON = [
+    '{"principal":{"', '"},"mn1":{"', '"},"mn2":{"', '"},"mn3":{"', '":"', '"}}',
+]
+
+
+def base64_variants(text):
+    '''Base64 encodings of the text at all 3 byte alignments.'''
+    data = text.encode('utf-8')
+    variants = []
+    for nPrefix in range(3):
+        encoded = base64.b64encode(b'\0' * nPrefix + data).decode('ascii')
+        # skip chars affected by the prefix padding and trailing padding
+        nSkip = (nPrefix * 4 + 2) // 3
+        variants.append(encoded[nSkip:].rstrip('=')[:-2] if len(encoded) > nSkip + 2 else '')
+    return [v for v in variants if v]
+
+
+def build_template_dict():
+    '''Raw-content dictionary: most frequent content should be at the end of the dictionary.'''
+    parts = []
+    for skeleton in (APP_TICKET_SKELETON, SIGNATURES_SKELETON):
+        parts.extend(skeleton)
+    # payloads are stored base64-encoded, app ticket is base64-encoded inside the payload
+    for skeleton in (APP_TICKET_SKELETON, ACTION_TICKET_SKELETON, NFT_TICKET_SKELETON):
+        for fragment in skeleton:
+            parts.extend(base64_variants(fragment))
+        parts.extend(base64_variants(''.join(skeleton)))
+    return ''.join(parts).encode('ascii')
+
+
+def dump_ticket_samples(cli, samples_dir):
+    '''Dump payloads of all tickets registered in the blockchain, one sample file per ticket.'''
+    nSamples = 0
+    for ticket_type in TICKET_TYPES:
+        try:
+            output = subprocess.check_output(cli.split() + ['tickets', 'list', ticket_type, 'all'])
+        except subprocess.CalledProcessError as e:
+            print('Failed to list "%s" tickets: %s' % (ticket_type, e), file=sys.stderr)
+            continue
+        tickets = json.loads(output) if output.strip() else []
+        for ticket in tickets or []:
+            body = ticket.get('ticket', {})
+            sample = ''.join(body.get(field, '') for field in PAYLOAD_FIELDS)
+            if 'signatures' in body:
+                sample += json.dumps(body['signatures'], separators=(',', ':'))
+            if not sample:
+                sample = json.dumps(body, separators=(',', ':'))
+            with open(os.path.join(samples_dir, '%s-%d' % (ticket_type, nSamples)), 'w') as f:
+                f.write(sample)
+            nSamples += 1
+    return nSamples
+
+
+def train_dict(cli, dict_id, max_size):
+    zstd = shutil.which('zstd')
+    if not zstd:
+        sys.exit('zstd command-line tool is required to train dictionary')
+    with tempfile.TemporaryDirectory() as tmpdir:
+        samples_dir = os.path.join(tmpdir, 'samples')
+        os.makedirs(samples_dir)
+        nSamples = dump_ticket_samples(cli, samples_dir)
+        if nSamples < 10:
+            sys.exit('Not enough ticket samples to train dictionary: %d' % nSamples)
+        print('Training dictionary on %d ticket samples' % nSamples)
+        dict_file = os.path.join(tmpdir, 'ticket.dict')
+        subprocess.check_call([zstd, '--train', '-r', samples_dir, '-o', dict_file,
+                               '--maxdict=%d' % max_size, '--dictID=%d' % dict_id, '-q'])
+        with open(dict_file, 'rb') as f:
+            return f.read()
+
+
+def write_header(dict_id, dict_data, source):
+    out_dir = os.path.join(SRC_DIR, 'compress-dict')
+    os.makedirs(out_dir, exist_ok=True)
+    out_file = os.path.join(out_dir, 'ticket-dict-v%d.h' % dict_id)
+    if os.path.exists(out_file):
+        sys.exit('%s already exists - dictionaries used in the blockchain can not be changed, use new dictionary id' % out_file)
+    lines = []
+    for i in range(0, len(dict_data), 16):
+        lines.append('    ' + ' '.join('0x%02x,' % b for b in dict_data[i:i + 16]))
+    with open(out_file, 'w') as f:
+        f.write('#pragma once\n')
+        f.write('// Copyright (c) 2022 The Pastel Core developers\n')
+        f.write('// Distributed under the MIT/X11 software license, see the accompanying\n')
+        f.write('// file COPYING or https://www.opensource.org/licenses/mit-license.php.\n')
+        f.write('// Generated by contrib/devtools/gen-ticket-zstd-dict.py (%s) - DO NOT EDIT.\n' % source)
+        f.write('#include <cstdint>\n\n')
+        f.write('// zstd dictionary v%d for the ticket compressor, %d bytes\n' % (dict_id, len(dict_data)))
+        f.write('constexpr uint32_t TICKET_ZSTD_DICT_V%d_ID = %d;\n' % (dict_id, dict_id))
+        f.write('static const unsigned char TICKET_ZSTD_DICT_V%d[] = {\n' % dict_id)
+        f.write('\n'.join(lines))
+        f.write('\n};\n')
+    print('Dictionary v%d [%d bytes] saved to %s' % (dict_id, len(dict_data), out_file))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('mode', choices=['template', 'train'])
+    parser.add_argument('--id', type=int, required=True, help='dictionary id (>0)')
+    parser.add_argument('--cli', default='pastel-cli', help='pastel-cli command line used to dump tickets (train mode)')
+    parser.add_argument('--max-size', type=int, default=16384, help='max dictionary size in bytes (train mode)')
+    args = parser.parse_args()
+    if args.id <= 0:
+        sys.exit('dictionary id should be positive')
+    if args.mode == 'template':
+        write_header(args.id, build_template_dict(), 'template')
+    else:
+        write_header(args.id, train_dict(args.cli, args.id, args.max_size), 'trained')
+
+
+if __name__ == '__main__':
+    main()
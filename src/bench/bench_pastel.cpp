@@ -0,0 +1,143 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <univalue.h>
+
+#include <chainparams.h>
+#include <crypto/common.h>
+#include <key.h>
+#include <legroast.h>
+#include <util.h>
+#include <zcbenchmarks.h>
+
+using namespace std;
+
+static constexpr int DEFAULT_BENCH_ITERATIONS = 20;
+static constexpr int DEFAULT_BENCH_PAYLOAD_SIZE_KB = 256;
+
+typedef struct _bench_t
+{
+    string sName;                 // benchmark name
+    function<double()> fnRun;     // runs one iteration and returns its time in seconds
+} bench_t;
+
+/**
+ * Get percentile value from the sorted sample times (nearest-rank method).
+ *
+ * \param vSorted - sorted sample times
+ * \param nPercentile - percentile [0..100]
+ * \return percentile value
+ */
+static double GetPercentile(const vector<double>& vSorted, const size_t nPercentile)
+{
+    if (vSorted.empty())
+        return 0;
+    size_t nRank = static_cast<size_t>(ceil(nPercentile / 100.0 * vSorted.size()));
+    if (nRank > 0)
+        --nRank;
+    return vSorted[min(nRank, vSorted.size() - 1)];
+}
+
+static void RunBenchmark(const bench_t& bench, const int nIterations)
+{
+    vector<double> vTimes;
+    vTimes.reserve(nIterations);
+    try
+    {
+        for (int i = 0; i < nIterations; ++i)
+            vTimes.push_back(bench.fnRun());
+    } catch (const UniValue& objError) {
+        printf("%-32s failed: %s\n", bench.sName.c_str(), find_value(objError, "message").get_str().c_str());
+        return;
+    } catch (const exception& e) {
+        printf("%-32s failed: %s\n", bench.sName.c_str(), e.what());
+        return;
+    }
+    double fTotal = 0;
+    for (const auto t : vTimes)
+        fTotal += t;
+    sort(vTimes.begin(), vTimes.end());
+    // all times are printed in milliseconds
+    printf("%-32s %8d %12.2f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+        bench.sName.c_str(), nIterations,
+        fTotal > 0 ? vTimes.size() / fTotal : 0.0,
+        vTimes.front() * 1000,
+        GetPercentile(vTimes, 50) * 1000,
+        GetPercentile(vTimes, 90) * 1000,
+        GetPercentile(vTimes, 99) * 1000,
+        vTimes.back() * 1000);
+}
+
+static vector<bench_t> GetBenchmarks(const size_t nPayloadSize)
+{
+    vector<bench_t> v = {
+        { "ed448.sign", benchmark_ed448_sign },
+        { "ed448.verify", benchmark_ed448_verify },
+    };
+    for (const auto alg : { legroast::algorithm::Legendre_Fast, legroast::algorithm::Legendre_Middle, legroast::algorithm::Legendre_Compact,
+                            legroast::algorithm::Power_Fast, legroast::algorithm::Power_Middle, legroast::algorithm::Power_Compact })
+    {
+        const string sPrefix = string("legroast.") + legroast::GetLegRoastAlgorithmName(alg);
+        v.push_back({ sPrefix + ".keygen", [alg]() { return benchmark_legroast_keygen(alg); } });
+        v.push_back({ sPrefix + ".sign", [alg]() { return benchmark_legroast_sign(alg); } });
+        v.push_back({ sPrefix + ".verify", [alg]() { return benchmark_legroast_verify(alg); } });
+    }
+    v.push_back({ "securecontainer.load", benchmark_secure_container_load });
+    v.push_back({ "p2fms.create", [nPayloadSize]() { return benchmark_p2fms_create(nPayloadSize); } });
+    v.push_back({ "p2fms.parse", [nPayloadSize]() { return benchmark_p2fms_parse(nPayloadSize); } });
+    v.push_back({ "ticket.compress", [nPayloadSize]() { return benchmark_ticket_compress(nPayloadSize, 0); } });
+    v.push_back({ "ticket.decompress", [nPayloadSize]() { return benchmark_ticket_decompress(nPayloadSize, 0); } });
+    return v;
+}
+
+int main(int argc, char* argv[])
+{
+    ParseParameters(argc, argv);
+    if (mapArgs.count("-?") || mapArgs.count("-h") || mapArgs.count("-help"))
+    {
+        printf("Usage: bench_pastel [options]\n\n"
+               "Options:\n"
+               "  -filter=<str>       Run only benchmarks with names containing <str>\n"
+               "  -iterations=<n>     Number of iterations for each benchmark (default: %d)\n"
+               "  -payloadsize=<n>    Ticket payload size in KB (default: %d)\n"
+               "\n"
+               "Ticket validation requires a chain and is available via \"zcbenchmark ticketvalidate\" RPC.\n",
+            DEFAULT_BENCH_ITERATIONS, DEFAULT_BENCH_PAYLOAD_SIZE_KB);
+        return 0;
+    }
+    const string sFilter = GetArg("-filter", "");
+    const int nIterations = static_cast<int>(GetArg("-iterations", DEFAULT_BENCH_ITERATIONS));
+    const int64_t nPayloadSizeKB = GetArg("-payloadsize", DEFAULT_BENCH_PAYLOAD_SIZE_KB);
+    if (nIterations <= 0 || nPayloadSizeKB <= 0)
+    {
+        fprintf(stderr, "Error: invalid number of iterations or payload size\n");
+        return 1;
+    }
+
+    SetupEnvironment();
+    if (init_and_check_sodium() == -1)
+    {
+        fprintf(stderr, "Error: failed to initialize libsodium\n");
+        return 1;
+    }
+    ECC_Start();
+    SelectParams(CBaseChainParams::Network::MAIN);
+
+    printf("%-32s %8s %12s %10s %10s %10s %10s %10s\n",
+        "benchmark", "iters", "ops/sec", "min,ms", "p50,ms", "p90,ms", "p99,ms", "max,ms");
+    for (const auto& bench : GetBenchmarks(static_cast<size_t>(nPayloadSizeKB) * 1024))
+    {
+        if (!sFilter.empty() && bench.sName.find(sFilter) == string::npos)
+            continue;
+        RunBenchmark(bench, nIterations);
+    }
+    ECC_Stop();
+    return 0;
+}
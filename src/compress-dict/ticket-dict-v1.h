@@ -0,0 +1,454 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+// Generated by contrib/devtools/gen-ticket-zstd-dict.py (template) - DO NOT EDIT.
+#include <cstdint>
+
+// zstd dictionary v1 for the ticket compressor, 7074 bytes
+constexpr uint32_t TICKET_ZSTD_DICT_V1_ID = 1;
+static const unsigned char TICKET_ZSTD_DICT_V1[] = {
+    0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a,
+    0x22, 0x22, 0x2c, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x77, 0x65, 0x62, 0x73,
+    0x69, 0x74, 0x65, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+    0x5f, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x6e, 0x66, 0x74, 0x5f, 0x74, 0x69, 0x74, 0x6c,
+    0x65, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x6e, 0x66, 0x74, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22,
+    0x3a, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x22, 0x2c, 0x22, 0x6e, 0x66, 0x74, 0x5f, 0x73, 0x65,
+    0x72, 0x69, 0x65, 0x73, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x6e,
+    0x66, 0x74, 0x5f, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x73, 0x65, 0x74, 0x22, 0x3a,
+    0x22, 0x22, 0x2c, 0x22, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73,
+    0x22, 0x3a, 0x2c, 0x22, 0x79, 0x6f, 0x75, 0x74, 0x75, 0x62, 0x65, 0x5f, 0x75, 0x72, 0x6c, 0x22,
+    0x3a, 0x22, 0x22, 0x2c, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x68, 0x61, 0x73,
+    0x68, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x6e, 0x61, 0x69, 0x6c,
+    0x31, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x74, 0x68, 0x75, 0x6d,
+    0x62, 0x6e, 0x61, 0x69, 0x6c, 0x32, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x22, 0x3a, 0x22, 0x22, 0x2c,
+    0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x68, 0x61, 0x73, 0x68, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22,
+    0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x73, 0x69,
+    0x7a, 0x65, 0x5f, 0x69, 0x6e, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x22, 0x3a, 0x2c, 0x22, 0x66,
+    0x69, 0x6c, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65,
+    0x2f, 0x70, 0x6e, 0x67, 0x22, 0x2c, 0x22, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x70, 0x75, 0x62, 0x6c,
+    0x69, 0x63, 0x6c, 0x79, 0x5f, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x22,
+    0x3a, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x22, 0x64, 0x64, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x66, 0x69,
+    0x6e, 0x67, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x73, 0x5f, 0x69, 0x63, 0x22, 0x3a, 0x2c,
+    0x22, 0x64, 0x64, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x70, 0x72,
+    0x69, 0x6e, 0x74, 0x73, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x3a, 0x2c, 0x22, 0x64, 0x64, 0x5f, 0x61,
+    0x6e, 0x64, 0x5f, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x73, 0x5f,
+    0x69, 0x64, 0x73, 0x22, 0x3a, 0x5b, 0x22, 0x22, 0x5d, 0x2c, 0x22, 0x72, 0x71, 0x5f, 0x69, 0x63,
+    0x22, 0x3a, 0x2c, 0x22, 0x72, 0x71, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x3a, 0x2c, 0x22, 0x72, 0x71,
+    0x5f, 0x6f, 0x74, 0x69, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x72, 0x71, 0x5f, 0x69, 0x64, 0x73,
+    0x22, 0x3a, 0x5b, 0x22, 0x22, 0x5d, 0x7d, 0x7b, 0x22, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x68, 0x61,
+    0x73, 0x68, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x6e, 0x61, 0x6d,
+    0x65, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x64, 0x64, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x66, 0x69,
+    0x6e, 0x67, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x73, 0x5f, 0x69, 0x63, 0x22, 0x3a, 0x2c,
+    0x22, 0x64, 0x64, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x70, 0x72,
+    0x69, 0x6e, 0x74, 0x73, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x3a, 0x7b, 0x22, 0x70, 0x72, 0x69, 0x6e,
+    0x63, 0x69, 0x70, 0x61, 0x6c, 0x22, 0x3a, 0x7b, 0x22, 0x22, 0x7d, 0x2c, 0x22, 0x6d, 0x6e, 0x31,
+    0x22, 0x3a, 0x7b, 0x22, 0x22, 0x7d, 0x2c, 0x22, 0x6d, 0x6e, 0x32, 0x22, 0x3a, 0x7b, 0x22, 0x22,
+    0x7d, 0x2c, 0x22, 0x6d, 0x6e, 0x33, 0x22, 0x3a, 0x7b, 0x22, 0x22, 0x3a, 0x22, 0x22, 0x7d, 0x7d,
+    0x65, 0x79, 0x4a, 0x6a, 0x63, 0x6d, 0x56, 0x68, 0x64, 0x47, 0x39, 0x79, 0x58, 0x32, 0x35, 0x68,
+    0x62, 0x57, 0x55, 0x69, 0x4f, 0x73, 0x69, 0x59, 0x33, 0x4a, 0x6c, 0x59, 0x58, 0x52, 0x76, 0x63,
+    0x6c, 0x39, 0x75, 0x59, 0x57, 0x31, 0x6c, 0x49, 0x6a, 0x37, 0x49, 0x6d, 0x4e, 0x79, 0x5a, 0x57,
+    0x46, 0x30, 0x62, 0x33, 0x4a, 0x66, 0x62, 0x6d, 0x46, 0x74, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x69,
+    0x77, 0x69, 0x59, 0x33, 0x4a, 0x6c, 0x59, 0x58, 0x52, 0x76, 0x63, 0x6c, 0x39, 0x33, 0x5a, 0x57,
+    0x4a, 0x7a, 0x61, 0x58, 0x52, 0x6c, 0x49, 0x6a, 0x49, 0x73, 0x49, 0x6d, 0x4e, 0x79, 0x5a, 0x57,
+    0x46, 0x30, 0x62, 0x33, 0x4a, 0x66, 0x64, 0x32, 0x56, 0x69, 0x63, 0x32, 0x6c, 0x30, 0x5a, 0x53,
+    0x49, 0x36, 0x69, 0x4c, 0x43, 0x4a, 0x6a, 0x63, 0x6d, 0x56, 0x68, 0x64, 0x47, 0x39, 0x79, 0x58,
+    0x33, 0x64, 0x6c, 0x59, 0x6e, 0x4e, 0x70, 0x64, 0x47, 0x55, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69,
+    0x59, 0x33, 0x4a, 0x6c, 0x59, 0x58, 0x52, 0x76, 0x63, 0x6c, 0x39, 0x33, 0x63, 0x6d, 0x6c, 0x30,
+    0x64, 0x47, 0x56, 0x75, 0x58, 0x33, 0x4e, 0x30, 0x59, 0x58, 0x52, 0x6c, 0x62, 0x57, 0x56, 0x75,
+    0x64, 0x43, 0x49, 0x36, 0x49, 0x73, 0x49, 0x6d, 0x4e, 0x79, 0x5a, 0x57, 0x46, 0x30, 0x62, 0x33,
+    0x4a, 0x66, 0x64, 0x33, 0x4a, 0x70, 0x64, 0x48, 0x52, 0x6c, 0x62, 0x6c, 0x39, 0x7a, 0x64, 0x47,
+    0x46, 0x30, 0x5a, 0x57, 0x31, 0x6c, 0x62, 0x6e, 0x51, 0x69, 0x4f, 0x69, 0x4c, 0x43, 0x4a, 0x6a,
+    0x63, 0x6d, 0x56, 0x68, 0x64, 0x47, 0x39, 0x79, 0x58, 0x33, 0x64, 0x79, 0x61, 0x58, 0x52, 0x30,
+    0x5a, 0x57, 0x35, 0x66, 0x63, 0x33, 0x52, 0x68, 0x64, 0x47, 0x56, 0x74, 0x5a, 0x57, 0x35, 0x30,
+    0x49, 0x6a, 0x49, 0x69, 0x77, 0x69, 0x62, 0x6d, 0x5a, 0x30, 0x58, 0x33, 0x52, 0x70, 0x64, 0x47,
+    0x78, 0x6c, 0x49, 0x6a, 0x49, 0x73, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x30, 0x61, 0x58,
+    0x52, 0x73, 0x5a, 0x53, 0x49, 0x36, 0x69, 0x4c, 0x43, 0x4a, 0x75, 0x5a, 0x6e, 0x52, 0x66, 0x64,
+    0x47, 0x6c, 0x30, 0x62, 0x47, 0x55, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x62, 0x6d, 0x5a, 0x30,
+    0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69, 0x4f, 0x69, 0x4a, 0x70, 0x62, 0x57, 0x46, 0x6e,
+    0x5a, 0x53, 0x49, 0x73, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c,
+    0x49, 0x6a, 0x6f, 0x69, 0x61, 0x57, 0x31, 0x68, 0x5a, 0x32, 0x55, 0x69, 0x69, 0x4c, 0x43, 0x4a,
+    0x75, 0x5a, 0x6e, 0x52, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x6d, 0x6c,
+    0x74, 0x59, 0x57, 0x64, 0x6c, 0x49, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x7a, 0x5a, 0x58,
+    0x4a, 0x70, 0x5a, 0x58, 0x4e, 0x66, 0x62, 0x6d, 0x46, 0x74, 0x5a, 0x53, 0x49, 0x36, 0x4a, 0x75,
+    0x5a, 0x6e, 0x52, 0x66, 0x63, 0x32, 0x56, 0x79, 0x61, 0x57, 0x56, 0x7a, 0x58, 0x32, 0x35, 0x68,
+    0x62, 0x57, 0x55, 0x69, 0x4f, 0x69, 0x62, 0x6d, 0x5a, 0x30, 0x58, 0x33, 0x4e, 0x6c, 0x63, 0x6d,
+    0x6c, 0x6c, 0x63, 0x31, 0x39, 0x75, 0x59, 0x57, 0x31, 0x6c, 0x49, 0x6a, 0x49, 0x69, 0x77, 0x69,
+    0x62, 0x6d, 0x5a, 0x30, 0x58, 0x32, 0x74, 0x6c, 0x65, 0x58, 0x64, 0x76, 0x63, 0x6d, 0x52, 0x66,
+    0x63, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x49, 0x73, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x72,
+    0x5a, 0x58, 0x6c, 0x33, 0x62, 0x33, 0x4a, 0x6b, 0x58, 0x33, 0x4e, 0x6c, 0x64, 0x43, 0x49, 0x36,
+    0x69, 0x4c, 0x43, 0x4a, 0x75, 0x5a, 0x6e, 0x52, 0x66, 0x61, 0x32, 0x56, 0x35, 0x64, 0x32, 0x39,
+    0x79, 0x5a, 0x46, 0x39, 0x7a, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x64, 0x47,
+    0x39, 0x30, 0x59, 0x57, 0x78, 0x66, 0x59, 0x32, 0x39, 0x77, 0x61, 0x57, 0x56, 0x7a, 0x49, 0x49,
+    0x73, 0x49, 0x6e, 0x52, 0x76, 0x64, 0x47, 0x46, 0x73, 0x58, 0x32, 0x4e, 0x76, 0x63, 0x47, 0x6c,
+    0x6c, 0x63, 0x79, 0x69, 0x4c, 0x43, 0x4a, 0x30, 0x62, 0x33, 0x52, 0x68, 0x62, 0x46, 0x39, 0x6a,
+    0x62, 0x33, 0x42, 0x70, 0x5a, 0x58, 0x4d, 0x69, 0x4c, 0x43, 0x4a, 0x35, 0x62, 0x33, 0x56, 0x30,
+    0x64, 0x57, 0x4a, 0x6c, 0x58, 0x33, 0x56, 0x79, 0x62, 0x43, 0x49, 0x36, 0x77, 0x69, 0x65, 0x57,
+    0x39, 0x31, 0x64, 0x48, 0x56, 0x69, 0x5a, 0x56, 0x39, 0x31, 0x63, 0x6d, 0x77, 0x69, 0x4f, 0x73,
+    0x49, 0x6e, 0x6c, 0x76, 0x64, 0x58, 0x52, 0x31, 0x59, 0x6d, 0x56, 0x66, 0x64, 0x58, 0x4a, 0x73,
+    0x49, 0x6a, 0x49, 0x69, 0x77, 0x69, 0x63, 0x48, 0x4a, 0x6c, 0x64, 0x6d, 0x6c, 0x6c, 0x64, 0x31,
+    0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x49, 0x73, 0x49, 0x6e, 0x42, 0x79, 0x5a, 0x58,
+    0x5a, 0x70, 0x5a, 0x58, 0x64, 0x66, 0x61, 0x47, 0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x69, 0x4c,
+    0x43, 0x4a, 0x77, 0x63, 0x6d, 0x56, 0x32, 0x61, 0x57, 0x56, 0x33, 0x58, 0x32, 0x68, 0x68, 0x63,
+    0x32, 0x67, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x64, 0x47, 0x68, 0x31, 0x62, 0x57, 0x4a, 0x75,
+    0x59, 0x57, 0x6c, 0x73, 0x4d, 0x56, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x49, 0x73,
+    0x49, 0x6e, 0x52, 0x6f, 0x64, 0x57, 0x31, 0x69, 0x62, 0x6d, 0x46, 0x70, 0x62, 0x44, 0x46, 0x66,
+    0x61, 0x47, 0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x69, 0x4c, 0x43, 0x4a, 0x30, 0x61, 0x48, 0x56,
+    0x74, 0x59, 0x6d, 0x35, 0x68, 0x61, 0x57, 0x77, 0x78, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67,
+    0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x64, 0x47, 0x68, 0x31, 0x62, 0x57, 0x4a, 0x75, 0x59, 0x57,
+    0x6c, 0x73, 0x4d, 0x6c, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x49, 0x73, 0x49, 0x6e,
+    0x52, 0x6f, 0x64, 0x57, 0x31, 0x69, 0x62, 0x6d, 0x46, 0x70, 0x62, 0x44, 0x4a, 0x66, 0x61, 0x47,
+    0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x69, 0x4c, 0x43, 0x4a, 0x30, 0x61, 0x48, 0x56, 0x74, 0x59,
+    0x6d, 0x35, 0x68, 0x61, 0x57, 0x77, 0x79, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f,
+    0x49, 0x69, 0x77, 0x69, 0x5a, 0x47, 0x46, 0x30, 0x59, 0x56, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f,
+    0x49, 0x6a, 0x49, 0x73, 0x49, 0x6d, 0x52, 0x68, 0x64, 0x47, 0x46, 0x66, 0x61, 0x47, 0x46, 0x7a,
+    0x61, 0x43, 0x49, 0x36, 0x69, 0x4c, 0x43, 0x4a, 0x6b, 0x59, 0x58, 0x52, 0x68, 0x58, 0x32, 0x68,
+    0x68, 0x63, 0x32, 0x67, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x62, 0x33, 0x4a, 0x70, 0x5a, 0x32,
+    0x6c, 0x75, 0x59, 0x57, 0x78, 0x66, 0x5a, 0x6d, 0x6c, 0x73, 0x5a, 0x56, 0x39, 0x7a, 0x61, 0x58,
+    0x70, 0x6c, 0x58, 0x32, 0x6c, 0x75, 0x58, 0x32, 0x4a, 0x35, 0x64, 0x47, 0x56, 0x7a, 0x49, 0x49,
+    0x73, 0x49, 0x6d, 0x39, 0x79, 0x61, 0x57, 0x64, 0x70, 0x62, 0x6d, 0x46, 0x73, 0x58, 0x32, 0x5a,
+    0x70, 0x62, 0x47, 0x56, 0x66, 0x63, 0x32, 0x6c, 0x36, 0x5a, 0x56, 0x39, 0x70, 0x62, 0x6c, 0x39,
+    0x69, 0x65, 0x58, 0x52, 0x6c, 0x63, 0x79, 0x69, 0x4c, 0x43, 0x4a, 0x76, 0x63, 0x6d, 0x6c, 0x6e,
+    0x61, 0x57, 0x35, 0x68, 0x62, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x78, 0x6c, 0x58, 0x33, 0x4e, 0x70,
+    0x65, 0x6d, 0x56, 0x66, 0x61, 0x57, 0x35, 0x66, 0x59, 0x6e, 0x6c, 0x30, 0x5a, 0x58, 0x4d, 0x69,
+    0x4c, 0x43, 0x4a, 0x6d, 0x61, 0x57, 0x78, 0x6c, 0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69,
+    0x4f, 0x69, 0x4a, 0x70, 0x62, 0x57, 0x46, 0x6e, 0x5a, 0x53, 0x39, 0x77, 0x62, 0x6d, 0x63, 0x69,
+    0x77, 0x69, 0x5a, 0x6d, 0x6c, 0x73, 0x5a, 0x56, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49, 0x6a,
+    0x6f, 0x69, 0x61, 0x57, 0x31, 0x68, 0x5a, 0x32, 0x55, 0x76, 0x63, 0x47, 0x35, 0x6e, 0x49, 0x73,
+    0x49, 0x6d, 0x5a, 0x70, 0x62, 0x47, 0x56, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53, 0x49, 0x36,
+    0x49, 0x6d, 0x6c, 0x74, 0x59, 0x57, 0x64, 0x6c, 0x4c, 0x33, 0x42, 0x75, 0x5a, 0x79, 0x49, 0x6d,
+    0x31, 0x68, 0x61, 0x32, 0x56, 0x66, 0x63, 0x48, 0x56, 0x69, 0x62, 0x47, 0x6c, 0x6a, 0x62, 0x48,
+    0x6c, 0x66, 0x59, 0x57, 0x4e, 0x6a, 0x5a, 0x58, 0x4e, 0x7a, 0x61, 0x57, 0x4a, 0x73, 0x5a, 0x53,
+    0x49, 0x36, 0x64, 0x48, 0x4a, 0x31, 0x5a, 0x4a, 0x74, 0x59, 0x57, 0x74, 0x6c, 0x58, 0x33, 0x42,
+    0x31, 0x59, 0x6d, 0x78, 0x70, 0x59, 0x32, 0x78, 0x35, 0x58, 0x32, 0x46, 0x6a, 0x59, 0x32, 0x56,
+    0x7a, 0x63, 0x32, 0x6c, 0x69, 0x62, 0x47, 0x55, 0x69, 0x4f, 0x6e, 0x52, 0x79, 0x64, 0x57, 0x69,
+    0x62, 0x57, 0x46, 0x72, 0x5a, 0x56, 0x39, 0x77, 0x64, 0x57, 0x4a, 0x73, 0x61, 0x57, 0x4e, 0x73,
+    0x65, 0x56, 0x39, 0x68, 0x59, 0x32, 0x4e, 0x6c, 0x63, 0x33, 0x4e, 0x70, 0x59, 0x6d, 0x78, 0x6c,
+    0x49, 0x6a, 0x70, 0x30, 0x63, 0x6e, 0x56, 0x6c, 0x49, 0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75,
+    0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75,
+    0x64, 0x48, 0x4e, 0x66, 0x61, 0x57, 0x4d, 0x69, 0x4a, 0x6b, 0x5a, 0x46, 0x39, 0x68, 0x62, 0x6d,
+    0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79, 0x63, 0x48, 0x4a, 0x70, 0x62, 0x6e,
+    0x52, 0x7a, 0x58, 0x32, 0x6c, 0x6a, 0x49, 0x69, 0x5a, 0x47, 0x52, 0x66, 0x59, 0x57, 0x35, 0x6b,
+    0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79, 0x61, 0x57, 0x35, 0x30,
+    0x63, 0x31, 0x39, 0x70, 0x59, 0x79, 0x4c, 0x43, 0x4a, 0x6b, 0x5a, 0x46, 0x39, 0x68, 0x62, 0x6d,
+    0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79, 0x63, 0x48, 0x4a, 0x70, 0x62, 0x6e,
+    0x52, 0x7a, 0x58, 0x32, 0x31, 0x68, 0x65, 0x43, 0x77, 0x69, 0x5a, 0x47, 0x52, 0x66, 0x59, 0x57,
+    0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79, 0x61, 0x57,
+    0x35, 0x30, 0x63, 0x31, 0x39, 0x74, 0x59, 0x58, 0x67, 0x69, 0x73, 0x49, 0x6d, 0x52, 0x6b, 0x58,
+    0x32, 0x46, 0x75, 0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58, 0x4a, 0x77, 0x63,
+    0x6d, 0x6c, 0x75, 0x64, 0x48, 0x4e, 0x66, 0x62, 0x57, 0x46, 0x34, 0x49, 0x4c, 0x43, 0x4a, 0x6b,
+    0x5a, 0x46, 0x39, 0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79,
+    0x63, 0x48, 0x4a, 0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x6c, 0x6b, 0x63, 0x79, 0x49, 0x36,
+    0x57, 0x77, 0x69, 0x5a, 0x47, 0x52, 0x66, 0x59, 0x57, 0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62,
+    0x6d, 0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79, 0x61, 0x57, 0x35, 0x30, 0x63, 0x31, 0x39, 0x70, 0x5a,
+    0x48, 0x4d, 0x69, 0x4f, 0x6c, 0x73, 0x49, 0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75, 0x5a, 0x46,
+    0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75, 0x64, 0x48,
+    0x4e, 0x66, 0x61, 0x57, 0x52, 0x7a, 0x49, 0x6a, 0x70, 0x62, 0x49, 0x6c, 0x30, 0x73, 0x49, 0x6e,
+    0x4a, 0x78, 0x58, 0x32, 0x6c, 0x6a, 0x49, 0x4a, 0x64, 0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39,
+    0x70, 0x59, 0x79, 0x69, 0x58, 0x53, 0x77, 0x69, 0x63, 0x6e, 0x46, 0x66, 0x61, 0x57, 0x4d, 0x69,
+    0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x74, 0x59, 0x58, 0x67, 0x69, 0x77, 0x69, 0x63, 0x6e,
+    0x46, 0x66, 0x62, 0x57, 0x46, 0x34, 0x49, 0x73, 0x49, 0x6e, 0x4a, 0x78, 0x58, 0x32, 0x31, 0x68,
+    0x65, 0x43, 0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x76, 0x64, 0x47, 0x6b, 0x69, 0x4f, 0x77,
+    0x69, 0x63, 0x6e, 0x46, 0x66, 0x62, 0x33, 0x52, 0x70, 0x49, 0x6a, 0x73, 0x49, 0x6e, 0x4a, 0x78,
+    0x58, 0x32, 0x39, 0x30, 0x61, 0x53, 0x49, 0x36, 0x49, 0x69, 0x77, 0x69, 0x63, 0x6e, 0x46, 0x66,
+    0x61, 0x57, 0x52, 0x7a, 0x49, 0x6a, 0x70, 0x62, 0x49, 0x73, 0x49, 0x6e, 0x4a, 0x78, 0x58, 0x32,
+    0x6c, 0x6b, 0x63, 0x79, 0x49, 0x36, 0x57, 0x69, 0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x70,
+    0x5a, 0x48, 0x4d, 0x69, 0x4f, 0x6c, 0x49, 0x6c, 0x4a, 0x64, 0x69, 0x58, 0x65, 0x79, 0x4a, 0x6b,
+    0x59, 0x58, 0x52, 0x68, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f, 0x73, 0x69, 0x5a,
+    0x47, 0x46, 0x30, 0x59, 0x56, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x37, 0x49, 0x6d,
+    0x52, 0x68, 0x64, 0x47, 0x46, 0x66, 0x61, 0x47, 0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x49, 0x69,
+    0x77, 0x69, 0x5a, 0x6d, 0x6c, 0x73, 0x5a, 0x56, 0x39, 0x75, 0x59, 0x57, 0x31, 0x6c, 0x49, 0x6a,
+    0x49, 0x73, 0x49, 0x6d, 0x5a, 0x70, 0x62, 0x47, 0x56, 0x66, 0x62, 0x6d, 0x46, 0x74, 0x5a, 0x53,
+    0x49, 0x36, 0x69, 0x4c, 0x43, 0x4a, 0x6d, 0x61, 0x57, 0x78, 0x6c, 0x58, 0x32, 0x35, 0x68, 0x62,
+    0x57, 0x55, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x5a, 0x47, 0x52, 0x66, 0x59, 0x57, 0x35, 0x6b,
+    0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79, 0x61, 0x57, 0x35, 0x30,
+    0x63, 0x31, 0x39, 0x70, 0x59, 0x79, 0x49, 0x73, 0x49, 0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75,
+    0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75,
+    0x64, 0x48, 0x4e, 0x66, 0x61, 0x57, 0x4d, 0x69, 0x69, 0x4c, 0x43, 0x4a, 0x6b, 0x5a, 0x46, 0x39,
+    0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79, 0x63, 0x48, 0x4a,
+    0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x6c, 0x6a, 0x49, 0x4c, 0x43, 0x4a, 0x6b, 0x5a, 0x46,
+    0x39, 0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79, 0x63, 0x48,
+    0x4a, 0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x31, 0x68, 0x65, 0x43, 0x77, 0x69, 0x5a, 0x47,
+    0x52, 0x66, 0x59, 0x57, 0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63, 0x6e,
+    0x42, 0x79, 0x61, 0x57, 0x35, 0x30, 0x63, 0x31, 0x39, 0x74, 0x59, 0x58, 0x67, 0x69, 0x73, 0x49,
+    0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75, 0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a,
+    0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75, 0x64, 0x48, 0x4e, 0x66, 0x62, 0x57, 0x46, 0x34, 0x49,
+    0x65, 0x79, 0x4a, 0x6a, 0x63, 0x6d, 0x56, 0x68, 0x64, 0x47, 0x39, 0x79, 0x58, 0x32, 0x35, 0x68,
+    0x62, 0x57, 0x55, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x6a, 0x63, 0x6d, 0x56, 0x68,
+    0x64, 0x47, 0x39, 0x79, 0x58, 0x33, 0x64, 0x6c, 0x59, 0x6e, 0x4e, 0x70, 0x64, 0x47, 0x55, 0x69,
+    0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x6a, 0x63, 0x6d, 0x56, 0x68, 0x64, 0x47, 0x39, 0x79,
+    0x58, 0x33, 0x64, 0x79, 0x61, 0x58, 0x52, 0x30, 0x5a, 0x57, 0x35, 0x66, 0x63, 0x33, 0x52, 0x68,
+    0x64, 0x47, 0x56, 0x74, 0x5a, 0x57, 0x35, 0x30, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69,
+    0x62, 0x6d, 0x5a, 0x30, 0x58, 0x33, 0x52, 0x70, 0x64, 0x47, 0x78, 0x6c, 0x49, 0x6a, 0x6f, 0x69,
+    0x49, 0x69, 0x77, 0x69, 0x62, 0x6d, 0x5a, 0x30, 0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69,
+    0x4f, 0x69, 0x4a, 0x70, 0x62, 0x57, 0x46, 0x6e, 0x5a, 0x53, 0x49, 0x73, 0x49, 0x6d, 0x35, 0x6d,
+    0x64, 0x46, 0x39, 0x7a, 0x5a, 0x58, 0x4a, 0x70, 0x5a, 0x58, 0x4e, 0x66, 0x62, 0x6d, 0x46, 0x74,
+    0x5a, 0x53, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x72,
+    0x5a, 0x58, 0x6c, 0x33, 0x62, 0x33, 0x4a, 0x6b, 0x58, 0x33, 0x4e, 0x6c, 0x64, 0x43, 0x49, 0x36,
+    0x49, 0x69, 0x49, 0x73, 0x49, 0x6e, 0x52, 0x76, 0x64, 0x47, 0x46, 0x73, 0x58, 0x32, 0x4e, 0x76,
+    0x63, 0x47, 0x6c, 0x6c, 0x63, 0x79, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x35, 0x62, 0x33, 0x56, 0x30,
+    0x64, 0x57, 0x4a, 0x6c, 0x58, 0x33, 0x56, 0x79, 0x62, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73,
+    0x49, 0x6e, 0x42, 0x79, 0x5a, 0x58, 0x5a, 0x70, 0x5a, 0x58, 0x64, 0x66, 0x61, 0x47, 0x46, 0x7a,
+    0x61, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6e, 0x52, 0x6f, 0x64, 0x57, 0x31, 0x69,
+    0x62, 0x6d, 0x46, 0x70, 0x62, 0x44, 0x46, 0x66, 0x61, 0x47, 0x46, 0x7a, 0x61, 0x43, 0x49, 0x36,
+    0x49, 0x69, 0x49, 0x73, 0x49, 0x6e, 0x52, 0x6f, 0x64, 0x57, 0x31, 0x69, 0x62, 0x6d, 0x46, 0x70,
+    0x62, 0x44, 0x4a, 0x66, 0x61, 0x47, 0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73,
+    0x49, 0x6d, 0x52, 0x68, 0x64, 0x47, 0x46, 0x66, 0x61, 0x47, 0x46, 0x7a, 0x61, 0x43, 0x49, 0x36,
+    0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x39, 0x79, 0x61, 0x57, 0x64, 0x70, 0x62, 0x6d, 0x46, 0x73,
+    0x58, 0x32, 0x5a, 0x70, 0x62, 0x47, 0x56, 0x66, 0x63, 0x32, 0x6c, 0x36, 0x5a, 0x56, 0x39, 0x70,
+    0x62, 0x6c, 0x39, 0x69, 0x65, 0x58, 0x52, 0x6c, 0x63, 0x79, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x6d,
+    0x61, 0x57, 0x78, 0x6c, 0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69, 0x4f, 0x69, 0x4a, 0x70,
+    0x62, 0x57, 0x46, 0x6e, 0x5a, 0x53, 0x39, 0x77, 0x62, 0x6d, 0x63, 0x69, 0x4c, 0x43, 0x4a, 0x74,
+    0x59, 0x57, 0x74, 0x6c, 0x58, 0x33, 0x42, 0x31, 0x59, 0x6d, 0x78, 0x70, 0x59, 0x32, 0x78, 0x35,
+    0x58, 0x32, 0x46, 0x6a, 0x59, 0x32, 0x56, 0x7a, 0x63, 0x32, 0x6c, 0x69, 0x62, 0x47, 0x55, 0x69,
+    0x4f, 0x6e, 0x52, 0x79, 0x64, 0x57, 0x55, 0x73, 0x49, 0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75,
+    0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75,
+    0x64, 0x48, 0x4e, 0x66, 0x61, 0x57, 0x4d, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x5a, 0x47, 0x52, 0x66,
+    0x59, 0x57, 0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79,
+    0x61, 0x57, 0x35, 0x30, 0x63, 0x31, 0x39, 0x74, 0x59, 0x58, 0x67, 0x69, 0x4f, 0x69, 0x77, 0x69,
+    0x5a, 0x47, 0x52, 0x66, 0x59, 0x57, 0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c,
+    0x63, 0x6e, 0x42, 0x79, 0x61, 0x57, 0x35, 0x30, 0x63, 0x31, 0x39, 0x70, 0x5a, 0x48, 0x4d, 0x69,
+    0x4f, 0x6c, 0x73, 0x69, 0x49, 0x6c, 0x30, 0x73, 0x49, 0x6e, 0x4a, 0x78, 0x58, 0x32, 0x6c, 0x6a,
+    0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6e, 0x4a, 0x78, 0x58, 0x32, 0x31, 0x68, 0x65, 0x43, 0x49, 0x36,
+    0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x76, 0x64, 0x47, 0x6b, 0x69, 0x4f, 0x69, 0x49, 0x69,
+    0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x70, 0x5a, 0x48, 0x4d, 0x69, 0x4f, 0x6c, 0x73, 0x69,
+    0x49, 0x6c, 0x31, 0x39, 0x65, 0x79, 0x4a, 0x6b, 0x59, 0x58, 0x52, 0x68, 0x58, 0x32, 0x68, 0x68,
+    0x63, 0x32, 0x67, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x6d, 0x61, 0x57, 0x78, 0x6c,
+    0x58, 0x32, 0x35, 0x68, 0x62, 0x57, 0x55, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x6b,
+    0x5a, 0x46, 0x39, 0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79,
+    0x63, 0x48, 0x4a, 0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x6c, 0x6a, 0x49, 0x6a, 0x6f, 0x73,
+    0x49, 0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75, 0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e,
+    0x5a, 0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75, 0x64, 0x48, 0x4e, 0x66, 0x62, 0x57, 0x46, 0x34,
+    0x49, 0x73, 0x69, 0x59, 0x33, 0x4a, 0x6c, 0x59, 0x58, 0x52, 0x76, 0x63, 0x6c, 0x39, 0x75, 0x59,
+    0x57, 0x31, 0x6c, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59, 0x33, 0x4a, 0x6c, 0x59,
+    0x58, 0x52, 0x76, 0x63, 0x6c, 0x39, 0x33, 0x5a, 0x57, 0x4a, 0x7a, 0x61, 0x58, 0x52, 0x6c, 0x49,
+    0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59, 0x33, 0x4a, 0x6c, 0x59, 0x58, 0x52, 0x76, 0x63,
+    0x6c, 0x39, 0x33, 0x63, 0x6d, 0x6c, 0x30, 0x64, 0x47, 0x56, 0x75, 0x58, 0x33, 0x4e, 0x30, 0x59,
+    0x58, 0x52, 0x6c, 0x62, 0x57, 0x56, 0x75, 0x64, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49,
+    0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x30, 0x61, 0x58, 0x52, 0x73, 0x5a, 0x53, 0x49, 0x36, 0x49,
+    0x69, 0x49, 0x73, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49,
+    0x6a, 0x6f, 0x69, 0x61, 0x57, 0x31, 0x68, 0x5a, 0x32, 0x55, 0x69, 0x4c, 0x43, 0x4a, 0x75, 0x5a,
+    0x6e, 0x52, 0x66, 0x63, 0x32, 0x56, 0x79, 0x61, 0x57, 0x56, 0x7a, 0x58, 0x32, 0x35, 0x68, 0x62,
+    0x57, 0x55, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x75, 0x5a, 0x6e, 0x52, 0x66, 0x61,
+    0x32, 0x56, 0x35, 0x64, 0x32, 0x39, 0x79, 0x5a, 0x46, 0x39, 0x7a, 0x5a, 0x58, 0x51, 0x69, 0x4f,
+    0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x30, 0x62, 0x33, 0x52, 0x68, 0x62, 0x46, 0x39, 0x6a, 0x62,
+    0x33, 0x42, 0x70, 0x5a, 0x58, 0x4d, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x65, 0x57, 0x39, 0x31, 0x64,
+    0x48, 0x56, 0x69, 0x5a, 0x56, 0x39, 0x31, 0x63, 0x6d, 0x77, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c,
+    0x43, 0x4a, 0x77, 0x63, 0x6d, 0x56, 0x32, 0x61, 0x57, 0x56, 0x33, 0x58, 0x32, 0x68, 0x68, 0x63,
+    0x32, 0x67, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x30, 0x61, 0x48, 0x56, 0x74, 0x59,
+    0x6d, 0x35, 0x68, 0x61, 0x57, 0x77, 0x78, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f,
+    0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x30, 0x61, 0x48, 0x56, 0x74, 0x59, 0x6d, 0x35, 0x68, 0x61,
+    0x57, 0x77, 0x79, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c,
+    0x43, 0x4a, 0x6b, 0x59, 0x58, 0x52, 0x68, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f,
+    0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x76, 0x63, 0x6d, 0x6c, 0x6e, 0x61, 0x57, 0x35, 0x68, 0x62,
+    0x46, 0x39, 0x6d, 0x61, 0x57, 0x78, 0x6c, 0x58, 0x33, 0x4e, 0x70, 0x65, 0x6d, 0x56, 0x66, 0x61,
+    0x57, 0x35, 0x66, 0x59, 0x6e, 0x6c, 0x30, 0x5a, 0x58, 0x4d, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x5a,
+    0x6d, 0x6c, 0x73, 0x5a, 0x56, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49, 0x6a, 0x6f, 0x69, 0x61,
+    0x57, 0x31, 0x68, 0x5a, 0x32, 0x55, 0x76, 0x63, 0x47, 0x35, 0x6e, 0x49, 0x69, 0x77, 0x69, 0x62,
+    0x57, 0x46, 0x72, 0x5a, 0x56, 0x39, 0x77, 0x64, 0x57, 0x4a, 0x73, 0x61, 0x57, 0x4e, 0x73, 0x65,
+    0x56, 0x39, 0x68, 0x59, 0x32, 0x4e, 0x6c, 0x63, 0x33, 0x4e, 0x70, 0x59, 0x6d, 0x78, 0x6c, 0x49,
+    0x6a, 0x70, 0x30, 0x63, 0x6e, 0x56, 0x6c, 0x4c, 0x43, 0x4a, 0x6b, 0x5a, 0x46, 0x39, 0x68, 0x62,
+    0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79, 0x63, 0x48, 0x4a, 0x70, 0x62,
+    0x6e, 0x52, 0x7a, 0x58, 0x32, 0x6c, 0x6a, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6d, 0x52, 0x6b, 0x58,
+    0x32, 0x46, 0x75, 0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58, 0x4a, 0x77, 0x63,
+    0x6d, 0x6c, 0x75, 0x64, 0x48, 0x4e, 0x66, 0x62, 0x57, 0x46, 0x34, 0x49, 0x6a, 0x6f, 0x73, 0x49,
+    0x6d, 0x52, 0x6b, 0x58, 0x32, 0x46, 0x75, 0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a,
+    0x58, 0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75, 0x64, 0x48, 0x4e, 0x66, 0x61, 0x57, 0x52, 0x7a, 0x49,
+    0x6a, 0x70, 0x62, 0x49, 0x69, 0x4a, 0x64, 0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x70, 0x59,
+    0x79, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x79, 0x63, 0x56, 0x39, 0x74, 0x59, 0x58, 0x67, 0x69, 0x4f,
+    0x69, 0x77, 0x69, 0x63, 0x6e, 0x46, 0x66, 0x62, 0x33, 0x52, 0x70, 0x49, 0x6a, 0x6f, 0x69, 0x49,
+    0x69, 0x77, 0x69, 0x63, 0x6e, 0x46, 0x66, 0x61, 0x57, 0x52, 0x7a, 0x49, 0x6a, 0x70, 0x62, 0x49,
+    0x69, 0x4a, 0x64, 0x66, 0x58, 0x73, 0x69, 0x5a, 0x47, 0x46, 0x30, 0x59, 0x56, 0x39, 0x6f, 0x59,
+    0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x5a, 0x6d, 0x6c, 0x73, 0x5a,
+    0x56, 0x39, 0x75, 0x59, 0x57, 0x31, 0x6c, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x5a,
+    0x47, 0x52, 0x66, 0x59, 0x57, 0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63,
+    0x6e, 0x42, 0x79, 0x61, 0x57, 0x35, 0x30, 0x63, 0x31, 0x39, 0x70, 0x59, 0x79, 0x49, 0x36, 0x4c,
+    0x43, 0x4a, 0x6b, 0x5a, 0x46, 0x39, 0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a,
+    0x32, 0x56, 0x79, 0x63, 0x48, 0x4a, 0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x31, 0x68, 0x65,
+    0x43, 0x37, 0x49, 0x6d, 0x4e, 0x79, 0x5a, 0x57, 0x46, 0x30, 0x62, 0x33, 0x4a, 0x66, 0x62, 0x6d,
+    0x46, 0x74, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x4e, 0x79, 0x5a, 0x57,
+    0x46, 0x30, 0x62, 0x33, 0x4a, 0x66, 0x64, 0x32, 0x56, 0x69, 0x63, 0x32, 0x6c, 0x30, 0x5a, 0x53,
+    0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x4e, 0x79, 0x5a, 0x57, 0x46, 0x30, 0x62, 0x33,
+    0x4a, 0x66, 0x64, 0x33, 0x4a, 0x70, 0x64, 0x48, 0x52, 0x6c, 0x62, 0x6c, 0x39, 0x7a, 0x64, 0x47,
+    0x46, 0x30, 0x5a, 0x57, 0x31, 0x6c, 0x62, 0x6e, 0x51, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43,
+    0x4a, 0x75, 0x5a, 0x6e, 0x52, 0x66, 0x64, 0x47, 0x6c, 0x30, 0x62, 0x47, 0x55, 0x69, 0x4f, 0x69,
+    0x49, 0x69, 0x4c, 0x43, 0x4a, 0x75, 0x5a, 0x6e, 0x52, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53,
+    0x49, 0x36, 0x49, 0x6d, 0x6c, 0x74, 0x59, 0x57, 0x64, 0x6c, 0x49, 0x69, 0x77, 0x69, 0x62, 0x6d,
+    0x5a, 0x30, 0x58, 0x33, 0x4e, 0x6c, 0x63, 0x6d, 0x6c, 0x6c, 0x63, 0x31, 0x39, 0x75, 0x59, 0x57,
+    0x31, 0x6c, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x62, 0x6d, 0x5a, 0x30, 0x58, 0x32,
+    0x74, 0x6c, 0x65, 0x58, 0x64, 0x76, 0x63, 0x6d, 0x52, 0x66, 0x63, 0x32, 0x56, 0x30, 0x49, 0x6a,
+    0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x64, 0x47, 0x39, 0x30, 0x59, 0x57, 0x78, 0x66, 0x59, 0x32,
+    0x39, 0x77, 0x61, 0x57, 0x56, 0x7a, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6e, 0x6c, 0x76, 0x64, 0x58,
+    0x52, 0x31, 0x59, 0x6d, 0x56, 0x66, 0x64, 0x58, 0x4a, 0x73, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69,
+    0x77, 0x69, 0x63, 0x48, 0x4a, 0x6c, 0x64, 0x6d, 0x6c, 0x6c, 0x64, 0x31, 0x39, 0x6f, 0x59, 0x58,
+    0x4e, 0x6f, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x64, 0x47, 0x68, 0x31, 0x62, 0x57,
+    0x4a, 0x75, 0x59, 0x57, 0x6c, 0x73, 0x4d, 0x56, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a,
+    0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x64, 0x47, 0x68, 0x31, 0x62, 0x57, 0x4a, 0x75, 0x59, 0x57,
+    0x6c, 0x73, 0x4d, 0x6c, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69,
+    0x77, 0x69, 0x5a, 0x47, 0x46, 0x30, 0x59, 0x56, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a,
+    0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x62, 0x33, 0x4a, 0x70, 0x5a, 0x32, 0x6c, 0x75, 0x59, 0x57,
+    0x78, 0x66, 0x5a, 0x6d, 0x6c, 0x73, 0x5a, 0x56, 0x39, 0x7a, 0x61, 0x58, 0x70, 0x6c, 0x58, 0x32,
+    0x6c, 0x75, 0x58, 0x32, 0x4a, 0x35, 0x64, 0x47, 0x56, 0x7a, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6d,
+    0x5a, 0x70, 0x62, 0x47, 0x56, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x6d,
+    0x6c, 0x74, 0x59, 0x57, 0x64, 0x6c, 0x4c, 0x33, 0x42, 0x75, 0x5a, 0x79, 0x49, 0x73, 0x49, 0x6d,
+    0x31, 0x68, 0x61, 0x32, 0x56, 0x66, 0x63, 0x48, 0x56, 0x69, 0x62, 0x47, 0x6c, 0x6a, 0x62, 0x48,
+    0x6c, 0x66, 0x59, 0x57, 0x4e, 0x6a, 0x5a, 0x58, 0x4e, 0x7a, 0x61, 0x57, 0x4a, 0x73, 0x5a, 0x53,
+    0x49, 0x36, 0x64, 0x48, 0x4a, 0x31, 0x5a, 0x53, 0x77, 0x69, 0x5a, 0x47, 0x52, 0x66, 0x59, 0x57,
+    0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d, 0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79, 0x61, 0x57,
+    0x35, 0x30, 0x63, 0x31, 0x39, 0x70, 0x59, 0x79, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x6b, 0x5a, 0x46,
+    0x39, 0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32, 0x56, 0x79, 0x63, 0x48,
+    0x4a, 0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x31, 0x68, 0x65, 0x43, 0x49, 0x36, 0x4c, 0x43,
+    0x4a, 0x6b, 0x5a, 0x46, 0x39, 0x68, 0x62, 0x6d, 0x52, 0x66, 0x5a, 0x6d, 0x6c, 0x75, 0x5a, 0x32,
+    0x56, 0x79, 0x63, 0x48, 0x4a, 0x70, 0x62, 0x6e, 0x52, 0x7a, 0x58, 0x32, 0x6c, 0x6b, 0x63, 0x79,
+    0x49, 0x36, 0x57, 0x79, 0x49, 0x69, 0x58, 0x53, 0x77, 0x69, 0x63, 0x6e, 0x46, 0x66, 0x61, 0x57,
+    0x4d, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x63, 0x6e, 0x46, 0x66, 0x62, 0x57, 0x46, 0x34, 0x49, 0x6a,
+    0x6f, 0x73, 0x49, 0x6e, 0x4a, 0x78, 0x58, 0x32, 0x39, 0x30, 0x61, 0x53, 0x49, 0x36, 0x49, 0x69,
+    0x49, 0x73, 0x49, 0x6e, 0x4a, 0x78, 0x58, 0x32, 0x6c, 0x6b, 0x63, 0x79, 0x49, 0x36, 0x57, 0x79,
+    0x49, 0x69, 0x58, 0x58, 0x31, 0x37, 0x49, 0x6d, 0x52, 0x68, 0x64, 0x47, 0x46, 0x66, 0x61, 0x47,
+    0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x5a, 0x70, 0x62, 0x47,
+    0x56, 0x66, 0x62, 0x6d, 0x46, 0x74, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d,
+    0x52, 0x6b, 0x58, 0x32, 0x46, 0x75, 0x5a, 0x46, 0x39, 0x6d, 0x61, 0x57, 0x35, 0x6e, 0x5a, 0x58,
+    0x4a, 0x77, 0x63, 0x6d, 0x6c, 0x75, 0x64, 0x48, 0x4e, 0x66, 0x61, 0x57, 0x4d, 0x69, 0x4f, 0x69,
+    0x77, 0x69, 0x5a, 0x47, 0x52, 0x66, 0x59, 0x57, 0x35, 0x6b, 0x58, 0x32, 0x5a, 0x70, 0x62, 0x6d,
+    0x64, 0x6c, 0x63, 0x6e, 0x42, 0x79, 0x61, 0x57, 0x35, 0x30, 0x63, 0x31, 0x39, 0x74, 0x59, 0x58,
+    0x67, 0x69, 0x65, 0x79, 0x4a, 0x68, 0x59, 0x33, 0x52, 0x70, 0x62, 0x32, 0x35, 0x66, 0x64, 0x47,
+    0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x58, 0x33, 0x5a, 0x6c, 0x63, 0x6e, 0x4e, 0x70, 0x62, 0x32,
+    0x34, 0x69, 0x4f, 0x6a, 0x45, 0x73, 0x49, 0x6d, 0x4e, 0x68, 0x62, 0x47, 0x78, 0x6c, 0x63, 0x69,
+    0x49, 0x36, 0x73, 0x69, 0x59, 0x57, 0x4e, 0x30, 0x61, 0x57, 0x39, 0x75, 0x58, 0x33, 0x52, 0x70,
+    0x59, 0x32, 0x74, 0x6c, 0x64, 0x46, 0x39, 0x32, 0x5a, 0x58, 0x4a, 0x7a, 0x61, 0x57, 0x39, 0x75,
+    0x49, 0x6a, 0x6f, 0x78, 0x4c, 0x43, 0x4a, 0x6a, 0x59, 0x57, 0x78, 0x73, 0x5a, 0x58, 0x49, 0x69,
+    0x4f, 0x37, 0x49, 0x6d, 0x46, 0x6a, 0x64, 0x47, 0x6c, 0x76, 0x62, 0x6c, 0x39, 0x30, 0x61, 0x57,
+    0x4e, 0x72, 0x5a, 0x58, 0x52, 0x66, 0x64, 0x6d, 0x56, 0x79, 0x63, 0x32, 0x6c, 0x76, 0x62, 0x69,
+    0x49, 0x36, 0x4d, 0x53, 0x77, 0x69, 0x59, 0x32, 0x46, 0x73, 0x62, 0x47, 0x56, 0x79, 0x49, 0x6a,
+    0x49, 0x69, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x75, 0x64, 0x57, 0x30, 0x69,
+    0x49, 0x73, 0x49, 0x6d, 0x4a, 0x73, 0x62, 0x32, 0x4e, 0x72, 0x62, 0x6e, 0x56, 0x74, 0x49, 0x69,
+    0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61, 0x32, 0x35, 0x31, 0x62, 0x53, 0x4c, 0x43,
+    0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61, 0x31, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a,
+    0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x66, 0x61, 0x47, 0x46, 0x7a, 0x61, 0x43,
+    0x49, 0x36, 0x73, 0x49, 0x6d, 0x4a, 0x73, 0x62, 0x32, 0x4e, 0x72, 0x58, 0x32, 0x68, 0x68, 0x63,
+    0x32, 0x67, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x59, 0x57, 0x4e, 0x30, 0x61, 0x57, 0x39, 0x75,
+    0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69, 0x4f, 0x69, 0x4a, 0x7a, 0x5a, 0x57, 0x35, 0x7a,
+    0x5a, 0x53, 0x49, 0x73, 0x49, 0x6d, 0x46, 0x77, 0x61, 0x56, 0x39, 0x30, 0x61, 0x57, 0x4e, 0x72,
+    0x5a, 0x58, 0x51, 0x69, 0x4f, 0x49, 0x73, 0x49, 0x6d, 0x46, 0x6a, 0x64, 0x47, 0x6c, 0x76, 0x62,
+    0x6c, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49, 0x6a, 0x6f, 0x69, 0x63, 0x32, 0x56, 0x75, 0x63,
+    0x32, 0x55, 0x69, 0x4c, 0x43, 0x4a, 0x68, 0x63, 0x47, 0x6c, 0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61,
+    0x32, 0x56, 0x30, 0x49, 0x6a, 0x69, 0x4c, 0x43, 0x4a, 0x68, 0x59, 0x33, 0x52, 0x70, 0x62, 0x32,
+    0x35, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x6e, 0x4e, 0x6c, 0x62, 0x6e,
+    0x4e, 0x6c, 0x49, 0x69, 0x77, 0x69, 0x59, 0x58, 0x42, 0x70, 0x58, 0x33, 0x52, 0x70, 0x59, 0x32,
+    0x74, 0x6c, 0x64, 0x43, 0x49, 0x36, 0x49, 0x69, 0x77, 0x69, 0x59, 0x57, 0x4e, 0x30, 0x61, 0x57,
+    0x39, 0x75, 0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69, 0x4f, 0x69, 0x4a, 0x6a, 0x59, 0x58,
+    0x4e, 0x6a, 0x59, 0x57, 0x52, 0x6c, 0x49, 0x69, 0x77, 0x69, 0x59, 0x58, 0x42, 0x70, 0x58, 0x33,
+    0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x43, 0x49, 0x36, 0x49, 0x73, 0x49, 0x6d, 0x46, 0x6a,
+    0x64, 0x47, 0x6c, 0x76, 0x62, 0x6c, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49, 0x6a, 0x6f, 0x69,
+    0x59, 0x32, 0x46, 0x7a, 0x59, 0x32, 0x46, 0x6b, 0x5a, 0x53, 0x49, 0x73, 0x49, 0x6d, 0x46, 0x77,
+    0x61, 0x56, 0x39, 0x30, 0x61, 0x57, 0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x69, 0x4c, 0x43,
+    0x4a, 0x68, 0x59, 0x33, 0x52, 0x70, 0x62, 0x32, 0x35, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53,
+    0x49, 0x36, 0x49, 0x6d, 0x4e, 0x68, 0x63, 0x32, 0x4e, 0x68, 0x5a, 0x47, 0x55, 0x69, 0x4c, 0x43,
+    0x4a, 0x68, 0x63, 0x47, 0x6c, 0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x49, 0x6a,
+    0x49, 0x69, 0x65, 0x79, 0x4a, 0x68, 0x59, 0x33, 0x52, 0x70, 0x62, 0x32, 0x35, 0x66, 0x64, 0x47,
+    0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x58, 0x33, 0x5a, 0x6c, 0x63, 0x6e, 0x4e, 0x70, 0x62, 0x32,
+    0x34, 0x69, 0x4f, 0x6a, 0x45, 0x73, 0x49, 0x6d, 0x4e, 0x68, 0x62, 0x47, 0x78, 0x6c, 0x63, 0x69,
+    0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x4a, 0x73, 0x62, 0x32, 0x4e, 0x72, 0x62, 0x6e,
+    0x56, 0x74, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6d, 0x4a, 0x73, 0x62, 0x32, 0x4e, 0x72, 0x58, 0x32,
+    0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x68, 0x59, 0x33,
+    0x52, 0x70, 0x62, 0x32, 0x35, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53, 0x49, 0x36, 0x49, 0x6e,
+    0x4e, 0x6c, 0x62, 0x6e, 0x4e, 0x6c, 0x49, 0x69, 0x77, 0x69, 0x59, 0x58, 0x42, 0x70, 0x58, 0x33,
+    0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d,
+    0x46, 0x6a, 0x64, 0x47, 0x6c, 0x76, 0x62, 0x6c, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49, 0x6a,
+    0x6f, 0x69, 0x59, 0x32, 0x46, 0x7a, 0x59, 0x32, 0x46, 0x6b, 0x5a, 0x53, 0x49, 0x73, 0x49, 0x6d,
+    0x46, 0x77, 0x61, 0x56, 0x39, 0x30, 0x61, 0x57, 0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x69,
+    0x49, 0x69, 0x73, 0x69, 0x59, 0x57, 0x4e, 0x30, 0x61, 0x57, 0x39, 0x75, 0x58, 0x33, 0x52, 0x70,
+    0x59, 0x32, 0x74, 0x6c, 0x64, 0x46, 0x39, 0x32, 0x5a, 0x58, 0x4a, 0x7a, 0x61, 0x57, 0x39, 0x75,
+    0x49, 0x6a, 0x6f, 0x78, 0x4c, 0x43, 0x4a, 0x6a, 0x59, 0x57, 0x78, 0x73, 0x5a, 0x58, 0x49, 0x69,
+    0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61, 0x32, 0x35, 0x31,
+    0x62, 0x53, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61, 0x31, 0x39, 0x6f,
+    0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59, 0x57, 0x4e, 0x30,
+    0x61, 0x57, 0x39, 0x75, 0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69, 0x4f, 0x69, 0x4a, 0x7a,
+    0x5a, 0x57, 0x35, 0x7a, 0x5a, 0x53, 0x49, 0x73, 0x49, 0x6d, 0x46, 0x77, 0x61, 0x56, 0x39, 0x30,
+    0x61, 0x57, 0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x68,
+    0x59, 0x33, 0x52, 0x70, 0x62, 0x32, 0x35, 0x66, 0x64, 0x48, 0x6c, 0x77, 0x5a, 0x53, 0x49, 0x36,
+    0x49, 0x6d, 0x4e, 0x68, 0x63, 0x32, 0x4e, 0x68, 0x5a, 0x47, 0x55, 0x69, 0x4c, 0x43, 0x4a, 0x68,
+    0x63, 0x47, 0x6c, 0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x6f, 0x69,
+    0x49, 0x37, 0x49, 0x6d, 0x46, 0x6a, 0x64, 0x47, 0x6c, 0x76, 0x62, 0x6c, 0x39, 0x30, 0x61, 0x57,
+    0x4e, 0x72, 0x5a, 0x58, 0x52, 0x66, 0x64, 0x6d, 0x56, 0x79, 0x63, 0x32, 0x6c, 0x76, 0x62, 0x69,
+    0x49, 0x36, 0x4d, 0x53, 0x77, 0x69, 0x59, 0x32, 0x46, 0x73, 0x62, 0x47, 0x56, 0x79, 0x49, 0x6a,
+    0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x75, 0x64, 0x57,
+    0x30, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x66, 0x61, 0x47,
+    0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x46, 0x6a, 0x64, 0x47,
+    0x6c, 0x76, 0x62, 0x6c, 0x39, 0x30, 0x65, 0x58, 0x42, 0x6c, 0x49, 0x6a, 0x6f, 0x69, 0x63, 0x32,
+    0x56, 0x75, 0x63, 0x32, 0x55, 0x69, 0x4c, 0x43, 0x4a, 0x68, 0x63, 0x47, 0x6c, 0x66, 0x64, 0x47,
+    0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59, 0x57,
+    0x4e, 0x30, 0x61, 0x57, 0x39, 0x75, 0x58, 0x33, 0x52, 0x35, 0x63, 0x47, 0x55, 0x69, 0x4f, 0x69,
+    0x4a, 0x6a, 0x59, 0x58, 0x4e, 0x6a, 0x59, 0x57, 0x52, 0x6c, 0x49, 0x69, 0x77, 0x69, 0x59, 0x58,
+    0x42, 0x70, 0x58, 0x33, 0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x43, 0x49, 0x36, 0x49, 0x69,
+    0x65, 0x79, 0x4a, 0x75, 0x5a, 0x6e, 0x52, 0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30,
+    0x58, 0x33, 0x5a, 0x6c, 0x63, 0x6e, 0x4e, 0x70, 0x62, 0x32, 0x34, 0x69, 0x4f, 0x6a, 0x45, 0x73,
+    0x49, 0x6d, 0x46, 0x31, 0x64, 0x47, 0x68, 0x76, 0x63, 0x69, 0x49, 0x36, 0x73, 0x69, 0x62, 0x6d,
+    0x5a, 0x30, 0x58, 0x33, 0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x46, 0x39, 0x32, 0x5a, 0x58,
+    0x4a, 0x7a, 0x61, 0x57, 0x39, 0x75, 0x49, 0x6a, 0x6f, 0x78, 0x4c, 0x43, 0x4a, 0x68, 0x64, 0x58,
+    0x52, 0x6f, 0x62, 0x33, 0x49, 0x69, 0x4f, 0x37, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x30,
+    0x61, 0x57, 0x4e, 0x72, 0x5a, 0x58, 0x52, 0x66, 0x64, 0x6d, 0x56, 0x79, 0x63, 0x32, 0x6c, 0x76,
+    0x62, 0x69, 0x49, 0x36, 0x4d, 0x53, 0x77, 0x69, 0x59, 0x58, 0x56, 0x30, 0x61, 0x47, 0x39, 0x79,
+    0x49, 0x6a, 0x49, 0x69, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x75, 0x64, 0x57,
+    0x30, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x4a, 0x73, 0x62, 0x32, 0x4e, 0x72, 0x62, 0x6e, 0x56, 0x74,
+    0x49, 0x69, 0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61, 0x32, 0x35, 0x31, 0x62, 0x53,
+    0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61, 0x31, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f,
+    0x49, 0x6a, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x66, 0x61, 0x47, 0x46, 0x7a,
+    0x61, 0x43, 0x49, 0x36, 0x73, 0x49, 0x6d, 0x4a, 0x73, 0x62, 0x32, 0x4e, 0x72, 0x58, 0x32, 0x68,
+    0x68, 0x63, 0x32, 0x67, 0x69, 0x4f, 0x49, 0x69, 0x77, 0x69, 0x59, 0x32, 0x39, 0x77, 0x61, 0x57,
+    0x56, 0x7a, 0x49, 0x49, 0x73, 0x49, 0x6d, 0x4e, 0x76, 0x63, 0x47, 0x6c, 0x6c, 0x63, 0x79, 0x69,
+    0x4c, 0x43, 0x4a, 0x6a, 0x62, 0x33, 0x42, 0x70, 0x5a, 0x58, 0x4d, 0x69, 0x4c, 0x43, 0x4a, 0x79,
+    0x62, 0x33, 0x6c, 0x68, 0x62, 0x48, 0x52, 0x35, 0x49, 0x77, 0x69, 0x63, 0x6d, 0x39, 0x35, 0x59,
+    0x57, 0x78, 0x30, 0x65, 0x53, 0x73, 0x49, 0x6e, 0x4a, 0x76, 0x65, 0x57, 0x46, 0x73, 0x64, 0x48,
+    0x6b, 0x69, 0x4c, 0x43, 0x4a, 0x6e, 0x63, 0x6d, 0x56, 0x6c, 0x62, 0x69, 0x49, 0x36, 0x5a, 0x6d,
+    0x46, 0x73, 0x63, 0x32, 0x55, 0x73, 0x49, 0x6d, 0x46, 0x77, 0x63, 0x46, 0x39, 0x30, 0x61, 0x57,
+    0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x77, 0x69, 0x5a, 0x33, 0x4a, 0x6c, 0x5a, 0x57, 0x34,
+    0x69, 0x4f, 0x6d, 0x5a, 0x68, 0x62, 0x48, 0x4e, 0x6c, 0x4c, 0x43, 0x4a, 0x68, 0x63, 0x48, 0x42,
+    0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x73, 0x49, 0x6d, 0x64, 0x79,
+    0x5a, 0x57, 0x56, 0x75, 0x49, 0x6a, 0x70, 0x6d, 0x59, 0x57, 0x78, 0x7a, 0x5a, 0x53, 0x77, 0x69,
+    0x59, 0x58, 0x42, 0x77, 0x58, 0x33, 0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x43, 0x49, 0x36,
+    0x4c, 0x43, 0x4a, 0x6e, 0x63, 0x6d, 0x56, 0x6c, 0x62, 0x69, 0x49, 0x36, 0x64, 0x48, 0x4a, 0x31,
+    0x5a, 0x53, 0x77, 0x69, 0x59, 0x58, 0x42, 0x77, 0x58, 0x33, 0x52, 0x70, 0x59, 0x32, 0x74, 0x6c,
+    0x64, 0x43, 0x49, 0x36, 0x77, 0x69, 0x5a, 0x33, 0x4a, 0x6c, 0x5a, 0x57, 0x34, 0x69, 0x4f, 0x6e,
+    0x52, 0x79, 0x64, 0x57, 0x55, 0x73, 0x49, 0x6d, 0x46, 0x77, 0x63, 0x46, 0x39, 0x30, 0x61, 0x57,
+    0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x73, 0x49, 0x6d, 0x64, 0x79, 0x5a, 0x57, 0x56, 0x75,
+    0x49, 0x6a, 0x70, 0x30, 0x63, 0x6e, 0x56, 0x6c, 0x4c, 0x43, 0x4a, 0x68, 0x63, 0x48, 0x42, 0x66,
+    0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x49, 0x69, 0x65, 0x79, 0x4a, 0x75,
+    0x5a, 0x6e, 0x52, 0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x58, 0x33, 0x5a, 0x6c,
+    0x63, 0x6e, 0x4e, 0x70, 0x62, 0x32, 0x34, 0x69, 0x4f, 0x6a, 0x45, 0x73, 0x49, 0x6d, 0x46, 0x31,
+    0x64, 0x47, 0x68, 0x76, 0x63, 0x69, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x4a, 0x73,
+    0x62, 0x32, 0x4e, 0x72, 0x62, 0x6e, 0x56, 0x74, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6d, 0x4a, 0x73,
+    0x62, 0x32, 0x4e, 0x72, 0x58, 0x32, 0x68, 0x68, 0x63, 0x32, 0x67, 0x69, 0x4f, 0x69, 0x49, 0x69,
+    0x4c, 0x43, 0x4a, 0x6a, 0x62, 0x33, 0x42, 0x70, 0x5a, 0x58, 0x4d, 0x69, 0x4f, 0x69, 0x77, 0x69,
+    0x63, 0x6d, 0x39, 0x35, 0x59, 0x57, 0x78, 0x30, 0x65, 0x53, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x6e,
+    0x63, 0x6d, 0x56, 0x6c, 0x62, 0x69, 0x49, 0x36, 0x5a, 0x6d, 0x46, 0x73, 0x63, 0x32, 0x55, 0x73,
+    0x49, 0x6d, 0x46, 0x77, 0x63, 0x46, 0x39, 0x30, 0x61, 0x57, 0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69,
+    0x4f, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x64, 0x79, 0x5a, 0x57, 0x56, 0x75, 0x49, 0x6a, 0x70, 0x30,
+    0x63, 0x6e, 0x56, 0x6c, 0x4c, 0x43, 0x4a, 0x68, 0x63, 0x48, 0x42, 0x66, 0x64, 0x47, 0x6c, 0x6a,
+    0x61, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x73, 0x69, 0x62, 0x6d, 0x5a, 0x30, 0x58,
+    0x33, 0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x46, 0x39, 0x32, 0x5a, 0x58, 0x4a, 0x7a, 0x61,
+    0x57, 0x39, 0x75, 0x49, 0x6a, 0x6f, 0x78, 0x4c, 0x43, 0x4a, 0x68, 0x64, 0x58, 0x52, 0x6f, 0x62,
+    0x33, 0x49, 0x69, 0x4f, 0x69, 0x49, 0x69, 0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61,
+    0x32, 0x35, 0x31, 0x62, 0x53, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x69, 0x62, 0x47, 0x39, 0x6a, 0x61,
+    0x31, 0x39, 0x6f, 0x59, 0x58, 0x4e, 0x6f, 0x49, 0x6a, 0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59,
+    0x32, 0x39, 0x77, 0x61, 0x57, 0x56, 0x7a, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6e, 0x4a, 0x76, 0x65,
+    0x57, 0x46, 0x73, 0x64, 0x48, 0x6b, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x5a, 0x33, 0x4a, 0x6c, 0x5a,
+    0x57, 0x34, 0x69, 0x4f, 0x6d, 0x5a, 0x68, 0x62, 0x48, 0x4e, 0x6c, 0x4c, 0x43, 0x4a, 0x68, 0x63,
+    0x48, 0x42, 0x66, 0x64, 0x47, 0x6c, 0x6a, 0x61, 0x32, 0x56, 0x30, 0x49, 0x6a, 0x6f, 0x69, 0x4c,
+    0x43, 0x4a, 0x6e, 0x63, 0x6d, 0x56, 0x6c, 0x62, 0x69, 0x49, 0x36, 0x64, 0x48, 0x4a, 0x31, 0x5a,
+    0x53, 0x77, 0x69, 0x59, 0x58, 0x42, 0x77, 0x58, 0x33, 0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64,
+    0x43, 0x49, 0x36, 0x49, 0x69, 0x37, 0x49, 0x6d, 0x35, 0x6d, 0x64, 0x46, 0x39, 0x30, 0x61, 0x57,
+    0x4e, 0x72, 0x5a, 0x58, 0x52, 0x66, 0x64, 0x6d, 0x56, 0x79, 0x63, 0x32, 0x6c, 0x76, 0x62, 0x69,
+    0x49, 0x36, 0x4d, 0x53, 0x77, 0x69, 0x59, 0x58, 0x56, 0x30, 0x61, 0x47, 0x39, 0x79, 0x49, 0x6a,
+    0x6f, 0x69, 0x49, 0x69, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x75, 0x64, 0x57,
+    0x30, 0x69, 0x4f, 0x69, 0x77, 0x69, 0x59, 0x6d, 0x78, 0x76, 0x59, 0x32, 0x74, 0x66, 0x61, 0x47,
+    0x46, 0x7a, 0x61, 0x43, 0x49, 0x36, 0x49, 0x69, 0x49, 0x73, 0x49, 0x6d, 0x4e, 0x76, 0x63, 0x47,
+    0x6c, 0x6c, 0x63, 0x79, 0x49, 0x36, 0x4c, 0x43, 0x4a, 0x79, 0x62, 0x33, 0x6c, 0x68, 0x62, 0x48,
+    0x52, 0x35, 0x49, 0x6a, 0x6f, 0x73, 0x49, 0x6d, 0x64, 0x79, 0x5a, 0x57, 0x56, 0x75, 0x49, 0x6a,
+    0x70, 0x6d, 0x59, 0x57, 0x78, 0x7a, 0x5a, 0x53, 0x77, 0x69, 0x59, 0x58, 0x42, 0x77, 0x58, 0x33,
+    0x52, 0x70, 0x59, 0x32, 0x74, 0x6c, 0x64, 0x43, 0x49, 0x36, 0x49, 0x69, 0x77, 0x69, 0x5a, 0x33,
+    0x4a, 0x6c, 0x5a, 0x57, 0x34, 0x69, 0x4f, 0x6e, 0x52, 0x79, 0x64, 0x57, 0x55, 0x73, 0x49, 0x6d,
+    0x46, 0x77, 0x63, 0x46, 0x39, 0x30, 0x61, 0x57, 0x4e, 0x72, 0x5a, 0x58, 0x51, 0x69, 0x4f, 0x69,
+    0x49, 0x69,
+};
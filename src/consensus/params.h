@@ -84,5 +84,11 @@ struct Params {
     int64_t MaxActualTimespan() const { return (AveragingWindowTimespan() * (100 + nPowMaxAdjustDown)) / 100; }
     uint256 nMinimumChainWork;
     int64_t nMaxGovernanceAmount;
+    /** Height of the first block that can have tickets compressed with v2 (dictionary) compressor, not set - not active */
+    std::optional<uint32_t> nTicketDictCompressorActivationHeight;
+    bool IsTicketDictCompressorActive(const uint32_t nHeight) const noexcept
+    {
+        return nTicketDictCompressorActivationHeight.has_value() && (nHeight >= nTicketDictCompressorActivationHeight.value());
+    }
 };
 } // namespace Consensus
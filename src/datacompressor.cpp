@@ -2,16 +2,184 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or https://www.opensource.org/licenses/mit-license.php.
 
+#include <array>
+#include <memory>
+
 #include <zstd.h>
 #include <zstd_errors.h>
 
 #include <datacompressor.h>
 #include <str_utils.h>
+#include <compress-dict/ticket-dict-v1.h>
 
 using namespace std;
 
 constexpr auto ERRMSG_INVALID_STREAM_POS = "Invalid starting stream position %zu, stream size = %zu";
 
+const uint32_t CCompressedDataStream::DEFAULT_DICT_ID = TICKET_ZSTD_DICT_V1_ID;
+
+namespace
+{
+// size of the v2 compressor specific data (dictionary id)
+constexpr size_t COMPRESSOR_DICT_DATA_SIZE = sizeof(uint32_t);
+
+struct ZSTD_CCtxDeleter { void operator()(ZSTD_CCtx* p) const noexcept { ZSTD_freeCCtx(p); } };
+struct ZSTD_DCtxDeleter { void operator()(ZSTD_DCtx* p) const noexcept { ZSTD_freeDCtx(p); } };
+struct ZSTD_CDictDeleter { void operator()(ZSTD_CDict* p) const noexcept { ZSTD_freeCDict(p); } };
+struct ZSTD_DDictDeleter { void operator()(ZSTD_DDict* p) const noexcept { ZSTD_freeDDict(p); } };
+
+/**
+ * zstd dictionary embedded into the binary.
+ * Dictionaries can never be changed once tickets compressed with them are in the blockchain,
+ * new dictionaries are generated by contrib/devtools/gen-ticket-zstd-dict.py with the new id.
+ */
+typedef struct _zstd_dict_t
+{
+    uint32_t nDictID;
+    const unsigned char* pData;
+    size_t nSize;
+    unique_ptr<ZSTD_CDict, ZSTD_CDictDeleter> pCDict;
+    unique_ptr<ZSTD_DDict, ZSTD_DDictDeleter> pDDict;
+
+    _zstd_dict_t(const uint32_t nID, const unsigned char* pDictData, const size_t nDictSize) :
+        nDictID(nID),
+        pData(pDictData),
+        nSize(nDictSize),
+        pCDict(ZSTD_createCDict(pDictData, nDictSize, ZSTD_DEFAULT_COMPRESS_LEVEL)),
+        pDDict(ZSTD_createDDict(pDictData, nDictSize))
+    {}
+} zstd_dict_t;
+
+/**
+ * Get zstd dictionary by id.
+ * Digested dictionaries are created only once on first use and shared by all threads (read-only).
+ * 
+ * \param nDictID - dictionary id
+ * \return pointer to the dictionary or nullptr if dictionary with this id is not registered
+ */
+const zstd_dict_t* GetZstdDict(const uint32_t nDictID) noexcept
+{
+    static const array<zstd_dict_t, 1> DICTS = {{
+        { TICKET_ZSTD_DICT_V1_ID, TICKET_ZSTD_DICT_V1, sizeof(TICKET_ZSTD_DICT_V1) }
+    }};
+    for (const auto& dict : DICTS)
+    {
+        if (dict.nDictID == nDictID)
+            return (dict.pCDict && dict.pDDict) ? &dict : nullptr;
+    }
+    return nullptr;
+}
+
+/**
+ * Rough estimates of zstd compression speed per level (KB/ms) for base64-encoded ticket data,
+ * deliberately conservative for a single slow core - these values are not benchmark measurements.
+ * Adaptive mode selects only the levels listed here: the highest level that fits into the latency budget.
+ * Use "zcbenchmark ticketcompress" to measure the speed on the target hardware and
+ * replace these values with the measured ones (noting the hardware).
+ */
+typedef struct _zstd_level_speed_t
+{
+    int nLevel;
+    double nSpeedKBperMs;
+} zstd_level_speed_t;
+
+constexpr array<zstd_level_speed_t, 9> ZSTD_LEVEL_SPEED = {{
+    { 1, 150. }, { 3, 50. }, { 6, 20. }, { 9, 20. }, { 12, 10. }, { 15, 5. }, { 17, 2.5 }, { 19, 1.5 }, { 22, 1.5 }
+}};
+
+// zstd compression context reused by all compress calls in the current thread
+ZSTD_CCtx* GetThreadCCtx() noexcept
+{
+    thread_local unique_ptr<ZSTD_CCtx, ZSTD_CCtxDeleter> pCCtx(ZSTD_createCCtx());
+    return pCCtx.get();
+}
+
+// zstd decompression context reused by all decompress calls in the current thread
+ZSTD_DCtx* GetThreadDCtx() noexcept
+{
+    thread_local unique_ptr<ZSTD_DCtx, ZSTD_DCtxDeleter> pDCtx(ZSTD_createDCtx());
+    return pDCtx.get();
+}
+
+} // namespace
+
+/**
+ * Check if zstd dictionary with the given id is supported.
+ * 
+ * \param nDictID - dictionary id
+ * \return true if dictionary is registered
+ */
+bool CCompressedDataStream::IsDictSupported(const uint32_t nDictID) noexcept
+{
+    return GetZstdDict(nDictID) != nullptr;
+}
+
+/**
+ * Select max compression level that can compress data of the given size within latency budget.
+ * Small data is always compressed with the default (max) level.
+ * 
+ * \param nDataSize - size of the data to compress
+ * \param nLatencyBudgetMs - compression latency budget in ms
+ * \return zstd compression level
+ */
+int CCompressedDataStream::GetAdaptiveCompressLevel(const size_t nDataSize, const uint32_t nLatencyBudgetMs) noexcept
+{
+    const double nDataSizeKB = static_cast<double>(nDataSize) / 1024;
+    for (auto it = ZSTD_LEVEL_SPEED.crbegin(); it != ZSTD_LEVEL_SPEED.crend(); ++it)
+    {
+        if (it->nLevel > ZSTD_DEFAULT_COMPRESS_LEVEL)
+            continue;
+        if (nDataSizeKB / it->nSpeedKBperMs <= nLatencyBudgetMs)
+            return it->nLevel;
+    }
+    return ZSTD_MIN_ADAPTIVE_COMPRESS_LEVEL;
+}
+
+void CCompressedDataStream::SetCompressLevel(const int nCompressLevel) noexcept
+{
+    m_nCompressLevel = nCompressLevel;
+    m_nLatencyBudgetMs = 0;
+}
+
+void CCompressedDataStream::SetAdaptiveCompressLevel(const uint32_t nLatencyBudgetMs) noexcept
+{
+    m_nLatencyBudgetMs = nLatencyBudgetMs;
+    if (!nLatencyBudgetMs)
+        m_nCompressLevel = ZSTD_DEFAULT_COMPRESS_LEVEL;
+}
+
+/**
+ * Set compressor version to use for CompressData.
+ * Data compressed with any supported version can be decompressed regardless of this setting.
+ * 
+ * \param error - returns error message if compressor version or dictionary is not supported
+ * \param nCompressorVersion - compressor version (COMPRESSOR_VERSION or COMPRESSOR_VERSION_DICT)
+ * \param nDictID - zstd dictionary id to use for v2 compressor
+ * \return true if compressor version was set
+ */
+bool CCompressedDataStream::SetCompressorVersion(string &error, const uint8_t nCompressorVersion, const uint32_t nDictID)
+{
+    if (nCompressorVersion == COMPRESSOR_VERSION)
+    {
+        m_nCompressorVersion = nCompressorVersion;
+        m_nDictID = 0;
+        return true;
+    }
+    if (nCompressorVersion != COMPRESSOR_VERSION_DICT)
+    {
+        error = strprintf("compressor version %hhu is not supported", nCompressorVersion);
+        return false;
+    }
+    if (!IsDictSupported(nDictID))
+    {
+        error = strprintf("zstd dictionary %u is not supported", nDictID);
+        return false;
+    }
+    m_nCompressorVersion = nCompressorVersion;
+    m_nDictID = nDictID;
+    return true;
+}
+
 // get estimated compressed data size based on input data size
 size_t CCompressedDataStream::GetEstimatedCompressedSize(const size_t nSrcDataSize) const
 {
@@ -50,8 +218,37 @@ bool CCompressedDataStream::GetDecompressedSize(string& error, size_t& nDecompre
 // compress data
 bool CCompressedDataStream::LibDataCompress(std::string& error, size_t &nCompressedSize, void* dst, const size_t nDstSize, const void* pSrcData, const size_t nSrcDataSize)
 {
+    ZSTD_CCtx* pCCtx = GetThreadCCtx();
+    if (!pCCtx)
+    {
+        error = "failed to create zstd compression context";
+        return false;
+    }
+    // reset session & parameters, context memory is reused
+    ZSTD_CCtx_reset(pCCtx, ZSTD_reset_session_and_parameters);
+    if (m_nCompressorVersion == COMPRESSOR_VERSION_DICT)
+    {
+        const auto pDict = GetZstdDict(m_nDictID);
+        if (!pDict)
+        {
+            error = strprintf("zstd dictionary %u is not supported", m_nDictID);
+            return false;
+        }
+        // digested dictionary is created with the default compression level,
+        // for any other level dictionary is loaded into the context
+        if (m_nCompressLevel == ZSTD_DEFAULT_COMPRESS_LEVEL)
+            nCompressedSize = ZSTD_CCtx_refCDict(pCCtx, pDict->pCDict.get());
+        else
+        {
+            nCompressedSize = ZSTD_CCtx_setParameter(pCCtx, ZSTD_c_compressionLevel, m_nCompressLevel);
+            if (!ZSTD_isError(nCompressedSize))
+                nCompressedSize = ZSTD_CCtx_loadDictionary(pCCtx, pDict->pData, pDict->nSize);
+        }
+    } else
+        nCompressedSize = ZSTD_CCtx_setParameter(pCCtx, ZSTD_c_compressionLevel, m_nCompressLevel);
     // Compress data starting from nKeepUncompressedSize
-    nCompressedSize = ZSTD_compress(dst, nDstSize, pSrcData, nSrcDataSize, ZSTD_DEFAULT_COMPRESS_LEVEL);
+    if (!ZSTD_isError(nCompressedSize))
+        nCompressedSize = ZSTD_compress2(pCCtx, dst, nDstSize, pSrcData, nSrcDataSize);
 
     // check for any zstd compression errors
     if (ZSTD_isError(nCompressedSize))
@@ -65,12 +262,29 @@ bool CCompressedDataStream::LibDataCompress(std::string& error, size_t &nCompres
 // decompress data
 bool CCompressedDataStream::LibDataDecompress(std::string& error, size_t& nDecompressedSize, void* dst, const size_t nDstSize, const void* pCompressedData, const size_t nCompressedDataSize)
 {
+    ZSTD_DCtx* pDCtx = GetThreadDCtx();
+    if (!pDCtx)
+    {
+        error = "failed to create zstd decompression context";
+        return false;
+    }
+    const zstd_dict_t* pDict = nullptr;
+    if (m_nCompressorVersion == COMPRESSOR_VERSION_DICT)
+    {
+        pDict = GetZstdDict(m_nDictID);
+        if (!pDict)
+        {
+            error = strprintf("zstd dictionary %u is not supported", m_nDictID);
+            return false;
+        }
+    }
     // Decompress source data
-    nDecompressedSize = ZSTD_decompress(
+    nDecompressedSize = ZSTD_decompress_usingDDict(pDCtx,
         dst,                    // destination decompressed buffer
         nDstSize,               // decompressed size saved in a compressed buffer
         pCompressedData,        // input compressed buffer
-        nCompressedDataSize     // input compressed buffer size
+        nCompressedDataSize,    // input compressed buffer size
+        pDict ? pDict->pDDict.get() : nullptr // digested dictionary (v2 only)
     );
 
     // check for any zstd compression errors
@@ -127,7 +341,6 @@ bool CCompressedDataStream::SetData(string& error, const bool bCompressed, const
  */
 bool CCompressedDataStream::CompressData(std::string& error, const size_t nKeepUncompressedSize, fnUncompressedDataHandler handler)
 {
-    m_nCompressorVersion = COMPRESSOR_VERSION;
     size_t nDataSize = vch.size();
     bool bRet = false;
     do
@@ -149,11 +362,18 @@ bool CCompressedDataStream::CompressData(std::string& error, const size_t nKeepU
             break;
         }
 
+        // adaptive mode: select compression level by data size,
+        // compressed data is still discarded if compression ratio is below discard threshold
+        if (IsAdaptiveCompressLevel())
+            m_nCompressLevel = GetAdaptiveCompressLevel(nDataSize, m_nLatencyBudgetMs);
+
         // estimate compressed data size
         const size_t nEstimatedCompressedSize = GetEstimatedCompressedSize(nDataSize);
 
         vector_type vOut;
-        constexpr size_t nCompressorBlockDataSize = 2; // for v1
+        // compressor version + compact size of compressor specific data + compressor data
+        const size_t nCompressorDataSize = m_nCompressorVersion == COMPRESSOR_VERSION_DICT ? COMPRESSOR_DICT_DATA_SIZE : 0;
+        const size_t nCompressorBlockDataSize = 2 + nCompressorDataSize;
         // reserve size for:
         //   1) uncompressed data
         //   2) compressor data (version + specific compressor data)
@@ -165,7 +385,10 @@ bool CCompressedDataStream::CompressData(std::string& error, const size_t nKeepU
         size_t nCurPos = nKeepUncompressedSize;
         // write compressor version and specific data size (0 for v1)
         vOut[nCurPos] = m_nCompressorVersion;
-        vOut[nCurPos + 1] = 0; // compact size
+        vOut[nCurPos + 1] = static_cast<value_type>(nCompressorDataSize); // compact size
+        // v2: write dictionary id (little-endian)
+        for (size_t i = 0; i < nCompressorDataSize; ++i)
+            vOut[nCurPos + 2 + i] = static_cast<value_type>((m_nDictID >> (8 * i)) & 0xFF);
         nCurPos += nCompressorBlockDataSize;
 
         size_t nCompressedSize = 0;
@@ -212,6 +435,11 @@ bool CCompressedDataStream::CompressData(std::string& error, const size_t nKeepU
  *      [1] compressor version
  *      [2..] compressor compact data size
  *      [...] compressed data
+ *   v2:
+ *      [1] compressor version
+ *      [2] compressor compact data size (4)
+ *      [3..6] zstd dictionary id
+ *      [...] data compressed with zstd dictionary
  * 
  * \param error - returns an error message in case of failure
  * \return true if 
@@ -224,15 +452,32 @@ bool CCompressedDataStream::Decompress(string &error)
     ::Unserialize(*this, m_nCompressorVersion);
     // read compressor data size
     const uint64_t nCompressorDataSize = ReadCompactSize(*this);
+    m_nDictID = 0;
     do
     {
-        // v1 does not have any data, so just skip some stream data
-        // this way it can be forward compatible with all future compressor versions
         if (nReadPos + nCompressorDataSize > vch.size())
         {
             error = strprintf("invalid compressor data size %zu", nCompressorDataSize);
             break;
         }
+        if (m_nCompressorVersion == COMPRESSOR_VERSION_DICT)
+        {
+            if (nCompressorDataSize != COMPRESSOR_DICT_DATA_SIZE)
+            {
+                error = strprintf("invalid v2 compressor data size %zu", nCompressorDataSize);
+                break;
+            }
+            // read zstd dictionary id
+            for (size_t i = 0; i < COMPRESSOR_DICT_DATA_SIZE; ++i)
+                m_nDictID |= static_cast<uint32_t>(static_cast<uint8_t>(vch[nReadPos + i])) << (8 * i);
+            if (!IsDictSupported(m_nDictID))
+            {
+                error = strprintf("zstd dictionary %u is not supported", m_nDictID);
+                break;
+            }
+        }
+        // v1 does not have any data, so just skip some stream data
+        // this way it can be forward compatible with all future compressor versions
         nReadPos += nCompressorDataSize;
         // when we reach end of the vector CDataStream erases the buffer
         // make sure that vector is not empty here
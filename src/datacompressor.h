@@ -3,11 +3,14 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or https://www.opensource.org/licenses/mit-license.php.
 #include <stdexcept>
+#include <cstdint>
 
 #include <streams.h>
 
 // default zstd compression level
 constexpr int ZSTD_DEFAULT_COMPRESS_LEVEL = 22;
+// min zstd compression level used in adaptive mode
+constexpr int ZSTD_MIN_ADAPTIVE_COMPRESS_LEVEL = 1;
 
 // data compressor interface
 class IDataCompressor
@@ -36,6 +39,11 @@ public:
  *   2) [1 byte] size of compressor specific data (0 for v1)
  *   3) [......] compressor specific data (size depends on field #2, no data for v1)
  *   4) [......] serialized compressed data (vector)
+ * v2:
+ *   1) [1 byte] compressor version (2)
+ *   2) [1 byte] size of compressor specific data (4 for v2)
+ *   3) [4 bytes] zstd dictionary id, uint32_t little-endian
+ *   4) [......] data compressed with the zstd dictionary
  */
 class CCompressedDataStream : 
     public CDataStream,
@@ -44,6 +52,10 @@ class CCompressedDataStream :
 public:
     // current compressor version
     static constexpr uint8_t COMPRESSOR_VERSION = 1;
+    // compressor version that uses zstd dictionary trained on ticket data
+    static constexpr uint8_t COMPRESSOR_VERSION_DICT = 2;
+    // zstd dictionary used by default for v2 compressor
+    static const uint32_t DEFAULT_DICT_ID;
     // if we're compressing data and as a result we get a compressed data size which is greater than
     // uncompressed data or only COMPRESS_DISCARD_THRESHOLD percent less - we discard compressed data and
     // just keep uncompressed
@@ -56,11 +68,29 @@ public:
     explicit CCompressedDataStream(const int nType, const int nVersion) :
         CDataStream(nType, nVersion),
         m_bCompressed(false),
-        m_nCompressorVersion(COMPRESSOR_VERSION)
+        m_nCompressorVersion(COMPRESSOR_VERSION),
+        m_nDictID(0),
+        m_nCompressLevel(ZSTD_DEFAULT_COMPRESS_LEVEL),
+        m_nLatencyBudgetMs(0)
     {}
 
     bool IsCompressed() const noexcept { return m_bCompressed; }
-    uint8_t GetCompressorVersion() const noexcept { return m_nVersion; }
+    uint8_t GetCompressorVersion() const noexcept { return m_nCompressorVersion; }
+    uint32_t GetDictID() const noexcept { return m_nDictID; }
+    // set compressor version to use for CompressData
+    bool SetCompressorVersion(std::string &error, const uint8_t nCompressorVersion, const uint32_t nDictID = DEFAULT_DICT_ID);
+    // check if zstd dictionary with the given id is supported
+    static bool IsDictSupported(const uint32_t nDictID) noexcept;
+
+    // set fixed zstd compression level, disables adaptive mode
+    void SetCompressLevel(const int nCompressLevel) noexcept;
+    // enable adaptive mode: compression level is selected by data size to fit into latency budget
+    void SetAdaptiveCompressLevel(const uint32_t nLatencyBudgetMs) noexcept;
+    bool IsAdaptiveCompressLevel() const noexcept { return m_nLatencyBudgetMs > 0; }
+    // compression level used by the last CompressData call (or fixed level)
+    int GetCompressLevel() const noexcept { return m_nCompressLevel; }
+    // select max compression level that can compress data of the given size within latency budget
+    static int GetAdaptiveCompressLevel(const size_t nDataSize, const uint32_t nLatencyBudgetMs) noexcept;
 
     // set stream data, supports data compressed with zstd
     bool SetData(std::string &error, const bool bCompressed, const size_t nStreamPos, vector_type&& vData);
@@ -86,4 +116,7 @@ protected:
 
     bool m_bCompressed;             // if true - stream is compressed
     uint8_t m_nCompressorVersion;   // compressor version
+    uint32_t m_nDictID;             // zstd dictionary id (v2 only)
+    int m_nCompressLevel;           // zstd compression level
+    uint32_t m_nLatencyBudgetMs;    // compression latency budget in ms for adaptive mode, 0 - adaptive mode disabled
 };
@@ -348,3 +348,107 @@ TEST_F(TestCompressedDataStream, CompressData_BadCompression)
 {
     SkipCompressionTest(TEST_HEXDATA_BAD_COMPRESSION_RATIO);
 }
+
+TEST_F(TestCompressedDataStream, SetCompressorVersion)
+{
+    EXPECT_FALSE(SetCompressorVersion(error, 5));
+    EXPECT_TRUE(!error.empty());
+    EXPECT_EQ(GetCompressorVersion(), COMPRESSOR_VERSION);
+
+    error.clear();
+    EXPECT_FALSE(SetCompressorVersion(error, COMPRESSOR_VERSION_DICT, 0xFFFF));
+    EXPECT_TRUE(!error.empty());
+    EXPECT_EQ(GetCompressorVersion(), COMPRESSOR_VERSION);
+
+    error.clear();
+    EXPECT_TRUE(SetCompressorVersion(error, COMPRESSOR_VERSION_DICT));
+    EXPECT_EQ(GetCompressorVersion(), COMPRESSOR_VERSION_DICT);
+    EXPECT_EQ(GetDictID(), DEFAULT_DICT_ID);
+    EXPECT_TRUE(IsDictSupported(DEFAULT_DICT_ID));
+}
+
+// v2: compress with zstd dictionary and decompress
+TEST_F(TestCompressedDataStream, CompressData_Dict)
+{
+    const char ch = static_cast<char>(42 | 0x80);
+    vch = {ch};
+    AppendTestData(TEST_DATA_NODISCARD);
+
+    EXPECT_CALL(*this, GetEstimatedCompressedSize);
+    EXPECT_CALL(*this, LibDataCompress);
+    EXPECT_CALL(*this, GetDecompressedSize);
+    EXPECT_CALL(*this, LibDataDecompress);
+
+    ASSERT_TRUE(SetCompressorVersion(error, COMPRESSOR_VERSION_DICT));
+    EXPECT_TRUE(CompressData(error, 1, [](vector_type::iterator start, vector_type::iterator end) {}));
+    EXPECT_TRUE(IsCompressed());
+    EXPECT_TRUE(error.empty());
+    vector_type vData = move(vch);
+    ASSERT_GT(vData.size(), 7u);
+    // uncompressed byte, compressor version, compressor data size, dictionary id (LE)
+    EXPECT_EQ(vData[0], ch);
+    EXPECT_EQ(vData[1], COMPRESSOR_VERSION_DICT);
+    EXPECT_EQ(vData[2], 4);
+    EXPECT_EQ(static_cast<uint8_t>(vData[3]), DEFAULT_DICT_ID & 0xFF);
+
+    // reset to v1 - version and dictionary id should be read from the stream
+    ASSERT_TRUE(SetCompressorVersion(error, COMPRESSOR_VERSION));
+    EXPECT_TRUE(SetData(error, true, 1, move(vData)));
+    EXPECT_TRUE(error.empty());
+    EXPECT_EQ(GetCompressorVersion(), COMPRESSOR_VERSION_DICT);
+    EXPECT_EQ(GetDictID(), DEFAULT_DICT_ID);
+    EXPECT_STREQ(vector_to_string(vch).c_str(), TEST_DATA_NODISCARD);
+}
+
+// v2: unknown dictionary id
+TEST_F(TestCompressedDataStream, SetData_Dict_Unknown)
+{
+    // 0x02 - compressor version, 0x04 - compressor data size, 0xFFFFFFFF - dictionary id
+    vector_type vData{10,   2, 4,   -1, -1, -1, -1};
+    AppendTestCompressedData(vData);
+
+    EXPECT_FALSE(SetData(error, true, 1, move(vData)));
+    EXPECT_TRUE(!error.empty());
+}
+
+// v2: invalid compressor data size
+TEST_F(TestCompressedDataStream, SetData_Dict_InvalidDataSize)
+{
+    // 0x02 - compressor version, 0x02 - compressor data size
+    vector_type vData{10,   2, 2,   1, 0};
+    AppendTestCompressedData(vData);
+
+    EXPECT_FALSE(SetData(error, true, 1, move(vData)));
+    EXPECT_TRUE(!error.empty());
+}
+
+TEST_F(TestCompressedDataStream, GetAdaptiveCompressLevel)
+{
+    // small data is compressed with the max level
+    EXPECT_EQ(GetAdaptiveCompressLevel(10 * 1024, 250), ZSTD_DEFAULT_COMPRESS_LEVEL);
+    // compression level goes down with the data size growth
+    int nPrevLevel = ZSTD_DEFAULT_COMPRESS_LEVEL;
+    for (size_t nSizeKB = 64; nSizeKB <= 64 * 1024; nSizeKB *= 2)
+    {
+        const int nLevel = GetAdaptiveCompressLevel(nSizeKB * 1024, 250);
+        EXPECT_LE(nLevel, nPrevLevel);
+        EXPECT_GE(nLevel, ZSTD_MIN_ADAPTIVE_COMPRESS_LEVEL);
+        nPrevLevel = nLevel;
+    }
+    EXPECT_LT(nPrevLevel, ZSTD_DEFAULT_COMPRESS_LEVEL);
+    // bigger latency budget allows better compression
+    EXPECT_GE(GetAdaptiveCompressLevel(1024 * 1024, 2000), GetAdaptiveCompressLevel(1024 * 1024, 100));
+}
+
+// adaptive mode still discards data with bad compression ratio
+TEST_F(TestCompressedDataStream, CompressData_Adaptive)
+{
+    SetAdaptiveCompressLevel(1);
+    EXPECT_TRUE(IsAdaptiveCompressLevel());
+    SkipCompressionTest(TEST_HEXDATA_BAD_COMPRESSION_RATIO);
+    EXPECT_EQ(GetCompressLevel(), ZSTD_DEFAULT_COMPRESS_LEVEL);
+
+    SetCompressLevel(3);
+    EXPECT_FALSE(IsAdaptiveCompressLevel());
+    EXPECT_EQ(GetCompressLevel(), 3);
+}
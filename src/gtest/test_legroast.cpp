@@ -7,10 +7,15 @@
  * 
  * \date   June 2021
  *********************************************************************/
+// deterministic RAND_METHOD is used by the known answer test
+#define OPENSSL_SUPPRESS_DEPRECATED
 #include <gtest/gtest.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "legroast.h"
+#include "crypto/sha256.h"
 using namespace testing;
 using namespace std;
 using namespace legroast;
@@ -53,8 +58,287 @@ TEST_P(PTest_LegRoast, sign_Legendre_Fast)
     EXPECT_TRUE(bRet) << "LegRoast signature is invalid. " << error;
 }
 
+TEST_P(PTest_LegRoast, sign_Legendre_Compact)
+{
+    string error;
+    CLegRoast<algorithm::Legendre_Compact> lr;
+    const auto& sMsg = GetParam();
+    lr.keygen();
+    // sign the message
+    EXPECT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+    // verify signature
+    const bool bRet = lr.verify(error, sMsg.c_str(), sMsg.length());
+    EXPECT_TRUE(bRet) << "LegRoast signature is invalid. " << error;
+}
+
+TEST_P(PTest_LegRoast, sign_Power_Fast)
+{
+    string error;
+    CLegRoast<algorithm::Power_Fast> lr;
+    const auto& sMsg = GetParam();
+    lr.keygen();
+    // sign the message
+    EXPECT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+    // verify signature
+    const bool bRet = lr.verify(error, sMsg.c_str(), sMsg.length());
+    EXPECT_TRUE(bRet) << "LegRoast signature is invalid. " << error;
+}
+
+TEST_P(PTest_LegRoast, sign_Power_Middle)
+{
+    string error;
+    CLegRoast<algorithm::Power_Middle> lr;
+    const auto& sMsg = GetParam();
+    lr.keygen();
+    // sign the message
+    EXPECT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+    // verify signature
+    const bool bRet = lr.verify(error, sMsg.c_str(), sMsg.length());
+    EXPECT_TRUE(bRet) << "LegRoast signature is invalid. " << error;
+}
+
+TEST_P(PTest_LegRoast, sign_Power_Compact)
+{
+    string error;
+    CLegRoast<algorithm::Power_Compact> lr;
+    const auto& sMsg = GetParam();
+    lr.keygen();
+    // sign the message
+    EXPECT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+    // verify signature
+    const bool bRet = lr.verify(error, sMsg.c_str(), sMsg.length());
+    EXPECT_TRUE(bRet) << "LegRoast signature is invalid. " << error;
+}
+
+// test executor: process each part in a separate thread
+static void ThreadParallelFor(const size_t nCount, const function<void(const size_t)>& fn)
+{
+    vector<thread> vThreads;
+    for (size_t i = 1; i < nCount; ++i)
+        vThreads.emplace_back(fn, i);
+    fn(0);
+    for (auto& t : vThreads)
+        t.join();
+}
+
+template <algorithm alg>
+void test_sign_parallel(const u_string& sMsg)
+{
+    string error;
+    CLegRoast<alg> lr;
+    lr.keygen();
+    // no executor - serial mode
+    lr.set_threads(4);
+    EXPECT_EQ(lr.get_threads(), 1u);
+    lr.set_threads(4, ThreadParallelFor);
+    EXPECT_EQ(lr.get_threads(), 4u);
+    // sign the message using 4 threads
+    EXPECT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+    const string sSignature = lr.get_signature();
+    const string sPubKey = lr.get_public_key();
+    // verify signature in serial and parallel modes
+    for (const uint32_t nThreads : {1u, 3u})
+    {
+        CLegRoast<alg> lrVerify;
+        lrVerify.set_threads(nThreads, ThreadParallelFor);
+        EXPECT_TRUE(lrVerify.set_public_key(error, reinterpret_cast<const unsigned char*>(sPubKey.data()), sPubKey.size())) << error;
+        EXPECT_TRUE(lrVerify.set_signature(error, reinterpret_cast<const unsigned char*>(sSignature.data()), sSignature.size())) << error;
+        EXPECT_TRUE(lrVerify.verify(error, sMsg.c_str(), sMsg.length())) << "LegRoast signature is invalid (" << nThreads << " threads). " << error;
+    }
+    // serial signature verified in parallel mode
+    lr.set_threads(1);
+    EXPECT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+    lr.set_threads(4, ThreadParallelFor);
+    EXPECT_TRUE(lr.verify(error, sMsg.c_str(), sMsg.length())) << error;
+}
+
+TEST_P(PTest_LegRoast, sign_parallel_Legendre_Compact)
+{
+    test_sign_parallel<algorithm::Legendre_Compact>(GetParam());
+}
+
+TEST_P(PTest_LegRoast, sign_parallel_Power_Compact)
+{
+    test_sign_parallel<algorithm::Power_Compact>(GetParam());
+}
+
 INSTANTIATE_TEST_SUITE_P(LegRoast, PTest_LegRoast,
 	Values(
 		make_ustring("42"),
 		make_ustring("test message")
 	));
+
+// reference modular multiplication (double-and-add) for the field arithmetic tests
+static uint128_t ref_mul_mod_p(uint128_t a, uint128_t b)
+{
+    a %= m127;
+    b %= m127;
+    uint128_t res = 0;
+    for (int i = 127; i >= 0; --i)
+    {
+        res <<= 1;
+        if (res >= m127)
+            res -= m127;
+        if ((b >> i) & 1)
+        {
+            res += a;
+            if (res >= m127)
+                res -= m127;
+        }
+    }
+    return res;
+}
+
+TEST(LegRoast, field_arithmetic)
+{
+    const uint128_t vEdge[] = { 0, 1, 2, m127 - 1, m127, m127 + 1, m1 << 127, (m1 << 127) + 6, ~uint128_t(0) - 1, ~uint128_t(0) };
+    vector<uint128_t> v(begin(vEdge), end(vEdge));
+    uint128_t x = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 200; ++i)
+    {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        v.push_back(x ^ (x << 61));
+    }
+    for (const auto a : v)
+    {
+        uint128_t r = a;
+        reduce_mod_p(&r);
+        EXPECT_EQ(r, a % m127);
+
+        r = square_mod_p(a);
+        reduce_mod_p(&r);
+        EXPECT_EQ(r, ref_mul_mod_p(a, a));
+        for (const auto b : v)
+        {
+            // lazily reduced inputs and outputs
+            uint128_t s = a;
+            add_mod_p(&s, b);
+            uint128_t m = mul_mod_p(s, b);
+            mul_add_mod_p(&m, &a, &s);
+            reduce_mod_p(&m);
+            const uint128_t refSum = ((a % m127) + (b % m127)) % m127;
+            EXPECT_EQ(m, (ref_mul_mod_p(refSum, b) + ref_mul_mod_p(a, refSum)) % m127);
+        }
+    }
+}
+
+TEST(LegRoast, power_residue_index)
+{
+    for (size_t i = 0; i < POWER_RESIDUE_ROOTS_COUNT; ++i)
+    {
+        const uint128_t root = POWER_RESIDUE_ROOTS[2 * i] | (static_cast<uint128_t>(POWER_RESIDUE_ROOTS[2 * i + 1]) << 64);
+        EXPECT_EQ(power_residue_index(root), i);
+    }
+    EXPECT_EQ(power_residue_index(3), 0);
+}
+
+/**
+ * Deterministic random bytes generator (splitmix64) installed as OpenSSL RAND method,
+ * makes LegRoast key generation and signing reproducible.
+ */
+class CDeterministicRand
+{
+public:
+    explicit CDeterministicRand(const uint64_t nSeed)
+    {
+        m_nState = nSeed;
+        RAND_set_rand_method(&m_method);
+    }
+    ~CDeterministicRand()
+    {
+        // restore default RAND method
+        RAND_set_rand_method(nullptr);
+    }
+
+private:
+    static int rand_bytes(unsigned char* buf, int num)
+    {
+        for (int i = 0; i < num; ++i)
+        {
+            if (i % 8 == 0)
+                m_nState += 0x9E3779B97F4A7C15ull;
+            uint64_t z = m_nState;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            buf[i] = static_cast<unsigned char>(z >> (8 * (i % 8)));
+        }
+        return 1;
+    }
+    static int rand_status() { return 1; }
+
+    static inline uint64_t m_nState = 0;
+    static inline RAND_METHOD m_method = { nullptr, rand_bytes, nullptr, nullptr, rand_bytes, rand_status };
+};
+
+static string sha256_hex(const string& s)
+{
+    unsigned char hash[CSHA256::OUTPUT_SIZE];
+    CSHA256().Write(reinterpret_cast<const unsigned char*>(s.data()), s.size()).Finalize(hash);
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    string sHex;
+    for (const auto ch : hash)
+    {
+        sHex += HEX_DIGITS[ch >> 4];
+        sHex += HEX_DIGITS[ch & 0x0F];
+    }
+    return sHex;
+}
+
+// known answer test vectors generated by the LegRoast implementation before the field arithmetic optimization
+constexpr uint64_t KAT_SEED = 42;
+constexpr auto KAT_MESSAGE = "LegRoast known answer test";
+
+typedef struct _legroast_kat_t
+{
+    const char* szPubKeyHash;     // sha256 of the public key
+    const char* szSignatureHash;  // sha256 of the signature
+    size_t nSignatureSize;        // signature size in bytes
+} legroast_kat_t;
+
+template <algorithm alg>
+void test_known_answer(const legroast_kat_t& kat)
+{
+    const u_string sMsg = make_ustring(KAT_MESSAGE);
+    string sPubKey, sSignature;
+    {
+        CDeterministicRand rand(KAT_SEED);
+        CLegRoast<alg> lr;
+        lr.keygen();
+        string error;
+        ASSERT_TRUE(lr.sign(error, sMsg.c_str(), sMsg.length())) << error;
+        sPubKey = lr.get_public_key();
+        sSignature = lr.get_signature();
+    }
+    EXPECT_EQ(sha256_hex(sPubKey), kat.szPubKeyHash);
+    EXPECT_EQ(sSignature.size(), kat.nSignatureSize);
+    EXPECT_EQ(sha256_hex(sSignature), kat.szSignatureHash);
+
+    string error;
+    CLegRoast<alg> lrVerify;
+    ASSERT_TRUE(lrVerify.set_public_key(error, reinterpret_cast<const unsigned char*>(sPubKey.data()), sPubKey.size())) << error;
+    ASSERT_TRUE(lrVerify.set_signature(error, reinterpret_cast<const unsigned char*>(sSignature.data()), sSignature.size())) << error;
+    EXPECT_TRUE(lrVerify.verify(error, sMsg.c_str(), sMsg.length())) << error;
+}
+
+TEST(LegRoast, known_answer)
+{
+    test_known_answer<algorithm::Legendre_Fast>({
+        "f63ef75d4c4507f5df4a26922803af9c80aa34e487478c33c22f817ef7471621",
+        "3ea3799bf9072de579f23ed7b30d1459476a6bb08a8ba616f0cb24f1d8c6914e", 16480 });
+    test_known_answer<algorithm::Legendre_Middle>({
+        "f63ef75d4c4507f5df4a26922803af9c80aa34e487478c33c22f817ef7471621",
+        "5e715a8c4aa360f38d3a75a9feba3c348ebebc2226a2e542ad762ef1886cc5a1", 14272 });
+    test_known_answer<algorithm::Legendre_Compact>({
+        "f63ef75d4c4507f5df4a26922803af9c80aa34e487478c33c22f817ef7471621",
+        "0f4203b72a753884a07bff1e58e9ff4b48e787977a01ca6e0024fc65d5b4c266", 12544 });
+    test_known_answer<algorithm::Power_Fast>({
+        "a41d0995409e3fe076d4f71d668ca436c53c0d65af09ad86d7aa128d7e263a9c",
+        "d1bbebe888bd6913cf6bfff92b06819643a1ba1877b52255ad7a7dc303b1711b", 8800 });
+    test_known_answer<algorithm::Power_Middle>({
+        "a41d0995409e3fe076d4f71d668ca436c53c0d65af09ad86d7aa128d7e263a9c",
+        "ef0e061b2ce858bf7c20428ad1ed53d27a116b8e5b8c090ab8d9e98d44bda499", 7408 });
+    test_known_answer<algorithm::Power_Compact>({
+        "a41d0995409e3fe076d4f71d668ca436c53c0d65af09ad86d7aa128d7e263a9c",
+        "bb5b5a22f311ec9d839ef46647b0a95bd5ab205597da53608273bf568428c633", 6448 });
+}
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <random.h>
+#include <trimmean.h>
+#include <mnode/mnode-fee-stats.h>
+
+using namespace std;
+using namespace testing;
+
+constexpr CAmount DEFAULT_FEE = 50;
+
+// fees with default fee substituted for 0
+static vector<CAmount> GetEffectiveFees(const vector<CAmount>& vFees)
+{
+    vector<CAmount> v;
+    v.reserve(vFees.size());
+    for (const auto nFee : vFees)
+        v.push_back(nFee > 0 ? nFee : DEFAULT_FEE);
+    return v;
+}
+
+TEST(fee_stats, empty)
+{
+    CMasternodeFeeStats stats;
+    EXPECT_TRUE(stats.empty());
+    EXPECT_EQ(stats.GetMedian(DEFAULT_FEE), DEFAULT_FEE);
+    EXPECT_EQ(stats.GetMean(DEFAULT_FEE), DEFAULT_FEE);
+    EXPECT_TRUE(isnan(stats.GetTrimmedMean(0.25, DEFAULT_FEE)));
+}
+
+// fee stats should give the same results as the calculation over all fees after each update
+TEST(fee_stats, random_updates)
+{
+    CMasternodeFeeStats stats;
+    vector<CAmount> vFees;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        // fee in [0..100], 0 means default fee
+        const CAmount nFee = GetRandInt(4) == 0 ? 0 : GetRandInt(101);
+        if (vFees.empty() || GetRandInt(3) > 0)
+        {
+            stats.Add(nFee);
+            vFees.push_back(nFee);
+        } else {
+            const size_t nIndex = GetRandInt(static_cast<int>(vFees.size()));
+            if (GetRandInt(2))
+            {
+                stats.Update(vFees[nIndex], nFee);
+                vFees[nIndex] = nFee;
+            } else {
+                stats.Remove(vFees[nIndex]);
+                vFees.erase(vFees.begin() + nIndex);
+            }
+        }
+        ASSERT_EQ(stats.size(), vFees.size());
+        if (vFees.empty())
+            continue;
+
+        auto v = GetEffectiveFees(vFees);
+        EXPECT_DOUBLE_EQ(stats.GetTrimmedMean(0.25, DEFAULT_FEE), TRIMMEAN(v, 0.25));
+        CAmount nSum = 0;
+        for (const auto nEffectiveFee : v)
+            nSum += nEffectiveFee;
+        EXPECT_EQ(stats.GetMean(DEFAULT_FEE), nSum / static_cast<CAmount>(v.size()));
+        sort(v.begin(), v.end());
+        const size_t n = v.size();
+        const CAmount nExpectedMedian = (n % 2) ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+        EXPECT_EQ(stats.GetMedian(DEFAULT_FEE), nExpectedMedian);
+    }
+}
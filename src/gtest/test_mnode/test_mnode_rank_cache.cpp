@@ -0,0 +1,173 @@
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <random.h>
+#include <mnode/mnode-rank-cache.h>
+#include <mnode/mnode-manager.h>
+
+using namespace std;
+using namespace testing;
+
+using score_pair_vec_t = CMasternodeRankCache::score_pair_vec_t;
+using mn_rank_cache_entry_t = CMasternodeRankCache::mn_rank_cache_entry_t;
+
+// random masternode scores, small score range to get masternodes with the same score
+static score_pair_vec_t GetRandomScores(const size_t nCount)
+{
+    score_pair_vec_t vScores;
+    vScores.reserve(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+        vScores.emplace_back(arith_uint256(GetRandInt(10)), COutPoint(GetRandHash(), GetRandInt(3)));
+    return vScores;
+}
+
+// masternode scores sorted by rank: full sort by score, higher outpoint wins for the same score
+static score_pair_vec_t GetSortedScores(score_pair_vec_t vScores)
+{
+    sort(vScores.begin(), vScores.end(), [](const auto& t1, const auto& t2)
+        {
+            if (t1.first != t2.first)
+                return t1.first > t2.first;
+            return t2.second < t1.second;
+        });
+    return vScores;
+}
+
+// any sequence of top-N requests should give the same order as the full sort
+TEST(mnode_rank_cache, incremental_sort)
+{
+    constexpr size_t MN_COUNT = 50;
+    const uint256 blockHash = GetRandHash();
+    for (size_t nRound = 0; nRound < 20; ++nRound)
+    {
+        const auto vScores = GetRandomScores(MN_COUNT);
+        const auto vSortedScores = GetSortedScores(vScores);
+        CMasternodeRankCache cache;
+        size_t nCalculated = 0;
+        size_t nExpectedSortedCount = 0;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            // 0 - sort all scores, can request more scores than available
+            const size_t nTopCount = GetRandInt(4) == 0 ? 0 : 1 + GetRandInt(MN_COUNT + 5);
+            const auto pEntry = cache.Get(blockHash, 0, nTopCount, [&](mn_rank_cache_entry_t& entry)
+                {
+                    entry.vScores = vScores;
+                    ++nCalculated;
+                });
+            ASSERT_NE(pEntry, nullptr);
+            nExpectedSortedCount = max(nExpectedSortedCount, nTopCount ? min(nTopCount, MN_COUNT) : MN_COUNT);
+            ASSERT_EQ(pEntry->nSortedCount, nExpectedSortedCount) << "top count " << nTopCount;
+            ASSERT_EQ(pEntry->vScores.size(), MN_COUNT);
+            EXPECT_TRUE(equal(pEntry->vScores.cbegin(), pEntry->vScores.cbegin() + pEntry->nSortedCount, vSortedScores.cbegin()))
+                << "top count " << nTopCount;
+        }
+        // final scores are calculated only once
+        EXPECT_EQ(nCalculated, 1u);
+    }
+}
+
+// scores that can change are recalculated on each request
+TEST(mnode_rank_cache, not_final)
+{
+    const auto vScores = GetRandomScores(20);
+    const auto vSortedScores = GetSortedScores(vScores);
+    const uint256 blockHash = GetRandHash();
+    CMasternodeRankCache cache;
+    size_t nCalculated = 0;
+    for (const size_t nTopCount : { 0, 5 })
+    {
+        const auto pEntry = cache.Get(blockHash, 0, nTopCount, [&](mn_rank_cache_entry_t& entry)
+            {
+                entry.vScores = vScores;
+                entry.bFinal = false;
+                ++nCalculated;
+            });
+        ASSERT_NE(pEntry, nullptr);
+        // recalculated scores are sorted from scratch
+        EXPECT_EQ(pEntry->nSortedCount, nTopCount ? nTopCount : vScores.size());
+        EXPECT_TRUE(equal(pEntry->vScores.cbegin(), pEntry->vScores.cbegin() + pEntry->nSortedCount, vSortedScores.cbegin()));
+    }
+    EXPECT_EQ(nCalculated, 2u);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+// least recently used entry should be dropped when the cache is full
+TEST(mnode_rank_cache, lru)
+{
+    const auto vScores = GetRandomScores(5);
+    CMasternodeRankCache cache(3);
+    vector<uint256> vHashes;
+    for (size_t i = 0; i < 4; ++i)
+        vHashes.push_back(GetRandHash());
+    size_t nCalculated = 0;
+    const auto get = [&](const size_t nHashIndex, const int nMinProtocol = 0)
+    {
+        return cache.Get(vHashes[nHashIndex], nMinProtocol, 1, [&](mn_rank_cache_entry_t& entry)
+            {
+                entry.vScores = vScores;
+                ++nCalculated;
+            });
+    };
+    get(0); get(1); get(2);
+    EXPECT_EQ(nCalculated, 3u);
+    // move entry 0 to the front, entry 1 is the least recently used one now
+    get(0);
+    EXPECT_EQ(nCalculated, 3u);
+    get(3);
+    EXPECT_EQ(nCalculated, 4u);
+    EXPECT_EQ(cache.size(), 3u);
+    get(0); get(2); get(3);
+    EXPECT_EQ(nCalculated, 4u);
+    get(1);
+    EXPECT_EQ(nCalculated, 5u);
+    // entries are cached per block hash and min protocol version
+    get(1, 1);
+    EXPECT_EQ(nCalculated, 6u);
+
+    // no scores - nothing is cached
+    EXPECT_EQ(cache.Get(GetRandHash(), 0, 0, [](mn_rank_cache_entry_t&) {}), nullptr);
+    EXPECT_EQ(cache.size(), 3u);
+    cache.Clear();
+    EXPECT_TRUE(cache.empty());
+}
+
+class TestMasternodeRankCache : public Test
+{
+public:
+    static CMasternode CreateMasternode()
+    {
+        CMasternode mn;
+        mn.vin = CTxIn(COutPoint(GetRandHash(), 0));
+        return mn;
+    }
+
+    static void FillRankCache(CMasternodeMan& mnodeman)
+    {
+        mnodeman.m_RankCache.Get(GetRandHash(), 0, 0, [](mn_rank_cache_entry_t& entry)
+            {
+                entry.vScores = GetRandomScores(3);
+            });
+    }
+
+    static bool IsRankCacheEmpty(const CMasternodeMan& mnodeman) { return mnodeman.m_RankCache.empty(); }
+};
+
+// rank cache should be dropped on masternode list changes
+TEST_F(TestMasternodeRankCache, invalidate_on_list_change)
+{
+    CMasternodeMan mnodeman;
+    auto mn = CreateMasternode();
+    FillRankCache(mnodeman);
+    ASSERT_FALSE(IsRankCacheEmpty(mnodeman));
+    EXPECT_TRUE(mnodeman.Add(mn));
+    EXPECT_TRUE(IsRankCacheEmpty(mnodeman));
+
+    // masternode is already in the list - cache is kept
+    FillRankCache(mnodeman);
+    EXPECT_FALSE(mnodeman.Add(mn));
+    EXPECT_FALSE(IsRankCacheEmpty(mnodeman));
+
+    mnodeman.Clear();
+    EXPECT_TRUE(IsRankCacheEmpty(mnodeman));
+}
@@ -11,6 +11,7 @@
 #include <vector_types.h>
 #include <chainparams.h>
 #include <mnode/rpc/ingest.h>
+#include <mnode/rpc/mnode-rpc-utils.h>
 
 using namespace testing;
 using namespace std;
@@ -92,3 +93,39 @@ INSTANTIATE_TEST_SUITE_P(mnode_rpc_ani2psl, PTest_ani2psl_secret,
         }, true, true)
 	));
 
+
+TEST(mnode_rpc, extract_ticket_list_page)
+{
+    optional<ticket_list_page_t> page;
+    UniValue params(UniValue::VARR);
+    params.push_back("list");
+    params.push_back("nft");
+    params.push_back("all");
+
+    // no paging parameter
+    UniValue result = extract_ticket_list_page(params, 2, page);
+    EXPECT_FALSE(page.has_value());
+    EXPECT_EQ(result.size(), 3u);
+
+    // paging parameter as json string
+    const string sKey = "ticket-key";
+    params.push_back(strprintf(R"({"limit": 10, "continuation": "%s"})", HexStr(sKey)));
+    result = extract_ticket_list_page(params, 2, page);
+    ASSERT_TRUE(page.has_value());
+    EXPECT_EQ(result.size(), 3u);
+    EXPECT_EQ(page->nLimit, 10u);
+    EXPECT_EQ(page->sStartKey, sKey);
+
+    // invalid continuation token and limit
+    UniValue invalidParams(UniValue::VARR);
+    invalidParams.push_back("list");
+    invalidParams.push_back("nft");
+    invalidParams.push_back(R"({"continuation": "not hex"})");
+    EXPECT_THROW(extract_ticket_list_page(invalidParams, 2, page), UniValue);
+
+    // result for the last page has no continuation token
+    ticket_list_page_t lastPage;
+    const UniValue obj = ticket_list_page_to_json("[]", lastPage);
+    EXPECT_TRUE(obj["tickets"].isArray());
+    EXPECT_TRUE(find_value(obj, "continuation").isNull());
+}
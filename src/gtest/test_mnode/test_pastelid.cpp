@@ -7,6 +7,8 @@
 #include <scope_guard.hpp>
 
 #include <pastelid/pastel_key.h>
+#include <pastelid/pubkey_cache.h>
+#include <pastelid/pastelid_session.h>
 #include <fs.h>
 #include <util.h>
 #include <chainparams.h>
@@ -83,3 +85,159 @@ TEST(PastelID, GetStoredPastelIDs)
             EXPECT_EQ(it3->second, it2->second);
     }
 }
+
+TEST(PastelID, SigningSession)
+{
+    SelectParams(CBaseChainParams::Network::REGTEST);
+
+    gl_pPastelTestEnv->GenerateTempDataDir();
+    auto guard = sg::make_scope_guard([&]() noexcept 
+    {
+        pastelIDSessionStore.LockAll();
+        gl_pPastelTestEnv->ClearTempDataDir();
+    });
+
+    const auto PASS = "passphrase";
+    const auto mapIDs = CPastelID::CreateNewPastelKeys(PASS);
+    ASSERT_FALSE(mapIDs.empty());
+    const string sPastelID = mapIDs.cbegin()->first;
+    const string sText = "text to sign";
+
+    string error;
+    EXPECT_FALSE(CPastelID::Unlock(error, sPastelID, "wrong passphrase", 60));
+    EXPECT_TRUE(!error.empty());
+    EXPECT_EQ(pastelIDSessionStore.GetUnlockedUntil(sPastelID), 0);
+
+    EXPECT_FALSE(CPastelID::Unlock(error, sPastelID, PASS, 0));
+    // too large timeout overflows unlock time
+    EXPECT_FALSE(CPastelID::Unlock(error, sPastelID, PASS, MAX_PASTELID_UNLOCK_TIMEOUT + 1));
+    EXPECT_FALSE(CPastelID::Unlock(error, sPastelID, PASS, numeric_limits<int64_t>::max()));
+    EXPECT_EQ(pastelIDSessionStore.GetUnlockedUntil(sPastelID), 0);
+
+    ASSERT_TRUE(CPastelID::Unlock(error, sPastelID, PASS, 60)) << error;
+    EXPECT_GT(pastelIDSessionStore.GetUnlockedUntil(sPastelID), 0);
+    // sign using unlocked keys
+    for (const auto alg : { CPastelID::SIGN_ALGORITHM::ed448, CPastelID::SIGN_ALGORITHM::legroast })
+    {
+        const string sSignature = CPastelID::Sign(sText, sPastelID, PASS, alg, true);
+        EXPECT_TRUE(CPastelID::Verify(sText, sSignature, sPastelID, alg, true));
+    }
+    // wrong passphrase is not accepted by the session - falls back to the secure container
+    EXPECT_THROW(CPastelID::Sign(sText, sPastelID, "wrong passphrase"), runtime_error);
+
+    EXPECT_TRUE(CPastelID::Lock(sPastelID));
+    EXPECT_FALSE(CPastelID::Lock(sPastelID));
+    EXPECT_EQ(pastelIDSessionStore.GetUnlockedUntil(sPastelID), 0);
+    // sign using secure container
+    const string sSignature = CPastelID::Sign(sText, sPastelID, PASS, CPastelID::SIGN_ALGORITHM::ed448, true);
+    EXPECT_TRUE(CPastelID::Verify(sText, sSignature, sPastelID, CPastelID::SIGN_ALGORITHM::ed448, true));
+}
+
+TEST(PastelID, VerifyBatch)
+{
+    SelectParams(CBaseChainParams::Network::REGTEST);
+
+    gl_pPastelTestEnv->GenerateTempDataDir();
+    auto guard = sg::make_scope_guard([&]() noexcept 
+    {
+        pastelIDPubKeyCache.Clear();
+        gl_pPastelTestEnv->ClearTempDataDir();
+    });
+
+    const auto PASS = "passphrase";
+    const string sText = "text to sign";
+    const string sOtherText = "other text";
+    vector<CPastelID::verify_item_t> vItems;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const auto mapIDs = CPastelID::CreateNewPastelKeys(PASS);
+        ASSERT_FALSE(mapIDs.empty());
+        const string& sPastelID = mapIDs.cbegin()->first;
+        for (const auto alg : { CPastelID::SIGN_ALGORITHM::ed448, CPastelID::SIGN_ALGORITHM::legroast })
+        {
+            CPastelID::verify_item_t item;
+            item.psText = &sText;
+            item.sSignature = CPastelID::Sign(sText, sPastelID, PASS, alg, true);
+            item.sPastelID = sPastelID;
+            item.alg = alg;
+            item.fBase64 = true;
+            vItems.push_back(item);
+        }
+    }
+    // signature for the other text
+    vItems.push_back(vItems.front());
+    vItems.back().psText = &sOtherText;
+    // invalid PastelID
+    vItems.push_back(vItems.front());
+    vItems.back().sPastelID = "invalid";
+
+    v_strings vErrors;
+    // second pass uses cached public keys
+    for (size_t nPass = 0; nPass < 2; ++nPass)
+    {
+        const v_bools vResults = CPastelID::VerifyBatch(vItems, &vErrors);
+        ASSERT_EQ(vResults.size(), vItems.size());
+        ASSERT_EQ(vErrors.size(), vItems.size());
+        for (size_t i = 0; i < vItems.size() - 2; ++i)
+        {
+            EXPECT_TRUE(vResults[i]) << "item " << i << ": " << vErrors[i];
+            EXPECT_EQ(vResults[i], CPastelID::Verify(*vItems[i].psText, vItems[i].sSignature, vItems[i].sPastelID, vItems[i].alg, true));
+        }
+        EXPECT_FALSE(vResults[vItems.size() - 2]);
+        EXPECT_FALSE(vResults[vItems.size() - 1]);
+        EXPECT_EQ(pastelIDPubKeyCache.size(), 3u);
+    }
+}
+
+TEST(PastelID, PubKeyCache)
+{
+    CPastelIDPubKeyCache cache(2);
+    v_uint8 vKey;
+    EXPECT_FALSE(cache.GetLegRoastKey("id1", vKey));
+    cache.SetLegRoastKey("id1", {1});
+    cache.SetLegRoastKey("id2", {2});
+    // id1 becomes most recently used
+    EXPECT_TRUE(cache.GetLegRoastKey("id1", vKey));
+    EXPECT_EQ(vKey, v_uint8{1});
+    // evicts least recently used id2
+    cache.SetLegRoastKey("id3", {3});
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_FALSE(cache.GetLegRoastKey("id2", vKey));
+    EXPECT_TRUE(cache.GetLegRoastKey("id1", vKey));
+    EXPECT_TRUE(cache.GetLegRoastKey("id3", vKey));
+    EXPECT_EQ(cache.GetEd448Key("id1"), nullptr);
+
+    cache.ClearLegRoastKeys();
+    EXPECT_FALSE(cache.GetLegRoastKey("id1", vKey));
+    cache.Clear();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+// expired sessions are removed on the next session store access
+TEST(PastelID, SigningSessionExpired)
+{
+    const int64_t nNow = GetTime();
+    auto guard = sg::make_scope_guard([&]() noexcept 
+    {
+        SetMockTime(0);
+        pastelIDSessionStore.LockAll();
+    });
+    SetMockTime(nNow);
+    const SecureString PASS("passphrase");
+    pastelIDSessionStore.Unlock("id1", PASS, secure_key_t(32, 1), secure_key_t(32, 2), nNow + 10);
+    pastelIDSessionStore.Unlock("id2", PASS, secure_key_t(32, 3), secure_key_t(32, 4), nNow + 100);
+    secure_key_t vKey;
+    EXPECT_TRUE(pastelIDSessionStore.GetKey("id1", PASS, false, vKey));
+    EXPECT_EQ(vKey, secure_key_t(32, 1));
+
+    SetMockTime(nNow + 10);
+    // id1 session is removed by the access to id2 session
+    EXPECT_EQ(pastelIDSessionStore.GetUnlockedUntil("id2"), nNow + 100);
+    EXPECT_EQ(pastelIDSessionStore.PurgeExpired(), 0u);
+    EXPECT_FALSE(pastelIDSessionStore.GetKey("id1", PASS, false, vKey));
+    EXPECT_EQ(pastelIDSessionStore.GetUnlockedUntil("id1"), 0);
+
+    SetMockTime(nNow + 100);
+    EXPECT_EQ(pastelIDSessionStore.PurgeExpired(), 1u);
+    EXPECT_FALSE(pastelIDSessionStore.Lock("id2"));
+}
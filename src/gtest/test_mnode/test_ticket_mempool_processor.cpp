@@ -3,6 +3,7 @@
 #include <txmempool.h>
 #include <mnode/ticket-mempool-processor.h>
 #include <mnode/tickets/username-change.h>
+#include "test_mempool_entryhelper.h"
 #include "test_mnode/test_ticket_mempool.h"
 
 using namespace testing;
@@ -38,37 +39,27 @@ TEST_F(TestTktMemPoolProcessor, ticket_search)
     auto pMemPoolTracker = make_shared<MockTicketTxMemPoolTracker>();
     ASSERT_NE(pMemPoolTracker, nullptr);
 
-    v_uint256 vTxid_username, vTxid_pastelid;
-    vector<CMutableTransaction> vTx;
-    v_uints vBlockHeight;
+    TestMemPoolEntryHelper entry;
+    v_uint256 vTxid_pastelid;
     for (uint32_t i = 0; i < 10; ++i) {
         CMutableTransaction tx = CreateTicketTransaction(TicketID::Username, [&](CPastelTicket& tkt) {
             auto& userNameTicket = dynamic_cast<CChangeUsernameTicket&>(tkt);
             userNameTicket.username = to_string(i);
             userNameTicket.pastelID = strprintf("Pastel-ID-%u", i);
         });
-        vTx.push_back(tx);
-        vBlockHeight.emplace_back(100 + i);
-        vTxid_username.emplace_back(tx.GetHash());
+        // tickets are parsed and indexed by the tracker when transaction is added to the mempool
+        pMemPoolTracker->processTransaction(entry.Height(100 + i).FromTx(tx), false);
     }
+    // txids without parsed tickets
     pMemPoolTracker->Mock_AddTestData(TicketID::PastelID, 20, vTxid_pastelid);
-    pMemPoolTracker->Mock_AddTestTxids(TicketID::Username, vTxid_username);
 
-    Sequence s1;
     m_TicketID = TicketID::Username;
-    EXPECT_CALL(*pMemPoolTracker, getTicketTransactions(TicketID::Username, ::testing::_))
-        .WillOnce(DoAll(
-            SetArgReferee<1>(vTxid_username),
-            Return()));
-    EXPECT_CALL(txMemPool, batch_lookup)
-        .WillOnce(DoAll(
-                SetArgReferee<1>(vTx),
-                SetArgReferee<2>(vBlockHeight),
-                Return()
-            ));
+    // mempool transactions should not be re-parsed on initialization
+    EXPECT_CALL(txMemPool, batch_lookup).Times(0);
+    EXPECT_CALL(*pMemPoolTracker, getTicketTransactions).Times(0);
 
     EXPECT_NO_THROW(Initialize(txMemPool, pMemPoolTracker));
-    EXPECT_EQ(m_vTicket.size(), 10u);
+    EXPECT_EQ(pMemPoolTracker->Call_count(TicketID::Username), 10u);
 
     // FindTicket
     auto pTkt = CPastelTicketProcessor::CreateTicket(TicketID::Username);
@@ -77,6 +68,7 @@ TEST_F(TestTktMemPoolProcessor, ticket_search)
     userNameTkt.username = "5";
     EXPECT_TRUE(FindTicket(userNameTkt));
     EXPECT_EQ(userNameTkt.pastelID, "Pastel-ID-5");
+    EXPECT_EQ(userNameTkt.GetBlock(), 105u);
     
     userNameTkt.Clear();
     userNameTkt.username = "not_existing";
@@ -99,5 +91,23 @@ TEST_F(TestTktMemPoolProcessor, ticket_search)
     userNameTkt.Clear();
     userNameTkt.pastelID = "not_existing";
     EXPECT_FALSE(FindTicketBySecondaryKey(userNameTkt));
+
+    // ListTickets
+    PastelTickets_t vTicket;
+    EXPECT_TRUE(ListTickets(vTicket, "3"));
+    ASSERT_EQ(vTicket.size(), 1u);
+    EXPECT_EQ(dynamic_cast<CChangeUsernameTicket&>(*vTicket[0]).pastelID, "Pastel-ID-3");
+    vTicket.clear();
+    const string sKeyTwo("Pastel-ID-4");
+    EXPECT_FALSE(ListTickets(vTicket, "3", &sKeyTwo));
+    EXPECT_TRUE(vTicket.empty());
+
+    // removed transaction should be removed from the key indexes
+    const auto pTkt3 = pMemPoolTracker->findTicket(TicketID::Username, "3");
+    ASSERT_NE(pTkt3, nullptr);
+    pMemPoolTracker->removeTx(uint256S(pTkt3->GetTxId()));
+    EXPECT_FALSE(TicketExists("3"));
+    EXPECT_FALSE(TicketExistsBySecondaryKey("Pastel-ID-3"));
+    EXPECT_EQ(pMemPoolTracker->Call_count(TicketID::Username), 9u);
 }
 
@@ -3,10 +3,13 @@
 
 #include <pastel_gtest_main.h>
 #include <test_mnode/mock_ticket.h>
+#include <random.h>
 #include <mnode/ticket-processor.h>
+#include <mnode/ticket-validation-cache.h>
 
 using namespace std;
 using namespace testing;
+using namespace fs;
 using json = nlohmann::json;
 
 #ifdef ENABLE_MINING
@@ -116,3 +119,553 @@ INSTANTIATE_TEST_SUITE_P(ticket_processor, PTest_fuzzy_filter, Values(
     make_tuple(R"(-42)", "-43", false),
     make_tuple(R"(2.3)", "2.4", false)
 ));
+
+// test conversion of the legacy vector-based multi-value keys into composite keys
+TEST(ticket_processor, upgrade_mvkeys)
+{
+    path ph = temp_directory_path() / unique_path();
+    CDBWrapper db(ph, (1 << 20), true, false);
+
+    const v_strings vMainKeys = { "key1", "key2", "key3" };
+    const string sMVKey("mvkey");
+    EXPECT_TRUE(db.Write(CPastelTicketProcessor::RealMVKey(sMVKey), vMainKeys));
+    EXPECT_TRUE(db.Write(CPastelTicketProcessor::RealMVKey("other"), v_strings{ "key4" }));
+    EXPECT_TRUE(db.Write(string("key1"), string("ticket data")));
+
+    EXPECT_EQ(CPastelTicketProcessor::UpgradeDB_MVK(db), 2u);
+    EXPECT_FALSE(db.Exists(CPastelTicketProcessor::RealMVKey(sMVKey)));
+    EXPECT_FALSE(db.Exists(CPastelTicketProcessor::RealMVKey("other")));
+    for (const auto& sMainKey : vMainKeys)
+        EXPECT_TRUE(db.Exists(CPastelTicketProcessor::RealMVKey(sMVKey, sMainKey)));
+    EXPECT_TRUE(db.Exists(CPastelTicketProcessor::RealMVKey("other", "key4")));
+    EXPECT_FALSE(db.Exists(CPastelTicketProcessor::RealMVKey(sMVKey, "key4")));
+    EXPECT_TRUE(db.Exists(string("key1")));
+
+    // already upgraded DB - nothing to convert
+    EXPECT_EQ(CPastelTicketProcessor::UpgradeDB_MVK(db), 0u);
+}
+
+// test ticket block undo record serialization
+TEST(ticket_processor, block_undo_serialization)
+{
+    CTicketBlockUndo blockUndo;
+    blockUndo.hashBlock = GetRandHash();
+    CTicketUndo undo;
+    undo.nTicketID = to_integral_type<TicketID>(TicketID::Username);
+    undo.sKeyOne = "username";
+    undo.vPrevTicketData = { 1, 2, 3 };
+    undo.sKeyTwo = "pastelid";
+    undo.sPrevKeyOne = "prev_username";
+    undo.vNewMVKeys = { "mvkey1", "mvkey2" };
+    blockUndo.vTicketUndo.push_back(undo);
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << blockUndo;
+    CTicketBlockUndo blockUndo2;
+    ss >> blockUndo2;
+    EXPECT_EQ(blockUndo2.hashBlock, blockUndo.hashBlock);
+    ASSERT_EQ(blockUndo2.vTicketUndo.size(), 1u);
+    const auto& undo2 = blockUndo2.vTicketUndo[0];
+    EXPECT_EQ(undo2.nTicketID, undo.nTicketID);
+    EXPECT_EQ(undo2.sKeyOne, undo.sKeyOne);
+    EXPECT_EQ(undo2.vPrevTicketData, undo.vPrevTicketData);
+    EXPECT_EQ(undo2.sKeyTwo, undo.sKeyTwo);
+    EXPECT_EQ(undo2.sPrevKeyOne, undo.sPrevKeyOne);
+    EXPECT_EQ(undo2.vNewMVKeys, undo.vNewMVKeys);
+}
+
+// P2FMS scripts created by CreateP2FMSScripts should be parsed back without changes
+TEST(ticket_processor, p2fms_parse)
+{
+    for (const size_t nDataSize : { 1, 32, 99, 100, 1000, 65'537 })
+    {
+        CDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+        v_uint8 vData(nDataSize);
+        GetRandBytes(vData.data(), vData.size());
+        data_stream.write(reinterpret_cast<const char*>(vData.data()), vData.size());
+
+        vector<CScript> vOutScripts;
+        CPastelTicketProcessor::CreateP2FMSScripts(data_stream, vOutScripts);
+        ASSERT_FALSE(vOutScripts.empty());
+        CMutableTransaction mtx;
+        // non-multisig outputs should be skipped
+        mtx.vout.emplace_back(1, CScript() << OP_DUP << OP_HASH160 << v_uint8(20, 1) << OP_EQUALVERIFY << OP_CHECKSIG);
+        for (const auto& script : vOutScripts)
+            mtx.vout.emplace_back(1, script);
+        const CTransaction tx(mtx);
+
+        CSerializeData output_data;
+        string error;
+        ASSERT_TRUE(CPastelTicketProcessor::ParseP2FMSTransaction(tx, output_data, error)) << error;
+        EXPECT_TRUE(error.empty());
+        ASSERT_EQ(output_data.size(), nDataSize);
+        EXPECT_EQ(memcmp(output_data.data(), vData.data(), nDataSize), 0);
+
+        // corrupt first byte of the data (offset 40 in the second fake key of the first P2FMS script) - hash should not match
+        mtx.vout[1].scriptPubKey[1 + (1 + 33) + 1 + 7] ^= 0xFF;
+        EXPECT_FALSE(CPastelTicketProcessor::ParseP2FMSTransaction(CTransaction(mtx), output_data, error));
+        EXPECT_FALSE(error.empty());
+    }
+    // no multisig outputs
+    CMutableTransaction mtx;
+    mtx.vout.emplace_back(1, CScript() << OP_RETURN);
+    CSerializeData output_data;
+    string error;
+    EXPECT_FALSE(CPastelTicketProcessor::ParseP2FMSTransaction(CTransaction(mtx), output_data, error));
+    EXPECT_FALSE(error.empty());
+}
+
+// height index keys should be ordered by block height in the ticket DB
+TEST(ticket_processor, height_key_order)
+{
+    path ph = temp_directory_path() / unique_path();
+    CDBWrapper db(ph, (1 << 20), true, false);
+
+    const vector<pair<uint32_t, string>> vKeys = {
+        { 300, "a" }, { 2, "long primary key" }, { 70000, "b" }, { 2, "c" }, { 256, "d" } };
+    for (const auto& [nHeight, sKey] : vKeys)
+        EXPECT_TRUE(db.Write(CTicketHeightKey(nHeight, sKey), uint8_t(1)));
+    // ticket and multi-value keys should not be mixed with height index
+    EXPECT_TRUE(db.Write(string("ticket"), string("ticket data")));
+    EXPECT_TRUE(db.Write(CPastelTicketProcessor::RealMVKey("mvkey", "ticket"), uint8_t(1)));
+
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->Seek(CTicketHeightKey(3, ""));
+    vector<uint32_t> vHeights;
+    CTicketHeightKey key;
+    while (pcursor->Valid() && pcursor->GetKey(key) && key.IsValid())
+    {
+        vHeights.push_back(key.nHeight);
+        pcursor->Next();
+    }
+    EXPECT_EQ(vHeights, vector<uint32_t>({ 256, 300, 70000 }));
+}
+
+// test NFT search properties extraction from the app ticket
+TEST(ticket_processor, nft_search_props)
+{
+    const json jApp = {
+        { "creator_name", "Creator NAME" },
+        { "nft_title", "Some Title" },
+        { "nft_keyword_set", "Key1,KEY2" },
+        { "creator_written_statement", 42 },
+        { "thumbnail_hash", "ABCDEF" },
+        { "rareness_score", 500 }
+    };
+    CNFTSearchProps props;
+    props.Extract(jApp);
+    EXPECT_TRUE(props.bHasRarenessScore);
+    EXPECT_EQ(props.nRarenessScore, 500u);
+    EXPECT_FALSE(props.bHasNsfwScore);
+    // thumbnail hash is stored as is
+    EXPECT_EQ(props.sThumbnailHash, "ABCDEF");
+    // fuzzy search properties are lowercased
+    ASSERT_NE(props.GetFuzzyProp("creator_name"), nullptr);
+    EXPECT_EQ(*props.GetFuzzyProp("creator_name"), "creator name");
+    ASSERT_NE(props.GetFuzzyProp("nft_keyword_set"), nullptr);
+    EXPECT_EQ(*props.GetFuzzyProp("nft_keyword_set"), "key1,key2");
+    // not defined or not a string
+    EXPECT_EQ(props.GetFuzzyProp("nft_series_name"), nullptr);
+    EXPECT_EQ(props.GetFuzzyProp("creator_written_statement"), nullptr);
+    EXPECT_TRUE(CNFTSearchProps::IsFuzzyProp("nft_series_name"));
+    EXPECT_FALSE(CNFTSearchProps::IsFuzzyProp("thumbnail_hash"));
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << props;
+    CNFTSearchProps props2;
+    ss >> props2;
+    EXPECT_EQ(props2.nRarenessScore, props.nRarenessScore);
+    EXPECT_EQ(props2.sThumbnailHash, props.sThumbnailHash);
+    EXPECT_EQ(props2.vFuzzyProps, props.vFuzzyProps);
+}
+
+// substring of the fuzzy search property value should contain only trigrams of the value
+TEST(ticket_processor, nft_search_trigrams)
+{
+    CNFTSearchProps props;
+    props.Extract(json({ { "nft_title", "Sunset Beach" }, { "creator_name", "Al" } }));
+    const auto setTrigrams = props.GetTrigrams();
+    const int nTitleIndex = CNFTSearchProps::GetFuzzyPropIndex("nft_title");
+    ASSERT_GE(nTitleIndex, 0);
+    EXPECT_EQ(CNFTSearchProps::GetFuzzyPropIndex("thumbnail_hash"), -1);
+    // "sunset beach" - 10 unique trigrams, "al" is too short
+    EXPECT_EQ(setTrigrams.size(), 10u);
+
+    nft_trigram_set_t setFilter;
+    CNFTSearchProps::AddTrigrams(static_cast<uint8_t>(nTitleIndex), "set bea", setFilter);
+    for (const auto& trigram : setFilter)
+        EXPECT_TRUE(setTrigrams.count(trigram)) << trigram.second;
+    setFilter.clear();
+    CNFTSearchProps::AddTrigrams(static_cast<uint8_t>(nTitleIndex), "sunrise", setFilter);
+    EXPECT_FALSE(all_of(setFilter.cbegin(), setFilter.cend(), [&](const auto& trigram) { return setTrigrams.count(trigram) > 0; }));
+
+    // empty trigram is indexed for the fuzzy search properties without string value
+    const auto setIndexTrigrams = props.GetIndexTrigrams();
+    const int nSeriesIndex = CNFTSearchProps::GetFuzzyPropIndex("nft_series_name");
+    ASSERT_GE(nSeriesIndex, 0);
+    EXPECT_TRUE(setIndexTrigrams.count(make_pair(static_cast<uint8_t>(nSeriesIndex), string())));
+    EXPECT_FALSE(setIndexTrigrams.count(make_pair(static_cast<uint8_t>(nTitleIndex), string())));
+    // "al" is too short for trigrams but the property has string value
+    const int nCreatorIndex = CNFTSearchProps::GetFuzzyPropIndex("creator_name");
+    EXPECT_FALSE(setIndexTrigrams.count(make_pair(static_cast<uint8_t>(nCreatorIndex), string())));
+    // nft_series_name, nft_keyword_set, creator_written_statement are not defined
+    EXPECT_EQ(setIndexTrigrams.size(), setTrigrams.size() + 3);
+}
+
+// all NFT copy ownership keys of one NFT should be found by <"@O@", NFT registration txid> prefix
+TEST(ticket_processor, nft_ownership_key_prefix)
+{
+    path ph = temp_directory_path() / unique_path();
+    CDBWrapper db(ph, (1 << 20), true, false);
+
+    CNFTCopyOwner owner;
+    owner.sOwnerPastelID = "owner";
+    owner.sTradeTxId = "trade-txid";
+    owner.nHeight = 100;
+    for (const auto& sRegTxId : { "reg-a", "reg-b", "reg-bb" })
+    {
+        for (const auto& sSerial : { "1", "2", "10" })
+            EXPECT_TRUE(db.Write(CPastelTicketProcessor::NFTOwnershipKey(sRegTxId, sSerial), owner));
+    }
+    EXPECT_TRUE(db.Write(CPastelTicketProcessor::RealMVKey("reg-b", "ticket"), uint8_t(1)));
+
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->Seek(make_pair(string(NFT_OWNERSHIP_KEY_PREFIX), string("reg-b")));
+    nft_ownership_key_t key;
+    v_strings vSerials;
+    while (pcursor->Valid() && pcursor->GetKey(key) && (key.first == NFT_OWNERSHIP_KEY_PREFIX) && (key.second.first == "reg-b"))
+    {
+        CNFTCopyOwner owner2;
+        EXPECT_TRUE(pcursor->GetValue(owner2));
+        EXPECT_EQ(owner2.sOwnerPastelID, owner.sOwnerPastelID);
+        EXPECT_EQ(owner2.sTradeTxId, owner.sTradeTxId);
+        EXPECT_EQ(owner2.nHeight, owner.nHeight);
+        vSerials.push_back(key.second.second);
+        pcursor->Next();
+    }
+    EXPECT_EQ(vSerials.size(), 3u);
+}
+
+// ticket validation cache entries depend on ticket txid, height and validation depth
+TEST(ticket_processor, validation_cache)
+{
+    CTicketValidationCache cache;
+    const auto entry = cache.ComputeEntry("txid", 100, 0);
+    EXPECT_EQ(entry, cache.ComputeEntry("txid", 100, 0));
+    EXPECT_NE(entry, cache.ComputeEntry("txid", 101, 0));
+    EXPECT_NE(entry, cache.ComputeEntry("txid", 100, 1));
+    EXPECT_NE(entry, cache.ComputeEntry("txid2", 100, 0));
+    // entries are salted with the random nonce of the cache instance
+    CTicketValidationCache cache2;
+    EXPECT_NE(entry, cache2.ComputeEntry("txid", 100, 0));
+
+    EXPECT_FALSE(cache.Get(entry));
+    cache.Set(entry);
+    EXPECT_TRUE(cache.Get(entry));
+    EXPECT_EQ(cache.size(), 1u);
+    cache.Clear();
+    EXPECT_FALSE(cache.Get(entry));
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+// raw DB key or value - all remaining bytes of the stream
+typedef struct _raw_db_data_t
+{
+    v_uint8 vData;
+
+    template <typename Stream>
+    void Unserialize(Stream& s)
+    {
+        vData.resize(s.size());
+        if (!vData.empty())
+            s.read(reinterpret_cast<char*>(vData.data()), vData.size());
+    }
+} raw_db_data_t;
+
+class TestTicketProcessorUndo : 
+    public CPastelTicketProcessor,
+    public Test
+{
+public:
+    using db_dump_t = map<v_uint8, v_uint8>;
+
+    void SetUp() override
+    {
+        for (const auto id : { TicketID::Username, TicketID::Activate, TicketID::Trade })
+            dbs.emplace(id, make_unique<CDBWrapper>(temp_directory_path() / unique_path(), (1 << 20), true, false));
+        undoDB = make_unique<CDBWrapper>(temp_directory_path() / unique_path(), (1 << 20), true, false);
+    }
+
+    void ConnectTickets(const CBlockIndex* pindex, const PastelTickets_t& vTickets)
+    {
+        connectTickets(pindex, vTickets, true);
+    }
+    int GetTicketDBHeight() const noexcept { return nTicketDBHeight; }
+    CDBWrapper& GetTicketDB(const TicketID id) { return *dbs.at(id); }
+
+    // read all keys and values of the ticket DB
+    db_dump_t DumpDB(const TicketID id) const
+    {
+        db_dump_t dump;
+        unique_ptr<CDBIterator> pcursor(dbs.at(id)->NewIterator());
+        for (pcursor->SeekToFirst(); pcursor->Valid(); pcursor->Next())
+        {
+            raw_db_data_t key, value;
+            EXPECT_TRUE(pcursor->GetKey(key));
+            EXPECT_TRUE(pcursor->GetValue(value));
+            dump.emplace(move(key.vData), move(value.vData));
+        }
+        return dump;
+    }
+
+    static unique_ptr<CPastelTicket> CreateUsernameTicket(const string& sPastelID, const string& sUsername, const uint32_t nHeight)
+    {
+        auto ticket = make_unique<CChangeUsernameTicket>(sPastelID, sUsername);
+        ticket->SetTxId(GetRandHash().GetHex());
+        ticket->SetBlock(nHeight);
+        return ticket;
+    }
+
+    static unique_ptr<CPastelTicket> CreateActivateTicket(string&& sPastelID, string&& sRegTxId, const uint32_t nHeight)
+    {
+        auto ticket = make_unique<CNFTActivateTicket>(move(sPastelID));
+        ticket->SetKeyOne(move(sRegTxId));
+        ticket->SetTxId(GetRandHash().GetHex());
+        ticket->SetBlock(nHeight);
+        return ticket;
+    }
+
+    static unique_ptr<CNFTTradeTicket> CreateTradeTicket(string&& sPastelID, const string& sNFTTxnId, const string& sRegTxId,
+        const string& sCopySerialNr, const uint32_t nHeight)
+    {
+        auto ticket = make_unique<CNFTTradeTicket>(move(sPastelID));
+        ticket->sellTxnId = GetRandHash().GetHex();
+        ticket->buyTxnId = GetRandHash().GetHex();
+        ticket->NFTTxnId = sNFTTxnId;
+        ticket->SetNFTRegTicketTxid(sRegTxId);
+        ticket->SetCopySerialNr(sCopySerialNr);
+        ticket->SetTxId(GetRandHash().GetHex());
+        ticket->SetBlock(nHeight);
+        return ticket;
+    }
+};
+
+// disconnecting the block should restore ticket DBs to exactly the same state as before the block was connected
+TEST_F(TestTicketProcessorUndo, disconnect_block_restores_db)
+{
+    uint256 hash1 = GetRandHash(), hash2 = GetRandHash();
+    CBlockIndex index1, index2;
+    index1.phashBlock = &hash1;
+    index1.nHeight = 1;
+    index2.phashBlock = &hash2;
+    index2.nHeight = 2;
+    index2.pprev = &index1;
+
+    PastelTickets_t vTickets1;
+    vTickets1.emplace_back(CreateUsernameTicket("pastelid1", "alice", 1));
+    vTickets1.emplace_back(CreateActivateTicket("pastelid1", "regtxid1", 1));
+    ConnectTickets(&index1, vTickets1);
+
+    const auto usernameDump = DumpDB(TicketID::Username);
+    const auto activateDump = DumpDB(TicketID::Activate);
+    ASSERT_FALSE(usernameDump.empty());
+    ASSERT_FALSE(activateDump.empty());
+
+    PastelTickets_t vTickets2;
+    // overwrite ticket with the same primary key, new secondary key
+    vTickets2.emplace_back(CreateUsernameTicket("pastelid2", "alice", 2));
+    // new primary key, secondary key already points to another ticket
+    vTickets2.emplace_back(CreateUsernameTicket("pastelid1", "bob", 2));
+    // overwrite ticket with the same primary key, new multi-value key
+    vTickets2.emplace_back(CreateActivateTicket("pastelid2", "regtxid1", 2));
+    // new ticket with the existing multi-value keys
+    vTickets2.emplace_back(CreateActivateTicket("pastelid1", "regtxid2", 2));
+    ConnectTickets(&index2, vTickets2);
+    EXPECT_EQ(GetTicketDBHeight(), 2);
+    EXPECT_NE(DumpDB(TicketID::Username), usernameDump);
+    EXPECT_NE(DumpDB(TicketID::Activate), activateDump);
+
+    DisconnectBlock(&index2, CBlock());
+    EXPECT_EQ(GetTicketDBHeight(), 1);
+    EXPECT_EQ(DumpDB(TicketID::Username), usernameDump);
+    EXPECT_EQ(DumpDB(TicketID::Activate), activateDump);
+}
+
+// tickets listed by height should be paged by the primary key of the first ticket
+TEST_F(TestTicketProcessorUndo, list_tickets_by_height_paging)
+{
+    const vector<pair<int, v_strings>> vBlocks = {
+        { 1, { "alice", "bob" } },
+        { 2, { "dave", "carol" } },
+        { 3, { "eve" } } };
+    vector<uint256> vHashes(vBlocks.size());
+    vector<CBlockIndex> vIndex(vBlocks.size());
+    for (size_t i = 0; i < vBlocks.size(); ++i)
+    {
+        const auto& [nHeight, vUsernames] = vBlocks[i];
+        vHashes[i] = GetRandHash();
+        vIndex[i].phashBlock = &vHashes[i];
+        vIndex[i].nHeight = nHeight;
+        vIndex[i].pprev = i ? &vIndex[i - 1] : nullptr;
+        PastelTickets_t vTickets;
+        for (const auto& sUsername : vUsernames)
+            vTickets.emplace_back(CreateUsernameTicket("pastelid-" + sUsername, sUsername, nHeight));
+        ConnectTickets(&vIndex[i], vTickets);
+    }
+
+    // list one page, returns usernames in the page
+    const auto listPage = [&](const uint32_t nMinHeight, ticket_list_page_t& page) -> v_strings
+    {
+        v_strings vUsernames;
+        const json jTickets = json::parse(ListTicketsByHeight<CChangeUsernameTicket>(nMinHeight, &page));
+        for (const auto& jTicket : jTickets)
+            vUsernames.push_back(jTicket["ticket"]["username"]);
+        return vUsernames;
+    };
+
+    // page through all tickets from height 2 using continuation
+    ticket_list_page_t page;
+    page.nLimit = 2;
+    EXPECT_EQ(listPage(2, page), v_strings({ "carol", "dave" }));
+    EXPECT_EQ(page.sNextKey, "eve");
+    page.sStartKey = page.sNextKey;
+    EXPECT_EQ(listPage(2, page), v_strings({ "eve" }));
+    EXPECT_TRUE(page.sNextKey.empty());
+
+    // start from the primary key of the ticket in the middle of the block
+    page.sStartKey = "dave";
+    EXPECT_EQ(listPage(2, page), v_strings({ "dave", "eve" }));
+    EXPECT_TRUE(page.sNextKey.empty());
+    page.sStartKey = "bob";
+    EXPECT_EQ(listPage(1, page), v_strings({ "bob", "carol" }));
+    EXPECT_EQ(page.sNextKey, "dave");
+
+    // start ticket registered before min height - list from min height
+    page.sStartKey = "alice";
+    EXPECT_EQ(listPage(3, page), v_strings({ "eve" }));
+
+    // unknown start ticket - empty page
+    page.sStartKey = "unknown";
+    EXPECT_TRUE(listPage(1, page).empty());
+    EXPECT_TRUE(page.sNextKey.empty());
+}
+
+// NFT copy ownership index should follow trade tickets on connect and restore previous owner on disconnect
+TEST_F(TestTicketProcessorUndo, nft_ownership_connect_disconnect)
+{
+    uint256 hash1 = GetRandHash(), hash2 = GetRandHash();
+    CBlockIndex index1, index2;
+    index1.phashBlock = &hash1;
+    index1.nHeight = 1;
+    index2.phashBlock = &hash2;
+    index2.nHeight = 2;
+    index2.pprev = &index1;
+
+    const string sRegTxId = GetRandHash().GetHex();
+    const string sActTxId = GetRandHash().GetHex();
+    // first sale of the copies 1 and 2 - trade tickets refer to the activation ticket
+    PastelTickets_t vTickets1;
+    auto trade1 = CreateTradeTicket("owner1", sActTxId, sRegTxId, "1", 1);
+    const string sTrade1TxId = trade1->GetTxId();
+    vTickets1.emplace_back(move(trade1));
+    vTickets1.emplace_back(CreateTradeTicket("owner2", sActTxId, sRegTxId, "2", 1));
+    ConnectTickets(&index1, vTickets1);
+
+    map<string, CNFTCopyOwner> mapOwners;
+    ASSERT_EQ(GetNFTCopyOwners(sRegTxId, mapOwners), 2u);
+    EXPECT_EQ(mapOwners["1"].sOwnerPastelID, "owner1");
+    EXPECT_EQ(mapOwners["1"].sTradeTxId, sTrade1TxId);
+    EXPECT_EQ(mapOwners["1"].nHeight, 1u);
+    EXPECT_EQ(mapOwners["2"].sOwnerPastelID, "owner2");
+    auto regTradeTxIds = ValidateOwnership(sRegTxId, "owner1");
+    ASSERT_TRUE(regTradeTxIds.has_value());
+    EXPECT_EQ(get<0>(regTradeTxIds.value()), sRegTxId);
+    EXPECT_EQ(get<1>(regTradeTxIds.value()), sTrade1TxId);
+    EXPECT_FALSE(ValidateOwnership(sRegTxId, "owner3").has_value());
+
+    // resale of the copy 1 - trade ticket refers to the previous trade ticket
+    PastelTickets_t vTickets2;
+    auto trade2 = CreateTradeTicket("owner3", sTrade1TxId, sRegTxId, "1", 2);
+    const string sTrade2TxId = trade2->GetTxId();
+    vTickets2.emplace_back(move(trade2));
+    ConnectTickets(&index2, vTickets2);
+
+    ASSERT_EQ(GetNFTCopyOwners(sRegTxId, mapOwners), 2u);
+    EXPECT_EQ(mapOwners["1"].sOwnerPastelID, "owner3");
+    EXPECT_EQ(mapOwners["1"].sTradeTxId, sTrade2TxId);
+    EXPECT_EQ(mapOwners["2"].sOwnerPastelID, "owner2");
+    EXPECT_FALSE(ValidateOwnership(sRegTxId, "owner1").has_value());
+    regTradeTxIds = ValidateOwnership(sRegTxId, "owner3");
+    ASSERT_TRUE(regTradeTxIds.has_value());
+    EXPECT_EQ(get<1>(regTradeTxIds.value()), sTrade2TxId);
+
+    // previous owner of the copy 1 is restored from the trade ticket the reverted one refers to
+    DisconnectBlock(&index2, CBlock());
+    ASSERT_EQ(GetNFTCopyOwners(sRegTxId, mapOwners), 2u);
+    EXPECT_EQ(mapOwners["1"].sOwnerPastelID, "owner1");
+    EXPECT_EQ(mapOwners["1"].sTradeTxId, sTrade1TxId);
+    EXPECT_EQ(mapOwners["1"].nHeight, 1u);
+    EXPECT_TRUE(ValidateOwnership(sRegTxId, "owner1").has_value());
+    EXPECT_FALSE(ValidateOwnership(sRegTxId, "owner3").has_value());
+
+    // first sale is reverted - copies are not owned by anyone
+    DisconnectBlock(&index1, CBlock());
+    EXPECT_EQ(GetNFTCopyOwners(sRegTxId, mapOwners), 0u);
+    EXPECT_FALSE(ValidateOwnership(sRegTxId, "owner1").has_value());
+}
+
+// v4 NFT trade ticket DB upgrade should build ownership index from the last trade ticket of each copy
+TEST_F(TestTicketProcessorUndo, upgrade_nft_ownership)
+{
+    auto& db = GetTicketDB(TicketID::Trade);
+    const string sRegTxId = GetRandHash().GetHex();
+    const auto trade1 = CreateTradeTicket("owner1", GetRandHash().GetHex(), sRegTxId, "1", 10);
+    const auto trade2 = CreateTradeTicket("owner2", GetRandHash().GetHex(), sRegTxId, "2", 11);
+    const auto trade3 = CreateTradeTicket("owner3", trade1->GetTxId(), sRegTxId, "1", 12);
+    // v4 DB: tickets with secondary and multi-value keys, no ownership index
+    for (const auto pTicket : { trade3.get(), trade1.get(), trade2.get() })
+    {
+        EXPECT_TRUE(db.Write(pTicket->KeyOne(), *pTicket));
+        EXPECT_TRUE(db.Write(RealKeyTwo(pTicket->KeyTwo()), pTicket->KeyOne()));
+        EXPECT_TRUE(db.Write(RealMVKey(pTicket->MVKeyThree(), pTicket->KeyOne()), uint8_t(1)));
+    }
+    EXPECT_TRUE(db.Write(string(TICKET_DB_VERSION_KEY), uint32_t(4)));
+    map<string, CNFTCopyOwner> mapOwners;
+    EXPECT_EQ(GetNFTCopyOwners(sRegTxId, mapOwners), 0u);
+
+    EXPECT_EQ(UpgradeDB_NFTOwnership(db), 2u);
+    ASSERT_EQ(GetNFTCopyOwners(sRegTxId, mapOwners), 2u);
+    EXPECT_EQ(mapOwners["1"].sOwnerPastelID, "owner3");
+    EXPECT_EQ(mapOwners["1"].sTradeTxId, trade3->GetTxId());
+    EXPECT_EQ(mapOwners["1"].nHeight, 12u);
+    EXPECT_EQ(mapOwners["2"].sOwnerPastelID, "owner2");
+    EXPECT_EQ(mapOwners["2"].sTradeTxId, trade2->GetTxId());
+    EXPECT_TRUE(ValidateOwnership(sRegTxId, "owner3").has_value());
+    EXPECT_FALSE(ValidateOwnership(sRegTxId, "owner1").has_value());
+}
+
+// existing multi-value key can have an empty page of tickets
+TEST_F(TestTicketProcessorUndo, list_tickets_by_mvkey_paging)
+{
+    uint256 hash1 = GetRandHash();
+    CBlockIndex index1;
+    index1.phashBlock = &hash1;
+    index1.nHeight = 1;
+    PastelTickets_t vTickets;
+    vTickets.emplace_back(CreateActivateTicket("pastelid1", "regtxid1", 1));
+    vTickets.emplace_back(CreateActivateTicket("pastelid1", "regtxid2", 1));
+    ConnectTickets(&index1, vTickets);
+
+    EXPECT_TRUE(HasTicketsByMVKey(TicketID::Activate, "pastelid1"));
+    EXPECT_FALSE(HasTicketsByMVKey(TicketID::Activate, "pastelid2"));
+    EXPECT_FALSE(HasTicketsByMVKey(TicketID::Username, "pastelid1"));
+
+    ticket_list_page_t page;
+    page.nLimit = 1;
+    EXPECT_EQ(json::parse(ListTicketsByMVKey<CNFTActivateTicket>("pastelid1", &page)).size(), 1u);
+    EXPECT_EQ(page.sNextKey, "regtxid2");
+    // start after the last ticket - empty page
+    page.sStartKey = "regtxid3";
+    EXPECT_TRUE(json::parse(ListTicketsByMVKey<CNFTActivateTicket>("pastelid1", &page)).empty());
+    EXPECT_TRUE(page.sNextKey.empty());
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <random.h>
+#include <str_utils.h>
+#include <mnode/mnode-badwords.h>
+#include <mnode/tickets/username-change.h>
+
+using namespace std;
+using namespace testing;
+
+// bad words automaton should give the same result as a search for each word in the username
+TEST(username, bad_words_match)
+{
+    const auto& badWords = UsernameBadWords::Singleton();
+    constexpr auto ALPHABET = "abcdefghijklmnopqrstuvwxyz0123456789";
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        string sUsername;
+        const size_t nLength = 4 + GetRandInt(9);
+        for (size_t j = 0; j < nLength; ++j)
+            sUsername += ALPHABET[GetRandInt(36)];
+        bool bExpected = false;
+        for (const auto& sWord : badWords.wordSet)
+        {
+            if (sUsername.find(sWord) != string::npos)
+            {
+                bExpected = true;
+                break;
+            }
+        }
+        EXPECT_EQ(badWords.HasBadWord(sUsername), bExpected) << sUsername;
+    }
+    EXPECT_TRUE(badWords.HasBadWord("xxbitchxx"));
+    EXPECT_TRUE(badWords.HasBadWord("zubb"));
+    EXPECT_FALSE(badWords.HasBadWord("pastel2022"));
+}
+
+TEST(username, isUsernameBad)
+{
+    string error;
+    EXPECT_FALSE(CChangeUsernameTicket::isUsernameBad("Pastel2022", error)) << error;
+    EXPECT_TRUE(CChangeUsernameTicket::isUsernameBad("MyBiTcH1", error));
+    EXPECT_TRUE(CChangeUsernameTicket::isUsernameBad("1pastel", error));
+    EXPECT_TRUE(CChangeUsernameTicket::isUsernameBad("pas", error));
+    EXPECT_TRUE(CChangeUsernameTicket::isUsernameBad("pastel-2022", error));
+}
@@ -68,6 +68,9 @@
 
 //MasterNode
 #include "mnode/mnode-controller.h"
+#include "mnode/ticket-processor.h"
+#include "mnode/ticket-validation-cache.h"
+#include "pastelid/pastel_key.h"
 CMasterNodeController masterNodeCtrl;
 
 #include "librustzcash.h"
@@ -373,6 +376,8 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-datadir=<dir>", _("Specify data directory"));
     strUsage += HelpMessageOpt("-exportdir=<dir>", _("Specify directory to be used when exporting data"));
     strUsage += HelpMessageOpt("-dbcache=<n>", strprintf(_("Set database cache size in megabytes (%d to %d, default: %d)"), nMinDbCache, nMaxDbCache, nDefaultDbCache));
+    strUsage += HelpMessageOpt("-legroastthreads=<n>", strprintf(_("Set the number of threads used to process LegRoast signature rounds (1 to %u, default: %u)"),
+        MAX_LEGROAST_THREADS, DEFAULT_LEGROAST_THREADS));
     strUsage += HelpMessageOpt("-loadblock=<file>", _("Imports blocks from external blk000??.dat file") + " " + _("on startup"));
     strUsage += HelpMessageOpt("-maxorphantx=<n>", strprintf(_("Keep at most <n> unconnectable transactions in memory (default: %u)"), DEFAULT_MAX_ORPHAN_TRANSACTIONS));
     strUsage += HelpMessageOpt("-par=<n>", strprintf(_("Set the number of script verification threads (%u to %d, 0 = auto, <0 = leave that many cores free, default: %d)"),
@@ -384,9 +389,18 @@ std::string HelpMessage(HelpMessageMode mode)
             "Warning: Reverting this setting requires re-downloading the entire blockchain. "
             "(default: 0 = disable pruning blocks, >%u = target size in MiB to use for block files)"), MIN_DISK_SPACE_FOR_BLOCK_FILES / 1024 / 1024));
     strUsage += HelpMessageOpt("-reindex", _("Rebuild block chain index from current blk000??.dat files on startup"));
+    strUsage += HelpMessageOpt("-reindextickets", _("Rebuild ticket databases from the blocks of the active chain on startup"));
 #if !defined(WIN32)
     strUsage += HelpMessageOpt("-sysperms", _("Create new files with system default permissions, instead of umask 077 (only effective with disabled wallet functionality)"));
 #endif
+    strUsage += HelpMessageOpt("-ticketcompressor=<n>", strprintf(_("Compressor version used for new tickets: %hhu - zstd, %hhu - zstd with ticket dictionary, decodable by updated nodes only (default: %hhu)"),
+        CCompressedDataStream::COMPRESSOR_VERSION, CCompressedDataStream::COMPRESSOR_VERSION_DICT, DEFAULT_TICKET_COMPRESSOR_VERSION));
+    strUsage += HelpMessageOpt("-ticketcompresslatency=<n>", strprintf(_("Ticket compression latency budget in ms, compression level is selected by ticket size to fit into it (0 = always use max level, default: %u)"),
+        DEFAULT_TICKET_COMPRESS_LATENCY_MS));
+    strUsage += HelpMessageOpt("-ticketreindexthreads=<n>", strprintf(_("Set the number of threads used to rebuild ticket databases (%u to %d, 0 = auto, <0 = leave that many cores free, default: %d)"),
+        -GetNumCores(), MAX_TICKET_REINDEX_THREADS, DEFAULT_TICKET_REINDEX_THREADS));
+    strUsage += HelpMessageOpt("-topmnhistory=<n>", strprintf(_("Number of last blocks to keep the top masternodes history for (default: %u)"),
+        DEFAULT_TOP_MN_HISTORY_BLOCKS));
     strUsage += HelpMessageOpt("-txindex", strprintf(_("Maintain a full transaction index, used by the getrawtransaction rpc call (default: %u)"), 0));
 
     strUsage += HelpMessageGroup(_("Connection options:"));
@@ -489,6 +503,7 @@ std::string HelpMessage(HelpMessageMode mode)
         strUsage += HelpMessageOpt("-limitfreerelay=<n>", strprintf("Continuously rate-limit free transactions to <n>*1000 bytes per minute (default: %u)", 15));
         strUsage += HelpMessageOpt("-relaypriority", strprintf("Require high priority for relaying free or low-fee transactions (default: %u)", 0));
         strUsage += HelpMessageOpt("-maxsigcachesize=<n>", strprintf("Limit size of signature cache to <n> MiB (default: %u)", DEFAULT_MAX_SIG_CACHE_SIZE));
+        strUsage += HelpMessageOpt("-maxticketvalidationcachesize=<n>", strprintf("Limit size of ticket validation cache to <n> MiB (default: %u)", DEFAULT_MAX_TICKET_VALIDATION_CACHE_SIZE));
         strUsage += HelpMessageOpt("-maxtipage=<n>", strprintf("Maximum tip age in seconds to consider node in initial block download (default: %u)", DEFAULT_MAX_TIP_AGE));
     }
     strUsage += HelpMessageOpt("-minrelaytxfee=<amt>", strprintf(_("Fees (in %s/kB) smaller than this are considered zero fee for relaying (default: %s)"),
@@ -1095,6 +1110,15 @@ bool AppInit2(boost::thread_group& threadGroup, CScheduler& scheduler)
     if (expiryDelta < minExpiryDelta) {
         return InitError(strprintf(_("Invalid value for -expiryDelta='%u' (must be least %u)"), expiryDelta, minExpiryDelta));
     }
+    const int64_t nTicketCompressorVersion = GetArg("-ticketcompressor", DEFAULT_TICKET_COMPRESSOR_VERSION);
+    if ((nTicketCompressorVersion != CCompressedDataStream::COMPRESSOR_VERSION) &&
+        (nTicketCompressorVersion != CCompressedDataStream::COMPRESSOR_VERSION_DICT))
+        return InitError(strprintf(_("Invalid value for -ticketcompressor='%d' (must be %hhu or %hhu)"), nTicketCompressorVersion,
+            CCompressedDataStream::COMPRESSOR_VERSION, CCompressedDataStream::COMPRESSOR_VERSION_DICT));
+    const int64_t nTicketCompressLatency = GetArg("-ticketcompresslatency", DEFAULT_TICKET_COMPRESS_LATENCY_MS);
+    if ((nTicketCompressLatency < 0) || (nTicketCompressLatency > numeric_limits<uint32_t>::max()))
+        return InitError(strprintf(_("Invalid value for -ticketcompresslatency='%d' (must be in range 0..%u ms)"), nTicketCompressLatency,
+            numeric_limits<uint32_t>::max()));
     bSpendZeroConfChange = GetBoolArg("-spendzeroconfchange", true);
     fSendFreeTransactions = GetBoolArg("-sendfreetransactions", false);
 
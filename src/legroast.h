@@ -13,6 +13,10 @@
 #include <stdint.h>
 #include <memory>
 #include <array>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <functional>
 #include <openssl/rand.h>
 #include <openssl/evp.h>
 
@@ -114,6 +118,28 @@ inline static constexpr auto GetLegRoastParams(const algorithm alg)
     return LEGROAST_PARAMS[to_index(alg)];
 }
 
+/**
+ * Get LegRoast algorithm name.
+ * 
+ * \param alg - LegRoast algorithm
+ * \return algorithm name
+ */
+inline const char* GetLegRoastAlgorithmName(const algorithm alg) noexcept
+{
+    switch (alg)
+    {
+        case algorithm::Legendre_Fast:      return "legendre_fast";
+        case algorithm::Legendre_Middle:    return "legendre_middle";
+        case algorithm::Legendre_Compact:   return "legendre_compact";
+        case algorithm::Power_Fast:         return "power_fast";
+        case algorithm::Power_Middle:       return "power_middle";
+        case algorithm::Power_Compact:      return "power_compact";
+        default:
+            break;
+    }
+    return "unknown";
+}
+
 template <algorithm alg>
 struct prover_state_t
 {
@@ -133,59 +159,215 @@ struct prover_state_t
     }
 };
 
+/**
+ * Field arithmetic mod p = 2^127 - 1.
+ * Values are kept in a lazily reduced form: any 128-bit value is a valid input,
+ * intermediate results are only folded (2^127 = 1 mod p) and not fully reduced.
+ * reduce_mod_p returns canonical value in [0, p) and must be called
+ * before the value is hashed, written to the signature or compared.
+ * All functions are branchless (constant-time).
+ */
+
+// number of independent exponentiation chains evaluated together by the residuosity symbol functions
+constexpr size_t FIELD_LANES = 4;
+
+// fold 128-bit value into [0, 2^127], the result is congruent to a mod p
+inline uint128_t fold_mod_p(const uint128_t a) noexcept
+{
+    return (a & m127) + (a >> 127);
+}
+
 inline void reduce_mod_p(uint128_t* pa) noexcept
 {
-    while (*pa >= m127)
-        *pa -= m127;
+    const uint128_t a = fold_mod_p(*pa);
+    // a <= 2^127, subtract p once if a >= p
+    const uint128_t mask = 0 - static_cast<uint128_t>(a >= m127);
+    *pa = a - (m127 & mask);
 }
 
 inline void add_mod_p(uint128_t* pa, const uint128_t b) noexcept
 {
-    *pa += b;
-    if (*pa < b)
-    {
-        reduce_mod_p(pa);
-        *pa += 2;
-    }
+    const uint128_t s = *pa + b;
+    // 2^128 = 2 mod p: add 2 for the lost carry
+    const uint128_t carry = s < b;
+    *pa = fold_mod_p(s) + (carry << 1);
 }
 
-inline void square_mod_p(uint128_t* out, uint128_t* a)  noexcept
+/**
+ * Sum 3 partial products mod p.
+ * Result is not reduced: <= 2^127 + 4.
+ */
+inline uint128_t sum3_mod_p(const uint128_t a, const uint128_t b, const uint128_t c) noexcept
 {
-    reduce_mod_p(a); // TODO: can we remove/avoid this?
+    uint128_t s = a + b;
+    uint128_t carry = s < b;
+    s += c;
+    carry += s < c;
+    return fold_mod_p(s) + (carry << 1);
+}
 
-    uint128_t lowa = *((uint64_t*)a);
-    uint128_t higha = *((uint64_t*)a + 1);
+/**
+ * Multiply two field elements.
+ * Inputs are folded into [0, 2^127], so high 64-bit halves are <= 2^63
+ * and partial products do not overflow.
+ */
+inline uint128_t mul_mod_p(const uint128_t a, const uint128_t b) noexcept
+{
+    const uint128_t fa = fold_mod_p(a);
+    const uint128_t fb = fold_mod_p(b);
+    const uint128_t lowa = static_cast<uint64_t>(fa);
+    const uint128_t lowb = static_cast<uint64_t>(fb);
+    const uint128_t higha = fa >> 64;
+    const uint128_t highb = fb >> 64;
+
+    const uint128_t out0 = lowa * lowb;
+    const uint128_t out64 = (lowa * highb) + (lowb * higha);
+    // 2^128 = 2 mod p
+    const uint128_t out127 = (higha * highb + (out64 >> 64)) << 1;
+
+    return sum3_mod_p(out0, out127, out64 << 64);
+}
 
-    *out = lowa * lowa;
-    uint128_t out64 = (lowa * higha) << 1;
-    uint128_t out127 = (higha * higha + (out64 >> 64)) << 1;
+inline uint128_t square_mod_p(const uint128_t a) noexcept
+{
+    const uint128_t fa = fold_mod_p(a);
+    const uint128_t lowa = static_cast<uint64_t>(fa);
+    const uint128_t higha = fa >> 64;
 
-    out64 <<= 64;
+    const uint128_t out0 = lowa * lowa;
+    const uint128_t out64 = (lowa * higha) << 1;
+    const uint128_t out127 = (higha * higha + (out64 >> 64)) << 1;
 
-    add_mod_p(out, out127);
-    add_mod_p(out, out64);
+    return sum3_mod_p(out0, out127, out64 << 64);
 }
 
-inline void mul_add_mod_p(uint128_t* out, uint128_t* a, uint128_t* b) noexcept
+inline void square_mod_p(uint128_t* out, const uint128_t* a) noexcept
 {
-    reduce_mod_p(a); // TODO: can we remove/avoid this?
-    reduce_mod_p(b);
-
-    uint128_t lowa = (*a) % (((uint128_t)1) << 64);
-    uint128_t lowb = (*b) % (((uint128_t)1) << 64);
-    uint128_t higha = (*a) >> 64;
-    uint128_t highb = (*b) >> 64;
+    *out = square_mod_p(*a);
+}
 
-    uint128_t out0 = lowa * lowb;
-    uint128_t out64 = (lowa * highb) + (lowb * higha);
-    uint128_t out127 = (higha * highb + (out64 >> 64)) << 1;
+inline void mul_add_mod_p(uint128_t* out, const uint128_t* a, const uint128_t* b) noexcept
+{
+    add_mod_p(out, mul_mod_p(*a, *b));
+}
 
-    out64 <<= 64;
+// 254-th roots of unity mod p (little-endian 64-bit halves), index is the power residue symbol
+constexpr size_t POWER_RESIDUE_ROOTS_COUNT = 254;
+constexpr uint64_t POWER_RESIDUE_ROOTS[2 * POWER_RESIDUE_ROOTS_COUNT] = {
+    1U, 0U, 18446726481523507199U, 9223372036854775807U, 0U, 16777216U,
+    18446744073709551583U, 9223372036854775807U, 562949953421312U, 0U, 18446744073709551615U, 9223372036317904895U,
+    1024U, 0U, 18428729675200069631U, 9223372036854775807U, 0U, 17179869184U,
+    18446744073709518847U, 9223372036854775807U, 576460752303423488U, 0U, 18446744073709551615U, 9223371487098961919U,
+    1048576U, 0U, 18446744073709551615U, 9223372036854775806U, 0U, 17592186044416U,
+    18446744073675997183U, 9223372036854775807U, 0U, 32U, 18446744073709551615U, 9222809086901354495U,
+    1073741824U, 0U, 18446744073709551615U, 9223372036854774783U, 0U, 18014398509481984U,
+    18446744039349813247U, 9223372036854775807U, 0U, 32768U, 18446744073709551615U, 8646911284551352319U,
+    1099511627776U, 0U, 18446744073709551615U, 9223372036853727231U, 2U, 0U,
+    18446708889337462783U, 9223372036854775807U, 0U, 33554432U, 18446744073709551551U, 9223372036854775807U,
+    1125899906842624U, 0U, 18446744073709551615U, 9223372035781033983U, 2048U, 0U,
+    18410715276690587647U, 9223372036854775807U, 0U, 34359738368U, 18446744073709486079U, 9223372036854775807U,
+    1152921504606846976U, 0U, 18446744073709551615U, 9223370937343148031U, 2097152U, 0U,
+    18446744073709551615U, 9223372036854775805U, 0U, 35184372088832U, 18446744073642442751U, 9223372036854775807U,
+    0U, 64U, 18446744073709551615U, 9222246136947933183U, 2147483648U, 0U,
+    18446744073709551615U, 9223372036854773759U, 0U, 36028797018963968U, 18446744004990074879U, 9223372036854775807U,
+    0U, 65536U, 18446744073709551615U, 8070450532247928831U, 2199023255552U, 0U,
+    18446744073709551615U, 9223372036852678655U, 4U, 0U, 18446673704965373951U, 9223372036854775807U,
+    0U, 67108864U, 18446744073709551487U, 9223372036854775807U, 2251799813685248U, 0U,
+    18446744073709551615U, 9223372034707292159U, 4096U, 0U, 18374686479671623679U, 9223372036854775807U,
+    0U, 68719476736U, 18446744073709420543U, 9223372036854775807U, 2305843009213693952U, 0U,
+    18446744073709551615U, 9223369837831520255U, 4194304U, 0U, 18446744073709551615U, 9223372036854775803U,
+    0U, 70368744177664U, 18446744073575333887U, 9223372036854775807U, 0U, 128U,
+    18446744073709551615U, 9221120237041090559U, 4294967296U, 0U, 18446744073709551615U, 9223372036854771711U,
+    0U, 72057594037927936U, 18446743936270598143U, 9223372036854775807U, 0U, 131072U,
+    18446744073709551615U, 6917529027641081855U, 4398046511104U, 0U, 18446744073709551615U, 9223372036850581503U,
+    8U, 0U, 18446603336221196287U, 9223372036854775807U, 0U, 134217728U,
+    18446744073709551359U, 9223372036854775807U, 4503599627370496U, 0U, 18446744073709551615U, 9223372032559808511U,
+    8192U, 0U, 18302628885633695743U, 9223372036854775807U, 0U, 137438953472U,
+    18446744073709289471U, 9223372036854775807U, 4611686018427387904U, 0U, 18446744073709551615U, 9223367638808264703U,
+    8388608U, 0U, 18446744073709551615U, 9223372036854775799U, 0U, 140737488355328U,
+    18446744073441116159U, 9223372036854775807U, 0U, 256U, 18446744073709551615U, 9218868437227405311U,
+    8589934592U, 0U, 18446744073709551615U, 9223372036854767615U, 0U, 144115188075855872U,
+    18446743798831644671U, 9223372036854775807U, 0U, 262144U, 18446744073709551615U, 4611686018427387903U,
+    8796093022208U, 0U, 18446744073709551615U, 9223372036846387199U, 16U, 0U,
+    18446462598732840959U, 9223372036854775807U, 0U, 268435456U, 18446744073709551103U, 9223372036854775807U,
+    9007199254740992U, 0U, 18446744073709551615U, 9223372028264841215U, 16384U, 0U,
+    18158513697557839871U, 9223372036854775807U, 0U, 274877906944U, 18446744073709027327U, 9223372036854775807U,
+    9223372036854775808U, 0U, 18446744073709551615U, 9223363240761753599U, 16777216U, 0U,
+    18446744073709551615U, 9223372036854775791U, 0U, 281474976710656U, 18446744073172680703U, 9223372036854775807U,
+    0U, 512U, 18446744073709551615U, 9214364837600034815U, 17179869184U, 0U,
+    18446744073709551615U, 9223372036854759423U, 0U, 288230376151711744U, 18446743523953737727U, 9223372036854775807U,
+    0U, 524288U, 18446744073709551614U, 9223372036854775807U, 17592186044416U, 0U,
+    18446744073709551615U, 9223372036837998591U, 32U, 0U, 18446181123756130303U, 9223372036854775807U,
+    0U, 536870912U, 18446744073709550591U, 9223372036854775807U, 18014398509481984U, 0U,
+    18446744073709551615U, 9223372019674906623U, 32768U, 0U, 17870283321406128127U, 9223372036854775807U,
+    0U, 549755813888U, 18446744073708503039U, 9223372036854775807U, 0U, 1U,
+    18446744073709551615U, 9223354444668731391U, 33554432U, 0U, 18446744073709551615U, 9223372036854775775U,
+    0U, 562949953421312U, 18446744072635809791U, 9223372036854775807U, 0U, 1024U,
+    18446744073709551615U, 9205357638345293823U, 34359738368U, 0U, 18446744073709551615U, 9223372036854743039U,
+    0U, 576460752303423488U, 18446742974197923839U, 9223372036854775807U, 0U, 1048576U,
+    18446744073709551613U, 9223372036854775807U, 35184372088832U, 0U, 18446744073709551615U, 9223372036821221375U,
+    64U, 0U, 18445618173802708991U, 9223372036854775807U, 0U, 1073741824U,
+    18446744073709549567U, 9223372036854775807U, 36028797018963968U, 0U, 18446744073709551615U, 9223372002495037439U,
+    65536U, 0U, 17293822569102704639U, 9223372036854775807U, 0U, 1099511627776U,
+    18446744073707454463U, 9223372036854775807U, 0U, 2U, 18446744073709551615U, 9223336852482686975U,
+    67108864U, 0U, 18446744073709551615U, 9223372036854775743U, 0U, 1125899906842624U,
+    18446744071562067967U, 9223372036854775807U, 0U, 2048U, 18446744073709551615U, 9187343239835811839U,
+    68719476736U, 0U, 18446744073709551615U, 9223372036854710271U, 0U, 1152921504606846976U,
+    18446741874686296063U, 9223372036854775807U, 0U, 2097152U, 18446744073709551611U, 9223372036854775807U,
+    70368744177664U, 0U, 18446744073709551615U, 9223372036787666943U, 128U, 0U,
+    18444492273895866367U, 9223372036854775807U, 0U, 2147483648U, 18446744073709547519U, 9223372036854775807U,
+    72057594037927936U, 0U, 18446744073709551615U, 9223371968135299071U, 131072U, 0U,
+    16140901064495857663U, 9223372036854775807U, 0U, 2199023255552U, 18446744073705357311U, 9223372036854775807U,
+    0U, 4U, 18446744073709551615U, 9223301668110598143U, 134217728U, 0U,
+    18446744073709551615U, 9223372036854775679U, 0U, 2251799813685248U, 18446744069414584319U, 9223372036854775807U,
+    0U, 4096U, 18446744073709551615U, 9151314442816847871U, 137438953472U, 0U,
+    18446744073709551615U, 9223372036854644735U, 0U, 2305843009213693952U, 18446739675663040511U, 9223372036854775807U,
+    0U, 4194304U, 18446744073709551607U, 9223372036854775807U, 140737488355328U, 0U,
+    18446744073709551615U, 9223372036720558079U, 256U, 0U, 18442240474082181119U, 9223372036854775807U,
+    0U, 4294967296U, 18446744073709543423U, 9223372036854775807U, 144115188075855872U, 0U,
+    18446744073709551615U, 9223371899415822335U, 262144U, 0U, 13835058055282163711U, 9223372036854775807U,
+    0U, 4398046511104U, 18446744073701163007U, 9223372036854775807U, 0U, 8U,
+    18446744073709551615U, 9223231299366420479U, 268435456U, 0U, 18446744073709551615U, 9223372036854775551U,
+    0U, 4503599627370496U, 18446744065119617023U, 9223372036854775807U, 0U, 8192U,
+    18446744073709551615U, 9079256848778919935U, 274877906944U, 0U, 18446744073709551615U, 9223372036854513663U,
+    0U, 4611686018427387904U, 18446735277616529407U, 9223372036854775807U, 0U, 8388608U,
+    18446744073709551599U, 9223372036854775807U, 281474976710656U, 0U, 18446744073709551615U, 9223372036586340351U,
+    512U, 0U, 18437736874454810623U, 9223372036854775807U, 0U, 8589934592U,
+    18446744073709535231U, 9223372036854775807U, 288230376151711744U, 0U, 18446744073709551615U, 9223371761976868863U,
+    524288U, 0U, 9223372036854775807U, 9223372036854775807U, 0U, 8796093022208U,
+    18446744073692774399U, 9223372036854775807U, 0U, 16U, 18446744073709551615U, 9223090561878065151U,
+    536870912U, 0U, 18446744073709551615U, 9223372036854775295U, 0U, 9007199254740992U,
+    18446744056529682431U, 9223372036854775807U, 0U, 16384U, 18446744073709551615U, 8935141660703064063U,
+    549755813888U, 0U, 18446744073709551615U, 9223372036854251519U
+};
 
-    add_mod_p(out, out0);
-    add_mod_p(out, out127);
-    add_mod_p(out, out64);
-    //TODO optimize if necessary ?
+/**
+ * Get power residue symbol by the 254-th root of unity.
+ * Uses the roots table sorted by value (built once) instead of the linear scan.
+ * 
+ * \param root - 254-th root of unity, reduced mod p
+ * \return index of the root in POWER_RESIDUE_ROOTS or 0 if not found
+ */
+inline unsigned char power_residue_index(const uint128_t root) noexcept
+{
+    using root_index_t = std::pair<uint128_t, unsigned char>;
+    static const auto SORTED_ROOTS = []()
+    {
+        std::array<root_index_t, POWER_RESIDUE_ROOTS_COUNT> roots;
+        for (size_t i = 0; i < POWER_RESIDUE_ROOTS_COUNT; ++i)
+        {
+            const uint128_t lo = POWER_RESIDUE_ROOTS[2 * i];
+            const uint128_t hi = POWER_RESIDUE_ROOTS[2 * i + 1];
+            roots[i] = std::make_pair(lo | (hi << 64), static_cast<unsigned char>(i));
+        }
+        std::sort(roots.begin(), roots.end());
+        return roots;
+    }();
+    const auto it = std::lower_bound(SORTED_ROOTS.cbegin(), SORTED_ROOTS.cend(), root,
+        [](const root_index_t& r, const uint128_t v) { return r.first < v; });
+    if (it == SORTED_ROOTS.cend() || it->first != root)
+        return 0; // oops
+    return it->second;
 }
 
 template <algorithm alg>
@@ -208,9 +390,43 @@ public:
             free(m_pSignature);
         if (m_pMDcontext)
             EVP_MD_CTX_free(m_pMDcontext);
+        free_worker_contexts();
     }
     inline static constexpr LegRoastParams Params() { return GetLegRoastParams(alg); }
 
+    // parallel for executor: calls fn(i) for all i in [0, nCount), returns when all calls are finished
+    using parallel_for_t = std::function<void(const size_t nCount, const std::function<void(const size_t)>& fn)>;
+
+    /**
+     * Set number of threads used to process signature rounds in parallel (sign & verify).
+     * Rounds are independent and each round writes only its own part of the transcript,
+     * so the signature is byte-identical to the one produced in serial mode.
+     * CLegRoast does not create threads - rounds are split into nThreads parts
+     * processed by the executor (for example, persistent thread pool).
+     * 
+     * \param nThreads - number of parts to split rounds into, 0 or 1 - serial mode
+     * \param fnParallelFor - executor used to process the parts, serial mode if not defined
+     */
+    void set_threads(const uint32_t nThreads, parallel_for_t fnParallelFor = nullptr) noexcept
+    {
+        free_worker_contexts();
+        m_nThreads = 1;
+        m_fnParallelFor = std::move(fnParallelFor);
+        if (!m_fnParallelFor)
+            return;
+        // each part needs its own message digest context
+        for (uint32_t i = 1; i < std::min(nThreads, Params().nRounds); ++i)
+        {
+            EVP_MD_CTX* pCtx = EVP_MD_CTX_new();
+            if (!pCtx)
+                break;
+            m_vWorkerMDcontexts.push_back(pCtx);
+            ++m_nThreads;
+        }
+    }
+
+    uint32_t get_threads() const noexcept { return m_nThreads; }
+
     /**
     * Generate private/public key pair.
     */
@@ -224,21 +440,33 @@ public:
         memset(m_pk, 0, PK_BYTES);
         if constexpr (m_bLegendre)
         {
+            // one byte of the public key - 8 Legendre symbols
             #pragma omp for
-            for (uint32_t i = 0; i < PK_BYTES * 8; ++i)
+            for (uint32_t i = 0; i < PK_BYTES; ++i)
             {
-                uint128_t temp = compute_index(i);
-                add_mod_p(&temp, key);
-                m_pk[i / 8] |= legendre_symbol_ct(&temp) << (i % 8);
+                uint128_t temp[8];
+                unsigned char symbols[8];
+                for (uint32_t j = 0; j < 8; ++j)
+                {
+                    temp[j] = compute_index(m_pMDcontext, i * 8 + j);
+                    add_mod_p(&temp[j], key);
+                }
+                legendre_symbols_ct(temp, symbols, 8);
+                for (uint32_t j = 0; j < 8; ++j)
+                    m_pk[i] |= symbols[j] << j;
             }
         }
         else
         {
-            for (uint32_t i = 0; i < PK_BYTES; ++i)
+            uint128_t temp[FIELD_LANES];
+            for (uint32_t i = 0; i < PK_BYTES; i += FIELD_LANES)
             {
-                uint128_t temp = compute_index(i);
-                add_mod_p(&temp, key);
-                m_pk[i] = power_residue_symbol(&temp);
+                for (uint32_t j = 0; j < FIELD_LANES; ++j)
+                {
+                    temp[j] = compute_index(m_pMDcontext, i + j);
+                    add_mod_p(&temp[j], key);
+                }
+                power_residue_symbols(temp, m_pk + i, FIELD_LANES);
             }
         }
     }
@@ -530,6 +758,45 @@ private:
     size_t m_nSignatureLength{0};
     std::unique_ptr<prover_state_t<alg>> m_prover_state;
     EVP_MD_CTX* m_pMDcontext; // openssl Message Digest Context (EVP)
+    uint32_t m_nThreads{1};   // number of threads used to process rounds
+    parallel_for_t m_fnParallelFor; // executor used to process rounds in parallel
+    std::vector<EVP_MD_CTX*> m_vWorkerMDcontexts; // message digest contexts for the worker threads
+
+    void free_worker_contexts() noexcept
+    {
+        for (auto pCtx : m_vWorkerMDcontexts)
+            EVP_MD_CTX_free(pCtx);
+        m_vWorkerMDcontexts.clear();
+    }
+
+    /**
+     * Call fn(pCtx, nRound) for all signature rounds.
+     * In parallel mode rounds are statically distributed between m_nThreads parts processed by the executor:
+     * part t processes rounds t, t + m_nThreads, ...
+     * fn should modify only data of the given round.
+     * 
+     * \param fn - round function, pCtx - message digest context to use for the current part
+     */
+    template <typename _RoundFunc>
+    void for_each_round(_RoundFunc&& fn)
+    {
+        const uint32_t nThreads = m_nThreads;
+        auto fnProcessRounds = [&](EVP_MD_CTX* pCtx, const uint32_t nFirstRound)
+        {
+            for (uint32_t nRound = nFirstRound; nRound < Params().nRounds; nRound += nThreads)
+                fn(pCtx, nRound);
+        };
+        if ((nThreads <= 1) || !m_fnParallelFor)
+        {
+            fnProcessRounds(m_pMDcontext, 0);
+            return;
+        }
+        // each part uses its own message digest context
+        m_fnParallelFor(nThreads, [&](const size_t t)
+        {
+            fnProcessRounds(t ? m_vWorkerMDcontexts[t - 1] : m_pMDcontext, static_cast<uint32_t>(t));
+        });
+    }
 
     /**
      * Allocate memory for the signature.
@@ -549,9 +816,12 @@ private:
 
     void compute_indices(const uint32_t* a, uint128_t* indices) noexcept
     {
-        #pragma omp for
-        for (uint32_t i = 0; i < Params().RESSYM_PER_ROUND; ++i)
-            indices[i] = compute_index(a[i]);
+        for_each_round([&](EVP_MD_CTX* pCtx, const uint32_t nRound)
+        {
+            const uint32_t nStart = nRound * Params().nResiduosity_Symbols_Per_Round;
+            for (uint32_t i = nStart; i < nStart + Params().nResiduosity_Symbols_Per_Round; ++i)
+                indices[i] = compute_index(pCtx, a[i]);
+        });
     }
 
     void commit(unsigned char* message1)
@@ -563,25 +833,27 @@ private:
         sample_mod_p(m_sk, &key);
 
         unsigned char commitments[Params().nRounds * Params().PARTIES * HASH_BYTES + Params().RESSYM_PER_ROUND];
+        // pick root seeds (in the round order, not in the worker threads)
         for (uint32_t nRound = 0; nRound < Params().nRounds; ++nRound)
+            RAND_bytes(m_prover_state->seed_trees[nRound], SEED_BYTES);
+
+        for_each_round([&](EVP_MD_CTX* pCtx, const uint32_t nRound)
         {
             auto& pSeedTrees = m_prover_state->seed_trees[nRound];
             auto& pShares = m_prover_state->shares[nRound];
             auto& pSums = m_prover_state->sums[nRound];
-            // pick root seed
-            RAND_bytes(pSeedTrees, SEED_BYTES);
 
             // generate seeds
-            generate_seed_tree(pSeedTrees);
+            generate_seed_tree(pCtx, pSeedTrees);
 
             // generate the commitments and the shares
             for (uint32_t i = 0; i < Params().PARTIES; ++i) {
                 const auto nIndex = (Params().PARTIES - 1 + i) * SEED_BYTES;
                 // commit to seed
-                LR_HASH(&pSeedTrees[nIndex], SEED_BYTES, commitments + nRound * Params().PARTIES * HASH_BYTES + i * HASH_BYTES);
+                LR_HASH(pCtx, &pSeedTrees[nIndex], SEED_BYTES, commitments + nRound * Params().PARTIES * HASH_BYTES + i * HASH_BYTES);
 
                 // generate shares from seed
-                LR_EXPAND(&pSeedTrees[nIndex], SEED_BYTES, (unsigned char*)(pShares[i]), sizeof(pShares[i]));
+                LR_EXPAND(pCtx, &pSeedTrees[nIndex], SEED_BYTES, (unsigned char*)(pShares[i]), sizeof(pShares[i]));
 
                 // add the shares to the sums
                 for (uint32_t j = 0; j < Params().SHARES_PER_PARTY; ++j)
@@ -594,13 +866,11 @@ private:
 
             // compute legendre symbols of R_i
             const auto nIndexBase = Params().nRounds * Params().PARTIES * HASH_BYTES;
-            for (uint32_t i = 0; i < Params().nResiduosity_Symbols_Per_Round; ++i)
-            {
-                if constexpr (m_bLegendre)
-                    commitments[nIndexBase + nRound * Params().nResiduosity_Symbols_Per_Round + i] = legendre_symbol_ct(&pSums[SHARES_R + i]);
-                else
-                    commitments[nIndexBase + nRound * Params().nResiduosity_Symbols_Per_Round + i] = power_residue_symbol(&pSums[SHARES_R + i]);
-            }
+            unsigned char* pSymbols = commitments + nIndexBase + nRound * Params().nResiduosity_Symbols_Per_Round;
+            if constexpr (m_bLegendre)
+                legendre_symbols_ct(&pSums[SHARES_R], pSymbols, Params().nResiduosity_Symbols_Per_Round);
+            else
+                power_residue_symbols(&pSums[SHARES_R], pSymbols, Params().nResiduosity_Symbols_Per_Round);
 
             // compute Delta K and add to share 0
             uint128_t* delta_k = (uint128_t*)(message1 + MESSAGE1_DELTA_K) + nRound;
@@ -615,7 +885,7 @@ private:
             mul_add_mod_p(delta_triple, &pSums[SHARES_TRIPLE], &pSums[SHARES_TRIPLE + 1]);
             reduce_mod_p(delta_triple);
             add_mod_p(&pShares[0][SHARES_TRIPLE + 2], *delta_triple);
-        }
+        });
 
         LR_HASH(commitments, sizeof(commitments), message1);
     }
@@ -676,7 +946,7 @@ private:
         uint128_t openings[Params().nRounds][Params().PARTIES][3] = {0};
         const uint32_t* indices = (uint32_t*)challenge1;
 
-        for (uint32_t nRound = 0; nRound < Params().nRounds; ++nRound)
+        for_each_round([&](EVP_MD_CTX*, const uint32_t nRound)
         {
             auto& pSums = m_prover_state->sums[nRound];
             auto& pShares = m_prover_state->shares[nRound];
@@ -714,21 +984,20 @@ private:
                 *p1 = pShares[i][SHARES_TRIPLE + 1];
                 for (uint32_t j = 0; j < Params().nResiduosity_Symbols_Per_Round; ++j)
                 {
+                    uint128_t temp2 = mul_mod_p(pShares[i][SHARES_R + j], lambda[j]);
+
                     // share of beta
-                    mul_add_mod_p(p1, &pShares[i][SHARES_R + j], lambda + j);
-                    reduce_mod_p(p1);
+                    add_mod_p(p1, temp2);
 
                     // share of z
-                    uint128_t temp2 = 0;
-                    mul_add_mod_p(&temp2, &pShares[i][SHARES_R + j], lambda + j); // this multiplication is done earlier, reuse result
                     reduce_mod_p(&temp2);
                     temp2 = m127 - temp2;
-                    uint128_t index = m_prover_state->indices[nRound * Params().nResiduosity_Symbols_Per_Round + j];
-                    mul_add_mod_p(&z_share, &temp2, &index);
+                    mul_add_mod_p(&z_share, &temp2, &m_prover_state->indices[nRound * Params().nResiduosity_Symbols_Per_Round + j]);
 
                     if (i == 0)
                         mul_add_mod_p(&z_share, lambda + j, ((uint128_t*)(message2)) + nRound * Params().nResiduosity_Symbols_Per_Round + j);
                 }
+                reduce_mod_p(p1);
 
                 // compute sharing of v
                 auto p2 = &(pOpenings[i][2]);
@@ -742,7 +1011,7 @@ private:
                 mul_add_mod_p(p2, epsilon, &z_share);
                 reduce_mod_p(p2);
             }
-        }
+        });
 
         LR_HASH((unsigned char*)openings, sizeof(openings), message3);
     }
@@ -790,11 +1059,11 @@ private:
                 error = strprintf("Failed to allocate memory [%zu bytes] for signature verification", nBufSize);
                 break;
             }
-            for (uint32_t nRound = 0; nRound < Params().nRounds; ++nRound)
+            for_each_round([&](EVP_MD_CTX* pCtx, const uint32_t nRound)
             {
                 auto& pSeedTrees = m_prover_state->seed_trees[nRound];
                 auto& pShares = m_prover_state->shares[nRound];
-                fill_down(pSeedTrees, unopened_party[nRound], message4 + nRound * Params().nPartyDepth * SEED_BYTES);
+                fill_down(pCtx, pSeedTrees, unopened_party[nRound], message4 + nRound * Params().nPartyDepth * SEED_BYTES);
 
                 //copy the commitment of the unopened value
                 memcpy(pBuf + nRound * Params().PARTIES * HASH_BYTES + unopened_party[nRound] * HASH_BYTES, message4 + Params().MESSAGE4_COMMITMENT + nRound * HASH_BYTES, HASH_BYTES);
@@ -806,10 +1075,10 @@ private:
                         continue;
 
                     // commit to seed
-                    LR_HASH(&pSeedTrees[(Params().PARTIES - 1 + i) * SEED_BYTES], SEED_BYTES, pBuf + nRound * Params().PARTIES * HASH_BYTES + i * HASH_BYTES);
+                    LR_HASH(pCtx, &pSeedTrees[(Params().PARTIES - 1 + i) * SEED_BYTES], SEED_BYTES, pBuf + nRound * Params().PARTIES * HASH_BYTES + i * HASH_BYTES);
 
                     // generate shares from seed (and Delta's)
-                    LR_EXPAND(&pSeedTrees[(Params().PARTIES - 1 + i) * SEED_BYTES], SEED_BYTES, (unsigned char*)(pShares[i]), sizeof(pShares[i]));
+                    LR_EXPAND(pCtx, &pSeedTrees[(Params().PARTIES - 1 + i) * SEED_BYTES], SEED_BYTES, (unsigned char*)(pShares[i]), sizeof(pShares[i]));
                     if (i == 0)
                     {
                         add_mod_p(&pShares[i][SHARE_K], *(((uint128_t*)(message1 + MESSAGE1_DELTA_K)) + nRound));
@@ -821,20 +1090,25 @@ private:
                 const auto nBaseIndex = Params().nRounds * Params().PARTIES * HASH_BYTES + nRound * Params().nResiduosity_Symbols_Per_Round;
                 const auto nMsgBaseIndex = nRound * Params().nResiduosity_Symbols_Per_Round;
                 auto pBufPtr = pBuf + nBaseIndex;
+                const uint128_t* pOutput = reinterpret_cast<const uint128_t*>(message2) + nMsgBaseIndex;
+                if constexpr (m_bLegendre)
+                    legendre_symbols_ct(pOutput, pBufPtr, Params().nResiduosity_Symbols_Per_Round);
+                else
+                    power_residue_symbols(pOutput, pBufPtr, Params().nResiduosity_Symbols_Per_Round);
                 for (uint32_t i = 0; i < Params().nResiduosity_Symbols_Per_Round; ++i)
                 {
                     if constexpr (m_bLegendre)
-                        *pBufPtr = legendre_symbol_ct((uint128_t*)(message2) + nMsgBaseIndex + i) ^ getBit(((uint32_t*)challenge1)[nMsgBaseIndex + i]);
+                        *pBufPtr ^= getBit(((uint32_t*)challenge1)[nMsgBaseIndex + i]);
                     else
                     {
-                        uint16_t prs = power_residue_symbol((uint128_t*)(message2) + nMsgBaseIndex + i);
+                        uint16_t prs = *pBufPtr;
                         prs += ((uint16_t)254) - (uint16_t)m_pk[((uint32_t*)challenge1)[nMsgBaseIndex + i]];
                         prs %= 254;
                         *pBufPtr = static_cast<unsigned char>(prs);
                     }
                     ++pBufPtr;
                 }
-            }
+            });
 
             unsigned char hash1[HASH_BYTES];
             LR_HASH(pBuf, nBufSize, hash1);
@@ -847,7 +1121,7 @@ private:
             // check second commitment: alpha, beta and v
             uint128_t openings[Params().nRounds][Params().PARTIES][3] = {0};
 
-            for (uint32_t nRound = 0; nRound < Params().nRounds; ++nRound)
+            for_each_round([&](EVP_MD_CTX*, const uint32_t nRound)
             {
                 auto& pShares = m_prover_state->shares[nRound];
 
@@ -882,16 +1156,15 @@ private:
                     *p1 = pShares[i][SHARES_TRIPLE + 1];
                     for (uint32_t j = 0; j < Params().nResiduosity_Symbols_Per_Round; ++j)
                     {
+                        uint128_t temp2 = mul_mod_p(pShares[i][SHARES_R + j], lambda[j]);
+
                         // share of beta
-                        mul_add_mod_p(p1, &pShares[i][SHARES_R + j], lambda + j);
+                        add_mod_p(p1, temp2);
 
                         // share of z
-                        uint128_t temp2 = 0;
-                        mul_add_mod_p(&temp2, &pShares[i][SHARES_R + j], lambda + j); // this multiplication is done earlier, reuse result
                         reduce_mod_p(&temp2);
                         temp2 = m127 - temp2;
-                        uint128_t index = m_prover_state->indices[nSymPerRound + j];
-                        mul_add_mod_p(&z_share, &temp2, &index);
+                        mul_add_mod_p(&z_share, &temp2, &m_prover_state->indices[nSymPerRound + j]);
 
                         if (i == 0)
                             mul_add_mod_p(&z_share, lambda + j, ((uint128_t*)(message2)) + nSymPerRound + j);
@@ -927,7 +1200,7 @@ private:
                 reduce_mod_p(&pRound[0]);
                 reduce_mod_p(&pRound[1]);
                 reduce_mod_p(&pRound[2]);
-            }
+            });
 
             unsigned char hash2[HASH_BYTES];
             LR_HASH((unsigned char*)openings, sizeof(openings), hash2);
@@ -950,167 +1223,109 @@ private:
         reduce_mod_p(out);
     }
 
-    uint128_t compute_index(const uint32_t a) noexcept
+    static uint128_t compute_index(EVP_MD_CTX* pCtx, const uint32_t a) noexcept
     {
         uint128_t out = 0;
-        LR_EXPAND((unsigned char*)&a, sizeof(a), (unsigned char*)&out, sizeof(uint128_t));
+        LR_EXPAND(pCtx, (unsigned char*)&a, sizeof(a), (unsigned char*)&out, sizeof(uint128_t));
         return out;
     }
 
-    static unsigned char legendre_symbol_ct(uint128_t* a) noexcept
+    /**
+     * Compute Legendre symbols (a^((p-1)/2)) for n field elements.
+     * Exponentiation chains are evaluated for FIELD_LANES elements at once,
+     * independent multiplications of the different lanes can be executed in parallel by CPU.
+     * 
+     * \param in - field elements
+     * \param out - Legendre symbols (0 or 1)
+     * \param n - number of elements
+     */
+    static void legendre_symbols_ct(const uint128_t* in, unsigned char* out, const size_t n) noexcept
     {
-        uint128_t out = *a;
-        uint128_t temp, temp2;
-
-        square_mod_p(&temp, &out);
-        out = 0;
-        mul_add_mod_p(&out, &temp, a);
-        square_mod_p(&temp, &out);
-        out = 0;
-        mul_add_mod_p(&out, &temp, a);
-        square_mod_p(&temp, &out);
-        out = 0;
-        mul_add_mod_p(&out, &temp, a);
-        square_mod_p(&temp, &out);
-        out = 0;
-        mul_add_mod_p(&out, &temp, a);
-        square_mod_p(&temp, &out);
-        out = 0;
-        mul_add_mod_p(&out, &temp, a);
-        temp2 = out;
-
-        for (int i = 0; i < 20; ++i)
+        uint128_t a[FIELD_LANES], x[FIELD_LANES], a63[FIELD_LANES];
+        for (size_t nStart = 0; nStart < n; nStart += FIELD_LANES)
         {
-            square_mod_p(&temp, &out);
-            square_mod_p(&temp, &temp);
-            square_mod_p(&temp, &temp);
-            square_mod_p(&temp, &temp);
-            square_mod_p(&temp, &temp);
-            square_mod_p(&temp, &temp);
-
-            out = 0;
-            mul_add_mod_p(&out, &temp, &temp2);
+            const size_t nLanes = std::min(FIELD_LANES, n - nStart);
+            // unused lanes duplicate the first one to keep the loops fixed-size
+            for (size_t l = 0; l < FIELD_LANES; ++l)
+                a[l] = x[l] = in[nStart + (l < nLanes ? l : 0)];
+
+            // a^63
+            for (int i = 0; i < 5; ++i)
+            {
+                for (size_t l = 0; l < FIELD_LANES; ++l)
+                    x[l] = mul_mod_p(square_mod_p(x[l]), a[l]);
+            }
+            for (size_t l = 0; l < FIELD_LANES; ++l)
+                a63[l] = x[l];
+
+            for (int i = 0; i < 20; ++i)
+            {
+                for (int j = 0; j < 6; ++j)
+                {
+                    for (size_t l = 0; l < FIELD_LANES; ++l)
+                        x[l] = square_mod_p(x[l]);
+                }
+                for (size_t l = 0; l < FIELD_LANES; ++l)
+                    x[l] = mul_mod_p(x[l], a63[l]);
+            }
+
+            for (size_t l = 0; l < nLanes; ++l)
+            {
+                reduce_mod_p(&x[l]);
+                out[nStart + l] = static_cast<unsigned char>((-x[l] + 1) / 2);
+            }
         }
+    }
 
-        reduce_mod_p(&out);
-        return (-out + 1) / 2;
+    static unsigned char legendre_symbol_ct(const uint128_t* a) noexcept
+    {
+        unsigned char symbol;
+        legendre_symbols_ct(a, &symbol, 1);
+        return symbol;
     }
 
-    static unsigned char power_residue_symbol(uint128_t* a)
+    /**
+     * Compute power residue symbols (discrete log of a^((p-1)/254)) for n field elements.
+     * Exponentiation chains are interleaved the same way as in legendre_symbols_ct.
+     * 
+     * \param in - field elements
+     * \param out - power residue symbols [0..253]
+     * \param n - number of elements
+     */
+    static void power_residue_symbols(const uint128_t* in, unsigned char* out, const size_t n) noexcept
     {
-        uint128_t out = *a;
-        uint128_t temp;
-        for (int i = 0; i < 17; ++i)
-        {
-            // square 7 times and multiply by a
-            square_mod_p(&temp, &out);
-            square_mod_p(&out, &temp);
-            square_mod_p(&temp, &out);
-            square_mod_p(&out, &temp);
-            square_mod_p(&temp, &out);
-            square_mod_p(&out, &temp);
-            square_mod_p(&temp, &out);
-            out = 0;
-            mul_add_mod_p(&out, &temp, a);
-        }
-        reduce_mod_p(&out);
-
-        static constexpr uint64_t list[2 * 254] = {
-            1U, 0U, 18446726481523507199U, 9223372036854775807U, 0U, 16777216U, 
-            18446744073709551583U, 9223372036854775807U, 562949953421312U, 0U, 18446744073709551615U, 9223372036317904895U, 
-            1024U, 0U, 18428729675200069631U, 9223372036854775807U, 0U, 17179869184U, 
-            18446744073709518847U, 9223372036854775807U, 576460752303423488U, 0U, 18446744073709551615U, 9223371487098961919U,
-            1048576U, 0U, 18446744073709551615U, 9223372036854775806U, 0U, 17592186044416U, 
-            18446744073675997183U, 9223372036854775807U, 0U, 32U, 18446744073709551615U, 9222809086901354495U, 
-            1073741824U, 0U, 18446744073709551615U, 9223372036854774783U, 0U, 18014398509481984U, 
-            18446744039349813247U, 9223372036854775807U, 0U, 32768U, 18446744073709551615U, 8646911284551352319U, 
-            1099511627776U, 0U, 18446744073709551615U, 9223372036853727231U, 2U, 0U, 
-            18446708889337462783U, 9223372036854775807U, 0U, 33554432U, 18446744073709551551U, 9223372036854775807U, 
-            1125899906842624U, 0U, 18446744073709551615U, 9223372035781033983U, 2048U, 0U, 
-            18410715276690587647U, 9223372036854775807U, 0U, 34359738368U, 18446744073709486079U, 9223372036854775807U, 
-            1152921504606846976U, 0U, 18446744073709551615U, 9223370937343148031U, 2097152U, 0U, 
-            18446744073709551615U, 9223372036854775805U, 0U, 35184372088832U, 18446744073642442751U, 9223372036854775807U, 
-            0U, 64U, 18446744073709551615U, 9222246136947933183U, 2147483648U, 0U, 
-            18446744073709551615U, 9223372036854773759U, 0U, 36028797018963968U, 18446744004990074879U, 9223372036854775807U, 
-            0U, 65536U, 18446744073709551615U, 8070450532247928831U, 2199023255552U, 0U, 
-            18446744073709551615U, 9223372036852678655U, 4U, 0U, 18446673704965373951U, 9223372036854775807U, 
-            0U, 67108864U, 18446744073709551487U, 9223372036854775807U, 2251799813685248U, 0U, 
-            18446744073709551615U, 9223372034707292159U, 4096U, 0U, 18374686479671623679U, 9223372036854775807U, 
-            0U, 68719476736U, 18446744073709420543U, 9223372036854775807U, 2305843009213693952U, 0U, 
-            18446744073709551615U, 9223369837831520255U, 4194304U, 0U, 18446744073709551615U, 9223372036854775803U, 
-            0U, 70368744177664U, 18446744073575333887U, 9223372036854775807U, 0U, 128U, 
-            18446744073709551615U, 9221120237041090559U, 4294967296U, 0U, 18446744073709551615U, 9223372036854771711U, 
-            0U, 72057594037927936U, 18446743936270598143U, 9223372036854775807U, 0U, 131072U, 
-            18446744073709551615U, 6917529027641081855U, 4398046511104U, 0U, 18446744073709551615U, 9223372036850581503U, 
-            8U, 0U, 18446603336221196287U, 9223372036854775807U, 0U, 134217728U, 
-            18446744073709551359U, 9223372036854775807U, 4503599627370496U, 0U, 18446744073709551615U, 9223372032559808511U, 
-            8192U, 0U, 18302628885633695743U, 9223372036854775807U, 0U, 137438953472U, 
-            18446744073709289471U, 9223372036854775807U, 4611686018427387904U, 0U, 18446744073709551615U, 9223367638808264703U, 
-            8388608U, 0U, 18446744073709551615U, 9223372036854775799U, 0U, 140737488355328U, 
-            18446744073441116159U, 9223372036854775807U, 0U, 256U, 18446744073709551615U, 9218868437227405311U, 
-            8589934592U, 0U, 18446744073709551615U, 9223372036854767615U, 0U, 144115188075855872U, 
-            18446743798831644671U, 9223372036854775807U, 0U, 262144U, 18446744073709551615U, 4611686018427387903U, 
-            8796093022208U, 0U, 18446744073709551615U, 9223372036846387199U, 16U, 0U, 
-            18446462598732840959U, 9223372036854775807U, 0U, 268435456U, 18446744073709551103U, 9223372036854775807U, 
-            9007199254740992U, 0U, 18446744073709551615U, 9223372028264841215U, 16384U, 0U, 
-            18158513697557839871U, 9223372036854775807U, 0U, 274877906944U, 18446744073709027327U, 9223372036854775807U, 
-            9223372036854775808U, 0U, 18446744073709551615U, 9223363240761753599U, 16777216U, 0U, 
-            18446744073709551615U, 9223372036854775791U, 0U, 281474976710656U, 18446744073172680703U, 9223372036854775807U, 
-            0U, 512U, 18446744073709551615U, 9214364837600034815U, 17179869184U, 0U, 
-            18446744073709551615U, 9223372036854759423U, 0U, 288230376151711744U, 18446743523953737727U, 9223372036854775807U, 
-            0U, 524288U, 18446744073709551614U, 9223372036854775807U, 17592186044416U, 0U, 
-            18446744073709551615U, 9223372036837998591U, 32U, 0U, 18446181123756130303U, 9223372036854775807U, 
-            0U, 536870912U, 18446744073709550591U, 9223372036854775807U, 18014398509481984U, 0U, 
-            18446744073709551615U, 9223372019674906623U, 32768U, 0U, 17870283321406128127U, 9223372036854775807U,
-            0U, 549755813888U, 18446744073708503039U, 9223372036854775807U, 0U, 1U, 
-            18446744073709551615U, 9223354444668731391U, 33554432U, 0U, 18446744073709551615U, 9223372036854775775U, 
-            0U, 562949953421312U, 18446744072635809791U, 9223372036854775807U, 0U, 1024U, 
-            18446744073709551615U, 9205357638345293823U, 34359738368U, 0U, 18446744073709551615U, 9223372036854743039U, 
-            0U, 576460752303423488U, 18446742974197923839U, 9223372036854775807U, 0U, 1048576U, 
-            18446744073709551613U, 9223372036854775807U, 35184372088832U, 0U, 18446744073709551615U, 9223372036821221375U, 
-            64U, 0U, 18445618173802708991U, 9223372036854775807U, 0U, 1073741824U, 
-            18446744073709549567U, 9223372036854775807U, 36028797018963968U, 0U, 18446744073709551615U, 9223372002495037439U, 
-            65536U, 0U, 17293822569102704639U, 9223372036854775807U, 0U, 1099511627776U, 
-            18446744073707454463U, 9223372036854775807U, 0U, 2U, 18446744073709551615U, 9223336852482686975U, 
-            67108864U, 0U, 18446744073709551615U, 9223372036854775743U, 0U, 1125899906842624U, 
-            18446744071562067967U, 9223372036854775807U, 0U, 2048U, 18446744073709551615U, 9187343239835811839U, 
-            68719476736U, 0U, 18446744073709551615U, 9223372036854710271U, 0U, 1152921504606846976U, 
-            18446741874686296063U, 9223372036854775807U, 0U, 2097152U, 18446744073709551611U, 9223372036854775807U, 
-            70368744177664U, 0U, 18446744073709551615U, 9223372036787666943U, 128U, 0U, 
-            18444492273895866367U, 9223372036854775807U, 0U, 2147483648U, 18446744073709547519U, 9223372036854775807U, 
-            72057594037927936U, 0U, 18446744073709551615U, 9223371968135299071U, 131072U, 0U, 
-            16140901064495857663U, 9223372036854775807U, 0U, 2199023255552U, 18446744073705357311U, 9223372036854775807U, 
-            0U, 4U, 18446744073709551615U, 9223301668110598143U, 134217728U, 0U, 
-            18446744073709551615U, 9223372036854775679U, 0U, 2251799813685248U, 18446744069414584319U, 9223372036854775807U, 
-            0U, 4096U, 18446744073709551615U, 9151314442816847871U, 137438953472U, 0U, 
-            18446744073709551615U, 9223372036854644735U, 0U, 2305843009213693952U, 18446739675663040511U, 9223372036854775807U,
-            0U, 4194304U, 18446744073709551607U, 9223372036854775807U, 140737488355328U, 0U, 
-            18446744073709551615U, 9223372036720558079U, 256U, 0U, 18442240474082181119U, 9223372036854775807U, 
-            0U, 4294967296U, 18446744073709543423U, 9223372036854775807U, 144115188075855872U, 0U, 
-            18446744073709551615U, 9223371899415822335U, 262144U, 0U, 13835058055282163711U, 9223372036854775807U, 
-            0U, 4398046511104U, 18446744073701163007U, 9223372036854775807U, 0U, 8U, 
-            18446744073709551615U, 9223231299366420479U, 268435456U, 0U, 18446744073709551615U, 9223372036854775551U, 
-            0U, 4503599627370496U, 18446744065119617023U, 9223372036854775807U, 0U, 8192U, 
-            18446744073709551615U, 9079256848778919935U, 274877906944U, 0U, 18446744073709551615U, 9223372036854513663U, 
-            0U, 4611686018427387904U, 18446735277616529407U, 9223372036854775807U, 0U, 8388608U, 
-            18446744073709551599U, 9223372036854775807U, 281474976710656U, 0U, 18446744073709551615U, 9223372036586340351U, 
-            512U, 0U, 18437736874454810623U, 9223372036854775807U, 0U, 8589934592U, 
-            18446744073709535231U, 9223372036854775807U, 288230376151711744U, 0U, 18446744073709551615U, 9223371761976868863U, 
-            524288U, 0U, 9223372036854775807U, 9223372036854775807U, 0U, 8796093022208U, 
-            18446744073692774399U, 9223372036854775807U, 0U, 16U, 18446744073709551615U, 9223090561878065151U, 
-            536870912U, 0U, 18446744073709551615U, 9223372036854775295U, 0U, 9007199254740992U, 
-            18446744056529682431U, 9223372036854775807U, 0U, 16384U, 18446744073709551615U, 8935141660703064063U, 
-            549755813888U, 0U, 18446744073709551615U, 9223372036854251519U};
-
-        reduce_mod_p(&out);
-        for (int i = 0; i < 254; ++i)
+        uint128_t a[FIELD_LANES], x[FIELD_LANES];
+        for (size_t nStart = 0; nStart < n; nStart += FIELD_LANES)
         {
-            if (memcmp((unsigned char*)&out, (unsigned char*)(list + 2 * i), sizeof(uint128_t)) == 0) {
-                return i;
+            const size_t nLanes = std::min(FIELD_LANES, n - nStart);
+            for (size_t l = 0; l < FIELD_LANES; ++l)
+                a[l] = x[l] = in[nStart + (l < nLanes ? l : 0)];
+
+            for (int i = 0; i < 17; ++i)
+            {
+                // square 7 times and multiply by a
+                for (int j = 0; j < 7; ++j)
+                {
+                    for (size_t l = 0; l < FIELD_LANES; ++l)
+                        x[l] = square_mod_p(x[l]);
+                }
+                for (size_t l = 0; l < FIELD_LANES; ++l)
+                    x[l] = mul_mod_p(x[l], a[l]);
+            }
+
+            for (size_t l = 0; l < nLanes; ++l)
+            {
+                reduce_mod_p(&x[l]);
+                out[nStart + l] = power_residue_index(x[l]);
             }
         }
-        // oops
-        return 0;
+    }
+
+    static unsigned char power_residue_symbol(const uint128_t* a) noexcept
+    {
+        unsigned char symbol;
+        power_residue_symbols(a, &symbol, 1);
+        return symbol;
     }
 
     int getBit(const uint32_t nBit) const noexcept
@@ -1127,11 +1342,11 @@ private:
 #define IS_LEFT_SIBLING(i) (i % 2)
 
     // merkle tree
-    void generate_seed_tree(unsigned char* seed_tree) 
+    void generate_seed_tree(EVP_MD_CTX* pCtx, unsigned char* seed_tree) 
     {
         for (uint32_t i = 0; i < Params().PARTIES - 1; i++)
         {
-            LR_EXPAND(seed_tree + i * SEED_BYTES, SEED_BYTES,
+            LR_EXPAND(pCtx, seed_tree + i * SEED_BYTES, SEED_BYTES,
                       seed_tree + LEFT_CHILD(i) * SEED_BYTES, 2 * SEED_BYTES);
         }
     }
@@ -1148,7 +1363,7 @@ private:
         }
     }
 
-    void fill_down(unsigned char* tree, uint32_t unopened_index, const unsigned char* in)
+    void fill_down(EVP_MD_CTX* pCtx, unsigned char* tree, uint32_t unopened_index, const unsigned char* in)
     {
         unopened_index += Params().PARTIES - 1;
         memset(tree, 0, (Params().PARTIES * 2 - 1) * SEED_BYTES);
@@ -1163,7 +1378,7 @@ private:
         for (uint32_t i = 0; i < Params().PARTIES - 1; i++)
         {
             if (memcmp(tree, tree + i * SEED_BYTES, SEED_BYTES) != 0)
-                LR_EXPAND(tree + i * SEED_BYTES, SEED_BYTES, tree + LEFT_CHILD(i) * SEED_BYTES, 2 * SEED_BYTES);
+                LR_EXPAND(pCtx, tree + i * SEED_BYTES, SEED_BYTES, tree + LEFT_CHILD(i) * SEED_BYTES, 2 * SEED_BYTES);
         }
     }
 #undef LEFT_CHILD
@@ -1173,25 +1388,35 @@ private:
 #undef IS_LEFT_SIBLING
 
     // SHAKE-128 - Extendable Output Function (XOF) that can generate a variable hash interface
-    int LR_EXPAND(const unsigned char *data, const size_t nDataLength, unsigned char *out, const size_t nOutputLength)
+    static int LR_EXPAND(EVP_MD_CTX* pCtx, const unsigned char *data, const size_t nDataLength, unsigned char *out, const size_t nOutputLength)
     {
         int nEVPCode = 1;
         do
         {
-            nEVPCode = EVP_DigestInit_ex(m_pMDcontext, EVP_shake128(), nullptr);
+            nEVPCode = EVP_DigestInit_ex(pCtx, EVP_shake128(), nullptr);
             if (nEVPCode != 1)
                 break;
-            nEVPCode = EVP_DigestUpdate(m_pMDcontext, data, nDataLength);
+            nEVPCode = EVP_DigestUpdate(pCtx, data, nDataLength);
             if (nEVPCode != 1)
                 break;
-            nEVPCode = EVP_DigestFinalXOF(m_pMDcontext, out, nOutputLength);
+            nEVPCode = EVP_DigestFinalXOF(pCtx, out, nOutputLength);
         } while (false);
         return nEVPCode; 
     }
 
+    inline static int LR_HASH(EVP_MD_CTX* pCtx, const unsigned char* data, const size_t nDataLength, unsigned char* out)
+    {
+        return LR_EXPAND(pCtx, data, nDataLength, out, HASH_BYTES);
+    }
+
+    inline int LR_EXPAND(const unsigned char *data, const size_t nDataLength, unsigned char *out, const size_t nOutputLength)
+    {
+        return LR_EXPAND(m_pMDcontext, data, nDataLength, out, nOutputLength);
+    }
+
     inline int LR_HASH(const unsigned char* data, const size_t nDataLength, unsigned char* out)
     {
-        return LR_EXPAND(data, nDataLength, out, HASH_BYTES);
+        return LR_EXPAND(m_pMDcontext, data, nDataLength, out, HASH_BYTES);
     }
 };
 
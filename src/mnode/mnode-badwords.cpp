@@ -0,0 +1,116 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <algorithm>
+#include <deque>
+
+#include <mnode/mnode-badwords.h>
+
+using namespace std;
+
+constexpr uint32_t INVALID_SYMBOL = UINT32_MAX;
+
+/**
+ * Get automaton symbol for the lowercase username character.
+ *
+ * \param c - character
+ * \return symbol index [0..ALPHABET_SIZE) or INVALID_SYMBOL
+ */
+static inline uint32_t GetSymbol(const char c) noexcept
+{
+    if (c >= 'a' && c <= 'z')
+        return static_cast<uint32_t>(c - 'a');
+    if (c >= '0' && c <= '9')
+        return static_cast<uint32_t>(26 + c - '0');
+    return INVALID_SYMBOL;
+}
+
+UsernameBadWords::UsernameBadWords()
+{
+    BuildAutomaton();
+}
+
+/**
+ * Build Aho-Corasick automaton from the bad words list.
+ * Words with characters other than a..z and 0..9 are skipped - they can't be found
+ * in the lowercase username that contains only letters and digits.
+ */
+void UsernameBadWords::BuildAutomaton()
+{
+    m_vTransitions.assign(ALPHABET_SIZE, 0);
+    m_vMatch.assign(1, false);
+    // build trie, 0 transition in the trie means "no child"
+    for (const auto& sWord : wordSet)
+    {
+        if (sWord.empty() || !all_of(sWord.cbegin(), sWord.cend(), [](const char c) { return GetSymbol(c) != INVALID_SYMBOL; }))
+            continue;
+        uint32_t nNode = 0;
+        for (const char c : sWord)
+        {
+            const size_t nIndex = nNode * ALPHABET_SIZE + GetSymbol(c);
+            if (!m_vTransitions[nIndex])
+            {
+                const uint32_t nNewNode = static_cast<uint32_t>(m_vMatch.size());
+                m_vMatch.push_back(false);
+                m_vTransitions.resize(m_vTransitions.size() + ALPHABET_SIZE, 0);
+                m_vTransitions[nIndex] = nNewNode;
+            }
+            nNode = m_vTransitions[nIndex];
+        }
+        m_vMatch[nNode] = true;
+    }
+
+    // calculate suffix links in BFS order and convert trie into the automaton:
+    // missing transitions are replaced with transitions of the suffix link node
+    vector<uint32_t> vSuffixLinks(m_vMatch.size(), 0);
+    deque<uint32_t> queue;
+    for (size_t nSymbol = 0; nSymbol < ALPHABET_SIZE; ++nSymbol)
+    {
+        if (m_vTransitions[nSymbol])
+            queue.push_back(m_vTransitions[nSymbol]);
+    }
+    while (!queue.empty())
+    {
+        const uint32_t nNode = queue.front();
+        queue.pop_front();
+        const uint32_t nLink = vSuffixLinks[nNode];
+        if (m_vMatch[nLink])
+            m_vMatch[nNode] = true;
+        for (size_t nSymbol = 0; nSymbol < ALPHABET_SIZE; ++nSymbol)
+        {
+            uint32_t& nNext = m_vTransitions[nNode * ALPHABET_SIZE + nSymbol];
+            const uint32_t nLinkNext = m_vTransitions[nLink * ALPHABET_SIZE + nSymbol];
+            if (nNext)
+            {
+                vSuffixLinks[nNext] = nLinkNext;
+                queue.push_back(nNext);
+            } else
+                nNext = nLinkNext;
+        }
+    }
+}
+
+/**
+ * Check if lowercase username contains any of the bad words.
+ * Characters other than a..z and 0..9 reset automaton to the root.
+ *
+ * \param sLowercaseUsername - username converted to lowercase
+ * \return true if username contains bad word
+ */
+bool UsernameBadWords::HasBadWord(const string& sLowercaseUsername) const noexcept
+{
+    uint32_t nNode = 0;
+    for (const char c : sLowercaseUsername)
+    {
+        const uint32_t nSymbol = GetSymbol(c);
+        if (nSymbol == INVALID_SYMBOL)
+        {
+            nNode = 0;
+            continue;
+        }
+        nNode = m_vTransitions[nNode * ALPHABET_SIZE + nSymbol];
+        if (m_vMatch[nNode])
+            return true;
+    }
+    return false;
+}
@@ -3,7 +3,10 @@
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <cstdint>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 struct UsernameBadWords {
 public:
@@ -1680,8 +1683,21 @@ public:
         return instance;
     }
 
+    // check if lowercase username contains any of the bad words (single pass over the username)
+    bool HasBadWord(const std::string& sLowercaseUsername) const noexcept;
+
 private:
-    UsernameBadWords() = default;
+    // usernames can contain only letters and digits: a..z, 0..9 after conversion to lowercase
+    static constexpr size_t ALPHABET_SIZE = 26 + 10;
+
+    // Aho-Corasick automaton built from wordSet, node 0 is the root.
+    // dense transition table: m_vTransitions[node * ALPHABET_SIZE + symbol] -> next node
+    std::vector<uint32_t> m_vTransitions;
+    // true if any bad word ends in the node (directly or via suffix link)
+    std::vector<bool> m_vMatch;
+
+    UsernameBadWords();
+    void BuildAutomaton();
     ~UsernameBadWords() = default;
     UsernameBadWords(const UsernameBadWords&) = delete;
     UsernameBadWords& operator=(const UsernameBadWords&) = delete;
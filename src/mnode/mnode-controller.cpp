@@ -10,7 +10,6 @@
 #include <base58.h>
 #include <ui_interface.h>
 #include <key_io.h>
-#include <trimmean.h>
 
 #include <mnode/mnode-controller.h>
 #include <mnode/mnode-sync.h>
@@ -331,7 +330,17 @@ bool CMasterNodeController::EnableMasterNode(std::ostringstream& strErrors, boos
 	masternodeTickets.InitTicketDB();
 
     pacNotificationInterface = new CACNotificationInterface();
-    RegisterValidationInterface(pacNotificationInterface);
+    {
+        // index tickets of the blocks connected while ticket DBs were not updated
+        LOCK(cs_main);
+        string error;
+        if (!masternodeTickets.SyncTicketDB(chainActive.Tip(), error))
+        {
+            strErrors << error;
+            return false;
+        }
+        RegisterValidationInterface(pacNotificationInterface);
+    }
 
     // force UpdatedBlockTip to initialize nCachedBlockHeight for DS, MN and governances payments
     pacNotificationInterface->InitializeCurrentBlockTip();
@@ -535,36 +544,17 @@ fs::path CMasterNodeController::GetMasternodeConfigFile()
 
 CAmount CMasterNodeController::GetNetworkFeePerMB() const noexcept
 {
-    CAmount nFee = masterNodeCtrl.MasternodeFeePerMBDefault;
+    // trimmed mean of the fees reported by masternodes with fixed 25% percentage
     if (fMasterNode)
-    {
-        // COutPoint => CMasternode
-        const auto mapMasternodes = masternodeManager.GetFullMasternodeMap();
-        if (!mapMasternodes.empty())
-        {
-            vector<CAmount> vFee(mapMasternodes.size());
-            size_t cnt = 0;
-            for (const auto& [op, mn] : mapMasternodes)
-                vFee[cnt++] = mn.aMNFeePerMB > 0 ? mn.aMNFeePerMB : masterNodeCtrl.MasternodeFeePerMBDefault;
-            // Use trimmean to calculate the value with fixed 25% percentage
-            nFee = static_cast<CAmount>(ceil(TRIMMEAN(vFee, 0.25)));
-        }
-    }
-    return nFee;
+        return masternodeManager.GetNetworkFeePerMB(MasternodeFeePerMBDefault);
+    return MasternodeFeePerMBDefault;
 }
 
 CAmount CMasterNodeController::GetNFTTicketFeePerKB() const noexcept
 {
+    // mean of the fees reported by masternodes
     if (fMasterNode)
-    {
-        CAmount nFee = 0;
-        // COutPoint => CMasternode
-        const auto mapMasternodes = masternodeManager.GetFullMasternodeMap();
-        for (const auto& [op, mn] : mapMasternodes)
-            nFee += mn.aNFTTicketFeePerKB > 0? mn.aNFTTicketFeePerKB: masterNodeCtrl.NFTTicketFeePerKBDefault;
-        nFee /= mapMasternodes.size();
-        return nFee;
-    }
+        return masternodeManager.GetNFTTicketFeePerKB(NFTTicketFeePerKBDefault);
     return NFTTicketFeePerKBDefault;
 }
 
@@ -576,39 +566,54 @@ CAmount CMasterNodeController::GetNFTTicketFeePerKB() const noexcept
  */
 CAmount CMasterNodeController::GetActionTicketFeePerMB(const ACTION_TICKET_TYPE actionTicketType) const noexcept
 {
-    // this should use median fees for actions fee reported by SNs
+    // this should use median fees for actions fee reported by SNs (CMasternodeFeeStats::GetMedian),
+    // but SNs do not report action fees yet
     return ActionTicketFeePerMBDefault;
 }
 
+double CMasterNodeController::GetAverageNetworkDifficulty(const uint32_t nStartHeight, const uint32_t nEndHeight) const
+{
+    double fTotalDifficulty = 0.0;
+    for (uint32_t i = nStartHeight; i < nEndHeight; ++i)
+        fTotalDifficulty += getNetworkDifficulty(chainActive[i], true);
+    return fTotalDifficulty / (nEndHeight - nStartHeight);
+}
+
+/**
+ * Get chain deflation rate - ratio of the trailing average difficulty to the baseline average difficulty.
+ * Baseline window is fixed and trailing window moves only every ChainTrailingAverageDifficultyRange blocks,
+ * so window averages are cached and recalculated only when the last block of the window
+ * in the active chain changes (new trailing window or reorg).
+ * 
+ * \return chain deflation rate
+ */
 double CMasterNodeController::GetChainDeflationRate() const
 {
+    LOCK2(cs_main, cs_deflationRate);
     const int nChainHeight = chainActive.Height();
 
     if (nChainHeight < 0 || static_cast<uint32_t>(nChainHeight) <= ChainBaselineDifficultyUpperIndex + ChainTrailingAverageDifficultyRange)
         return ChainDeflationRateDefault;
 
     // Get baseline average difficulty
-    double totalBaselineDifficulty = 0.0;
-    for (uint32_t i = ChainBaselineDifficultyLowerIndex; i < ChainBaselineDifficultyUpperIndex; i++)
+    const uint256& baselineEndHash = chainActive[ChainBaselineDifficultyUpperIndex - 1]->GetBlockHash();
+    if (m_DeflationRateCache.baselineEndHash != baselineEndHash)
     {
-        const CBlockIndex* index = chainActive[i];
-        totalBaselineDifficulty += getNetworkDifficulty(index, true);
+        m_DeflationRateCache.fBaselineDifficulty = GetAverageNetworkDifficulty(ChainBaselineDifficultyLowerIndex, ChainBaselineDifficultyUpperIndex);
+        m_DeflationRateCache.baselineEndHash = baselineEndHash;
     }
-    const double averageBaselineDifficulty = totalBaselineDifficulty/(ChainBaselineDifficultyUpperIndex - ChainBaselineDifficultyLowerIndex);
+
     // Get trailing average difficulty
-    uint32_t endTrailingIndex = ChainBaselineDifficultyUpperIndex + ChainTrailingAverageDifficultyRange*((chainActive.Height() - ChainBaselineDifficultyUpperIndex)/ChainTrailingAverageDifficultyRange );
-    uint32_t startTrailingIndex = endTrailingIndex - ChainTrailingAverageDifficultyRange;
-        
-        
-    double totalTrailingDifficulty = 0.0;
-    for (uint32_t i = startTrailingIndex; i < endTrailingIndex; i++)
+    const uint32_t endTrailingIndex = ChainBaselineDifficultyUpperIndex + ChainTrailingAverageDifficultyRange*((nChainHeight - ChainBaselineDifficultyUpperIndex)/ChainTrailingAverageDifficultyRange);
+    const uint32_t startTrailingIndex = endTrailingIndex - ChainTrailingAverageDifficultyRange;
+    const uint256& trailingEndHash = chainActive[endTrailingIndex - 1]->GetBlockHash();
+    if (m_DeflationRateCache.trailingEndHash != trailingEndHash)
     {
-        const CBlockIndex* index = chainActive[i];
-        totalTrailingDifficulty += getNetworkDifficulty(index, true);
+        m_DeflationRateCache.fTrailingDifficulty = GetAverageNetworkDifficulty(startTrailingIndex, endTrailingIndex);
+        m_DeflationRateCache.trailingEndHash = trailingEndHash;
     }
-    const double averageTrailingDifficulty = totalTrailingDifficulty/ChainTrailingAverageDifficultyRange;
 
-    return averageTrailingDifficulty/averageBaselineDifficulty;
+    return m_DeflationRateCache.fTrailingDifficulty/m_DeflationRateCache.fBaselineDifficulty;
 }
 
 /*
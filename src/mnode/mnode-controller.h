@@ -33,7 +33,21 @@ private:
     void SetParameters();
     void InvalidateParameters();
     double getNetworkDifficulty(const CBlockIndex* blockindex, const bool bNetworkDifficulty) const;
+    // get average network difficulty of the active chain blocks in [nStartHeight, nEndHeight)
+    double GetAverageNetworkDifficulty(const uint32_t nStartHeight, const uint32_t nEndHeight) const;
     CACNotificationInterface* pacNotificationInterface;
+
+    // average difficulties used to calculate chain deflation rate,
+    // each average is identified by the hash of the last block in its window
+    typedef struct _deflation_rate_cache_t
+    {
+        uint256 baselineEndHash;
+        double fBaselineDifficulty = 0;
+        uint256 trailingEndHash;
+        double fTrailingDifficulty = 0;
+    } deflation_rate_cache_t;
+    mutable CCriticalSection cs_deflationRate;
+    mutable deflation_rate_cache_t m_DeflationRateCache;
     
 public:
     CMasternodeConfig masternodeConfig;
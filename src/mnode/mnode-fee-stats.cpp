@@ -0,0 +1,132 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <algorithm>
+#include <limits>
+
+#include <mnode/mnode-fee-stats.h>
+
+using namespace std;
+
+void CMasternodeFeeStats::Add(const CAmount nFee)
+{
+    if (nFee > 0)
+    {
+        m_vFees.insert(upper_bound(m_vFees.begin(), m_vFees.end(), nFee), nFee);
+        m_bPrefixSumsValid = false;
+    } else
+        ++m_nDefaultCount;
+}
+
+void CMasternodeFeeStats::Remove(const CAmount nFee)
+{
+    if (nFee > 0)
+    {
+        const auto it = lower_bound(m_vFees.begin(), m_vFees.end(), nFee);
+        if (it == m_vFees.end() || *it != nFee)
+            return;
+        m_vFees.erase(it);
+        m_bPrefixSumsValid = false;
+    } else if (m_nDefaultCount > 0)
+        --m_nDefaultCount;
+}
+
+void CMasternodeFeeStats::Update(const CAmount nOldFee, const CAmount nNewFee)
+{
+    if (nOldFee == nNewFee)
+        return;
+    Remove(nOldFee);
+    Add(nNewFee);
+}
+
+void CMasternodeFeeStats::Clear() noexcept
+{
+    m_vFees.clear();
+    m_vPrefixSums.clear();
+    m_nDefaultCount = 0;
+    m_bPrefixSumsValid = false;
+}
+
+CAmount CMasternodeFeeStats::GetAt(const size_t nIndex, const CAmount nDefaultFee) const noexcept
+{
+    // default fees are placed in the sorted list at nDefaultPos
+    const size_t nDefaultPos = lower_bound(m_vFees.cbegin(), m_vFees.cend(), nDefaultFee) - m_vFees.cbegin();
+    if (nIndex < nDefaultPos)
+        return m_vFees[nIndex];
+    if (nIndex < nDefaultPos + m_nDefaultCount)
+        return nDefaultFee;
+    return m_vFees[nIndex - m_nDefaultCount];
+}
+
+CAmount CMasternodeFeeStats::GetSum(const size_t nCount, const CAmount nDefaultFee) const noexcept
+{
+    if (!m_bPrefixSumsValid)
+    {
+        m_vPrefixSums.resize(m_vFees.size() + 1);
+        m_vPrefixSums[0] = 0;
+        for (size_t i = 0; i < m_vFees.size(); ++i)
+            m_vPrefixSums[i + 1] = m_vPrefixSums[i] + m_vFees[i];
+        m_bPrefixSumsValid = true;
+    }
+    const size_t nDefaultPos = lower_bound(m_vFees.cbegin(), m_vFees.cend(), nDefaultFee) - m_vFees.cbegin();
+    if (nCount <= nDefaultPos)
+        return m_vPrefixSums[nCount];
+    if (nCount <= nDefaultPos + m_nDefaultCount)
+        return m_vPrefixSums[nDefaultPos] + static_cast<CAmount>(nCount - nDefaultPos) * nDefaultFee;
+    return m_vPrefixSums[nCount - m_nDefaultCount] + static_cast<CAmount>(m_nDefaultCount) * nDefaultFee;
+}
+
+/**
+ * Get median fee.
+ * For even number of fees returns mean of the two middle fees (rounded down).
+ *
+ * \param nDefaultFee - fee for masternodes that did not set the fee
+ * \return median fee or nDefaultFee if no fees
+ */
+CAmount CMasternodeFeeStats::GetMedian(const CAmount nDefaultFee) const noexcept
+{
+    const size_t nSize = size();
+    if (nSize == 0)
+        return nDefaultFee;
+    if (nSize % 2)
+        return GetAt(nSize / 2, nDefaultFee);
+    return (GetAt(nSize / 2 - 1, nDefaultFee) + GetAt(nSize / 2, nDefaultFee)) / 2;
+}
+
+/**
+ * Get mean fee.
+ *
+ * \param nDefaultFee - fee for masternodes that did not set the fee
+ * \return mean fee (rounded down) or nDefaultFee if no fees
+ */
+CAmount CMasternodeFeeStats::GetMean(const CAmount nDefaultFee) const noexcept
+{
+    const size_t nSize = size();
+    if (nSize == 0)
+        return nDefaultFee;
+    return GetSum(nSize, nDefaultFee) / static_cast<CAmount>(nSize);
+}
+
+/**
+ * Exclude fPercent percent of fees from the top and bottom tails and calculate
+ * the mean of the remaining fees. Returns the same result as TRIMMEAN.
+ *
+ * \param fPercent - fractional number of fees to exclude, 0 <= fPercent < 1
+ * \param nDefaultFee - fee for masternodes that did not set the fee
+ * \return trimmed mean or NaN if there are no fees or fPercent is out of range
+ */
+double CMasternodeFeeStats::GetTrimmedMean(const double fPercent, const CAmount nDefaultFee) const noexcept
+{
+    const size_t nSize = size();
+    if (fPercent < 0 || fPercent >= 1 || nSize == 0)
+        return numeric_limits<double>::quiet_NaN();
+
+    // number of fees to exclude, rounded down to the nearest even number
+    size_t nExclude = static_cast<size_t>(nSize * fPercent);
+    if (nExclude % 2 != 0)
+        --nExclude;
+    const size_t nLow = nExclude / 2;
+    const size_t nHigh = nSize - nExclude / 2;
+    const CAmount nSum = GetSum(nHigh, nDefaultFee) - GetSum(nLow, nDefaultFee);
+    return nSum / static_cast<double>(nHigh - nLow);
+}
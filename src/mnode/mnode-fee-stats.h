@@ -0,0 +1,54 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <cstddef>
+#include <vector>
+
+#include <amount.h>
+
+/**
+ * Order statistics of the fees reported by masternodes.
+ * Keeps sorted non-default fees, masternodes that did not set the fee (fee = 0)
+ * are counted separately and use default fee passed to the queries.
+ * Fees are updated when masternode is added/removed or reports new fee,
+ * median and trimmed mean queries do not rebuild or sort the fee list.
+ */
+class CMasternodeFeeStats
+{
+public:
+    CMasternodeFeeStats() noexcept = default;
+
+    // add reported fee (0 - default fee)
+    void Add(const CAmount nFee);
+    // remove previously added fee
+    void Remove(const CAmount nFee);
+    // replace previously added fee with the new one
+    void Update(const CAmount nOldFee, const CAmount nNewFee);
+    void Clear() noexcept;
+
+    // number of fees
+    size_t size() const noexcept { return m_vFees.size() + m_nDefaultCount; }
+    bool empty() const noexcept { return size() == 0; }
+
+    // get median fee
+    CAmount GetMedian(const CAmount nDefaultFee) const noexcept;
+    // get mean fee (rounded down)
+    CAmount GetMean(const CAmount nDefaultFee) const noexcept;
+    // get the mean of the interior of the fees, same as TRIMMEAN
+    double GetTrimmedMean(const double fPercent, const CAmount nDefaultFee) const noexcept;
+
+protected:
+    // sorted non-default fees
+    std::vector<CAmount> m_vFees;
+    // number of masternodes that use default fee
+    size_t m_nDefaultCount = 0;
+    // m_vPrefixSums[i] - sum of the first i fees in m_vFees, rebuilt on the first query after update
+    mutable std::vector<CAmount> m_vPrefixSums;
+    mutable bool m_bPrefixSumsValid = false;
+
+    // get fee with the given index in the sorted list of all fees (including default ones)
+    CAmount GetAt(const size_t nIndex, const CAmount nDefaultFee) const noexcept;
+    // get sum of the first nCount fees in the sorted list of all fees
+    CAmount GetSum(const size_t nCount, const CAmount nDefaultFee) const noexcept;
+};
@@ -8,6 +8,7 @@
 #include <set>
 #include <vector>
 #include <algorithm>
+#include <cmath>
 #include <random>
 
 #include "addrman.h"
@@ -27,7 +28,7 @@
 #include "timedata.h"
 
 
-const std::string CMasternodeMan::SERIALIZATION_VERSION_STRING = "CMasternodeMan-Version-7";
+const std::string CMasternodeMan::SERIALIZATION_VERSION_STRING = "CMasternodeMan-Version-8";
 
 struct CompareLastPaidBlock
 {
@@ -38,15 +39,6 @@ struct CompareLastPaidBlock
     }
 };
 
-struct CompareScoreMN
-{
-    bool operator()(const std::pair<arith_uint256, CMasternode*>& t1,
-                    const std::pair<arith_uint256, CMasternode*>& t2) const
-    {
-        return (t1.first != t2.first) ? (t1.first < t2.first) : (t1.second->vin < t2.second->vin);
-    }
-};
-
 struct CompareByAddr
 
 {
@@ -61,6 +53,7 @@ CMasternodeMan::CMasternodeMan()
 : cs(),
   nCachedBlockHeight(0),
   mapMasternodes(),
+  m_bSnapshotChanged(true),
   mAskedUsForMasternodeList(),
   mWeAskedForMasternodeList(),
   mWeAskedForMasternodeListEntry(),
@@ -81,6 +74,9 @@ bool CMasternodeMan::Add(CMasternode &mn)
 
     LogPrint("masternode", "CMasternodeMan::Add -- Adding new Masternode: addr=%s, %i now\n", mn.addr.ToString(), size() + 1);
     mapMasternodes[mn.vin.prevout] = mn;
+    AddFeeStats(mn);
+    InvalidateRankCache();
+    SnapshotChanged();
     return true;
 }
 
@@ -121,6 +117,7 @@ bool CMasternodeMan::PoSeBan(const COutPoint &outpoint)
         return false;
     }
     pmn->PoSeBan();
+    SnapshotChanged();
 
     return true;
 }
@@ -131,9 +128,15 @@ void CMasternodeMan::Check()
 
     LogPrint("masternode", "CMasternodeMan::Check -- nLastWatchdogVoteTime=%d, IsWatchdogActive()=%d\n", nLastWatchdogVoteTime, IsWatchdogActive());
 
+    bool bStateChanged = false;
     for (auto& mnpair : mapMasternodes) {
+        const int nPrevState = mnpair.second.nActiveState;
         mnpair.second.Check();
+        if (mnpair.second.nActiveState != nPrevState)
+            bStateChanged = true;
     }
+    if (bStateChanged)
+        SnapshotChanged();
 }
 
 void CMasternodeMan::CheckAndRemove(bool bCheckAndRemove)
@@ -168,7 +171,10 @@ void CMasternodeMan::CheckAndRemove(bool bCheckAndRemove)
                 mWeAskedForMasternodeListEntry.erase(it->first);
 
                 // and finally remove it from the list
+                RemoveFeeStats(it->second);
                 mapMasternodes.erase(it++);
+                InvalidateRankCache();
+                SnapshotChanged();
             } else {
                 bool fAsk = (nAskForMnbRecovery > 0) &&
                             masterNodeCtrl.masternodeSync.IsSynced() &&
@@ -185,10 +191,13 @@ void CMasternodeMan::CheckAndRemove(bool bCheckAndRemove)
                     bool fAskedForMnbRecovery = false;
                     // ask first MNB_RECOVERY_QUORUM_TOTAL masternodes we can connect to and we haven't asked recently
                     for(int i = 0; setRequested.size() < MNB_RECOVERY_QUORUM_TOTAL && i < (int)vecMasternodeRanks.size(); i++) {
+                        const CMasternode* pRankedMN = FindReadOnly(vecMasternodeRanks[i].second);
+                        if (!pRankedMN)
+                            continue;
                         // avoid banning
-                        if(mWeAskedForMasternodeListEntry.count(it->first) && mWeAskedForMasternodeListEntry[it->first].count(vecMasternodeRanks[i].second.addr)) continue;
+                        if(mWeAskedForMasternodeListEntry.count(it->first) && mWeAskedForMasternodeListEntry[it->first].count(pRankedMN->addr)) continue;
                         // didn't ask recently, ok to ask now
-                        CService addr = vecMasternodeRanks[i].second.addr;
+                        CService addr = pRankedMN->addr;
                         setRequested.insert(addr);
                         listScheduledMnbRequestConnections.push_back(std::make_pair(addr, hash));
                         fAskedForMnbRecovery = true;
@@ -324,6 +333,11 @@ void CMasternodeMan::Clear()
     mWeAskedForMasternodeListEntry.clear();
     mapSeenMasternodeBroadcast.clear();
     mapSeenMasternodePing.clear();
+    mapHistoricalTopMNs.clear();
+    m_StorageFeeStats.Clear();
+    m_NFTTicketFeeStats.Clear();
+    InvalidateRankCache();
+    SnapshotChanged();
     nLastWatchdogVoteTime = 0;
 }
 
@@ -400,6 +414,13 @@ void CMasternodeMan::DsegUpdate(CNode* pnode)
     LogPrint("masternode", "CMasternodeMan::DsegUpdate -- asked %s for the list\n", pnode->addr.ToString());
 }
 
+/**
+ * Find masternode by outpoint.
+ * Callers that change the masternode should call SnapshotChanged().
+ * 
+ * \param outpoint - masternode collateral outpoint
+ * \return pointer to the masternode or NULL if not found
+ */
 CMasternode* CMasternodeMan::Find(const COutPoint &outpoint)
 {
     LOCK(cs);
@@ -407,6 +428,45 @@ CMasternode* CMasternodeMan::Find(const COutPoint &outpoint)
     return it == mapMasternodes.end() ? NULL : &(it->second);
 }
 
+/**
+ * Find masternode by outpoint for read-only access.
+ * 
+ * \param outpoint - masternode collateral outpoint
+ * \return const pointer to the masternode or NULL if not found
+ */
+const CMasternode* CMasternodeMan::FindReadOnly(const COutPoint &outpoint) const
+{
+    LOCK(cs);
+    auto it = mapMasternodes.find(outpoint);
+    return it == mapMasternodes.end() ? NULL : &(it->second);
+}
+
+/**
+ * Get immutable snapshot of the masternode list.
+ * Snapshot is shared by all readers and is republished (under cs) only on the first
+ * read after the masternode list change, so readers do not copy the list
+ * and do not contend on cs while the list is not changed.
+ * 
+ * \return shared pointer to the read-only masternode map
+ */
+CMasternodeMan::masternode_snapshot_t CMasternodeMan::GetMasternodeSnapshot() const
+{
+    if (!m_bSnapshotChanged)
+    {
+        auto pSnapshot = atomic_load(&m_pSnapshot);
+        if (pSnapshot)
+            return pSnapshot;
+    }
+    LOCK(cs);
+    // snapshot could be already republished by another reader
+    if (m_bSnapshotChanged || !m_pSnapshot)
+    {
+        m_bSnapshotChanged = false;
+        atomic_store(&m_pSnapshot, masternode_snapshot_t(make_shared<const masternode_map_t>(mapMasternodes)));
+    }
+    return atomic_load(&m_pSnapshot);
+}
+
 bool CMasternodeMan::Get(const COutPoint& outpoint, CMasternode& masternodeRet)
 {
     // Theses mutexes are recursive so double locking by the same thread is safe.
@@ -602,27 +662,38 @@ masternode_info_t CMasternodeMan::FindRandomNotInVec(const std::vector<COutPoint
     return masternode_info_t();
 }
 
-bool CMasternodeMan::GetMasternodeScores(const uint256& nBlockHash, CMasternodeMan::score_pair_vec_t& vecMasternodeScoresRet, int nMinProtocol)
+/**
+ * Get masternode scores for the block hash.
+ * Scores are cached per block hash (outpoints only) and sorted by rank lazily,
+ * see CMasternodeRankCache. Cache is invalidated on any masternode list change.
+ * 
+ * \param nBlockHash - block hash to calculate masternode scores for
+ * \param nMinProtocol - min masternode protocol version
+ * \param nTopCount - min number of the scores that should be sorted by rank (0 - all)
+ * \return cache entry with masternode scores or nullptr if scores can't be calculated
+ */
+CMasternodeMan::mn_rank_cache_entry_t* CMasternodeMan::GetMasternodeScores(const uint256& nBlockHash, const int nMinProtocol, const size_t nTopCount)
 {
-    vecMasternodeScoresRet.clear();
-
     if (!masterNodeCtrl.masternodeSync.IsMasternodeListSynced())
-        return false;
+        return nullptr;
 
     AssertLockHeld(cs);
 
     if (mapMasternodes.empty())
-        return false;
-
-    // calculate scores
-    for (auto& mnpair : mapMasternodes) {
-        if (mnpair.second.nProtocolVersion >= nMinProtocol) {
-            vecMasternodeScoresRet.push_back(std::make_pair(mnpair.second.CalculateScore(nBlockHash), &mnpair.second));
-        }
-    }
+        return nullptr;
 
-    sort(vecMasternodeScoresRet.rbegin(), vecMasternodeScoresRet.rend(), CompareScoreMN());
-    return !vecMasternodeScoresRet.empty();
+    return m_RankCache.Get(nBlockHash, nMinProtocol, nTopCount, [&](mn_rank_cache_entry_t& entry)
+        {
+            entry.vScores.reserve(mapMasternodes.size());
+            for (auto& [outpoint, mn] : mapMasternodes)
+            {
+                if (mn.nProtocolVersion < nMinProtocol)
+                    continue;
+                entry.vScores.emplace_back(mn.CalculateScore(nBlockHash), outpoint);
+                if (mn.nCollateralMinConfBlockHash.IsNull())
+                    entry.bFinal = false;
+            }
+        });
 }
 
 bool CMasternodeMan::GetMasternodeRank(const COutPoint& outpoint, int& nRankRet, int nBlockHeight, int nMinProtocol)
@@ -641,23 +712,34 @@ bool CMasternodeMan::GetMasternodeRank(const COutPoint& outpoint, int& nRankRet,
 
     LOCK(cs);
 
-    score_pair_vec_t vecMasternodeScores;
-    if (!GetMasternodeScores(nBlockHash, vecMasternodeScores, nMinProtocol))
+    auto pEntry = GetMasternodeScores(nBlockHash, nMinProtocol, 0);
+    if (!pEntry)
         return false;
 
-    int nRank = 0;
-    for (auto& scorePair : vecMasternodeScores) {
-        nRank++;
-        if(scorePair.second->vin.prevout == outpoint) {
-            nRankRet = nRank;
-            return true;
-        }
+    if (pEntry->mapRanks.empty())
+    {
+        pEntry->mapRanks.reserve(pEntry->vScores.size());
+        int nRank = 0;
+        for (const auto& scorePair : pEntry->vScores)
+            pEntry->mapRanks.emplace(scorePair.second, ++nRank);
     }
-
-    return false;
+    const auto it = pEntry->mapRanks.find(outpoint);
+    if (it == pEntry->mapRanks.cend())
+        return false;
+    nRankRet = it->second;
+    return true;
 }
 
-bool CMasternodeMan::GetMasternodeRanks(CMasternodeMan::rank_pair_vec_t& vecMasternodeRanksRet, int nBlockHeight, int nMinProtocol)
+/**
+ * Get masternode ranks for the block.
+ * 
+ * \param vecMasternodeRanksRet - returns masternode ranks and outpoints ordered by rank
+ * \param nBlockHeight - block height, -1 - use current height
+ * \param nMinProtocol - min masternode protocol version
+ * \param nMaxCount - max number of masternodes to return (0 - all)
+ * \return true if ranks were successfully calculated
+ */
+bool CMasternodeMan::GetMasternodeRanks(CMasternodeMan::rank_pair_vec_t& vecMasternodeRanksRet, int nBlockHeight, int nMinProtocol, const size_t nMaxCount)
 {
     vecMasternodeRanksRet.clear();
 
@@ -673,15 +755,14 @@ bool CMasternodeMan::GetMasternodeRanks(CMasternodeMan::rank_pair_vec_t& vecMast
 
     LOCK(cs);
 
-    score_pair_vec_t vecMasternodeScores;
-    if (!GetMasternodeScores(nBlockHash, vecMasternodeScores, nMinProtocol))
+    const auto pEntry = GetMasternodeScores(nBlockHash, nMinProtocol, nMaxCount);
+    if (!pEntry)
         return false;
 
-    int nRank = 0;
-    for (auto& scorePair : vecMasternodeScores) {
-        nRank++;
-        vecMasternodeRanksRet.push_back(std::make_pair(nRank, *scorePair.second));
-    }
+    const size_t nCount = nMaxCount ? min(nMaxCount, pEntry->nSortedCount) : pEntry->nSortedCount;
+    vecMasternodeRanksRet.reserve(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+        vecMasternodeRanksRet.emplace_back(static_cast<int>(i + 1), pEntry->vScores[i].second);
 
     return true;
 }
@@ -777,8 +858,15 @@ void CMasternodeMan::ProcessMessage(CNode* pfrom, std::string& strCommand, CData
         // too late, new MNANNOUNCE is required
         if(pmn && pmn->IsNewStartRequired()) return;
 
+        // ping can update the masternode even if it is not relayed
+        const int nPrevState = pmn ? pmn->nActiveState : 0;
+        const int64_t nPrevPingTime = pmn ? pmn->lastPing.sigTime : 0;
         int nDos = 0;
-        if(mnp.CheckAndUpdate(pmn, false, nDos)) return;
+        const bool bUpdated = mnp.CheckAndUpdate(pmn, false, nDos);
+        if (pmn && (pmn->nActiveState != nPrevState || pmn->lastPing.sigTime != nPrevPingTime))
+            SnapshotChanged();
+        if (bUpdated)
+            return;
 
         if(nDos > 0) {
             // if anything significant failed, mark that node
@@ -901,14 +989,14 @@ void CMasternodeMan::DoFullVerificationStep()
     int nRanksTotal = (int)vecMasternodeRanks.size();
 
     // send verify requests only if we are in top MAX_POSE_RANK
-    std::vector<std::pair<int, CMasternode> >::iterator it = vecMasternodeRanks.begin();
+    rank_pair_vec_t::iterator it = vecMasternodeRanks.begin();
     while(it != vecMasternodeRanks.end()) {
         if(it->first > MAX_POSE_RANK) {
             LogPrint("masternode", "CMasternodeMan::DoFullVerificationStep -- Must be in top %d to send verify request\n",
                         (int)MAX_POSE_RANK);
             return;
         }
-        if(it->second.vin.prevout == masterNodeCtrl.activeMasternode.outpoint) {
+        if(it->second == masterNodeCtrl.activeMasternode.outpoint) {
             nMyRank = it->first;
             LogPrint("masternode", "CMasternodeMan::DoFullVerificationStep -- Found self at rank %d/%d, verifying up to %d masternodes\n",
                         nMyRank, nRanksTotal, (int)MAX_POSE_CONNECTIONS);
@@ -936,20 +1024,22 @@ void CMasternodeMan::DoFullVerificationStep()
 
     it = vecMasternodeRanks.begin() + nOffset;
     while(it != vecMasternodeRanks.end()) {
-        if(it->second.IsPoSeVerified() || it->second.IsPoSeBanned()) {
-            LogPrint("masternode", "CMasternodeMan::DoFullVerificationStep -- Already %s%s%s masternode %s address %s, skipping...\n",
-                        it->second.IsPoSeVerified() ? "verified" : "",
-                        it->second.IsPoSeVerified() && it->second.IsPoSeBanned() ? " and " : "",
-                        it->second.IsPoSeBanned() ? "banned" : "",
-                        it->second.vin.prevout.ToStringShort(), it->second.addr.ToString());
+        const CMasternode* pmn = FindReadOnly(it->second);
+        if (!pmn || pmn->IsPoSeVerified() || pmn->IsPoSeBanned()) {
+            if (pmn)
+                LogPrint("masternode", "CMasternodeMan::DoFullVerificationStep -- Already %s%s%s masternode %s address %s, skipping...\n",
+                        pmn->IsPoSeVerified() ? "verified" : "",
+                        pmn->IsPoSeVerified() && pmn->IsPoSeBanned() ? " and " : "",
+                        pmn->IsPoSeBanned() ? "banned" : "",
+                        it->second.ToStringShort(), pmn->addr.ToString());
             nOffset += MAX_POSE_CONNECTIONS;
             if(nOffset >= (int)vecMasternodeRanks.size()) break;
             it += MAX_POSE_CONNECTIONS;
             continue;
         }
         LogPrint("masternode", "CMasternodeMan::DoFullVerificationStep -- Verifying masternode %s rank %d/%d address %s\n",
-                    it->second.vin.prevout.ToStringShort(), it->first, nRanksTotal, it->second.addr.ToString());
-        if(SendVerifyRequest(CAddress(it->second.addr, NODE_NETWORK), vSortedByAddr)) {
+                    it->second.ToStringShort(), it->first, nRanksTotal, pmn->addr.ToString());
+        if(SendVerifyRequest(CAddress(pmn->addr, NODE_NETWORK), vSortedByAddr)) {
             nCount++;
             if(nCount >= MAX_POSE_CONNECTIONS) break;
         }
@@ -1019,6 +1109,8 @@ void CMasternodeMan::CheckSameAddr()
         LogPrintf("CMasternodeMan::CheckSameAddr -- increasing PoSe ban score for masternode %s\n", pmn->vin.prevout.ToStringShort());
         pmn->IncreasePoSeBanScore();
     }
+    if (!vBan.empty())
+        SnapshotChanged();
 }
 
 bool CMasternodeMan::SendVerifyRequest(const CAddress& addr, const std::vector<CMasternode*>& vSortedByAddr)
@@ -1139,6 +1231,8 @@ void CMasternodeMan::ProcessVerifyReply(CNode* pnode, CMasternodeVerification& m
                     prealMasternode = &mnpair.second;
                     if(!mnpair.second.IsPoSeVerified()) {
                         mnpair.second.DecreasePoSeBanScore();
+                        // mark here - the code below can return early
+                        SnapshotChanged();
                     }
                     masterNodeCtrl.requestTracker.AddFulfilledRequest(pnode->addr, strprintf("%s", NetMsgType::MNVERIFY)+"-done");
 
@@ -1189,6 +1283,7 @@ void CMasternodeMan::ProcessVerifyReply(CNode* pnode, CMasternodeVerification& m
             LogPrint("masternode", "CMasternodeMan::ProcessVerifyReply -- increased PoSe ban score for %s addr %s, new score %d\n",
                         prealMasternode->vin.prevout.ToStringShort(), pnode->addr.ToString(), pmn->nPoSeBanScore);
         }
+        SnapshotChanged();
         if(!vpMasternodesToBan.empty())
             LogPrintf("CMasternodeMan::ProcessVerifyReply -- PoSe score increased for %d fake masternodes, addr %s\n",
                         (int)vpMasternodesToBan.size(), pnode->addr.ToString());
@@ -1293,6 +1388,7 @@ void CMasternodeMan::ProcessVerifyBroadcast(CNode* pnode, const CMasternodeVerif
             LogPrint("masternode", "CMasternodeMan::ProcessVerifyBroadcast -- increased PoSe ban score for %s addr %s, new score %d\n",
                         mnpair.first.ToStringShort(), mnpair.second.addr.ToString(), mnpair.second.nPoSeBanScore);
         }
+        SnapshotChanged();
         if(nCount)
             LogPrintf("CMasternodeMan::ProcessVerifyBroadcast -- PoSe score increased for %d fake masternodes, addr %s\n",
                         nCount, pmn1->addr.ToString());
@@ -1306,7 +1402,8 @@ std::string CMasternodeMan::ToString() const
     info << "Masternodes: " << (int)mapMasternodes.size() <<
             ", peers who asked us for Masternode list: " << (int)mAskedUsForMasternodeList.size() <<
             ", peers we asked for Masternode list: " << (int)mWeAskedForMasternodeList.size() <<
-            ", entries in Masternode list we asked for: " << (int)mWeAskedForMasternodeListEntry.size();
+            ", entries in Masternode list we asked for: " << (int)mWeAskedForMasternodeListEntry.size() <<
+            ", blocks in top Masternodes history: " << (int)mapHistoricalTopMNs.size();
 
     return info.str();
 }
@@ -1326,7 +1423,14 @@ void CMasternodeMan::UpdateMasternodeList(CMasternodeBroadcast mnb)
         }
     } else {
         CMasternodeBroadcast mnbOld = mapSeenMasternodeBroadcast[CMasternodeBroadcast(*pmn).GetHash()].second;
-        if(pmn->UpdateFromNewBroadcast(mnb)) {
+        // protocol version can be changed by the new broadcast
+        InvalidateRankCache();
+        SnapshotChanged();
+        // new broadcast resets masternode fees
+        RemoveFeeStats(*pmn);
+        const bool bUpdated = pmn->UpdateFromNewBroadcast(mnb);
+        AddFeeStats(*pmn);
+        if(bUpdated) {
             masterNodeCtrl.masternodeSync.BumpAssetLastTime("CMasternodeMan::UpdateMasternodeList - seen");
             mapSeenMasternodeBroadcast.erase(mnbOld.GetHash());
         }
@@ -1388,7 +1492,14 @@ bool CMasternodeMan::CheckMnbAndUpdateMasternodeList(CNode* pfrom, CMasternodeBr
         CMasternode* pmn = Find(mnb.vin.prevout);
         if(pmn) {
             CMasternodeBroadcast mnbOld = mapSeenMasternodeBroadcast[CMasternodeBroadcast(*pmn).GetHash()].second;
-            if(!mnb.Update(pmn, nDos)) {
+            // protocol version can be changed by the new broadcast
+            InvalidateRankCache();
+            SnapshotChanged();
+            // new broadcast resets masternode fees
+            RemoveFeeStats(*pmn);
+            const bool bUpdated = mnb.Update(pmn, nDos);
+            AddFeeStats(*pmn);
+            if(!bUpdated) {
                 LogPrint("masternode", "CMasternodeMan::CheckMnbAndUpdateMasternodeList -- Update() failed, masternode=%s\n", mnb.vin.prevout.ToStringShort());
                 return false;
             }
@@ -1440,9 +1551,15 @@ void CMasternodeMan::UpdateLastPaid(const CBlockIndex* pindex)
     // LogPrint("mnpayments", "CMasternodeMan::UpdateLastPaid -- nHeight=%d, nMaxBlocksToScanBack=%d, IsFirstRun=%s\n",
     //                         nCachedBlockHeight, nMaxBlocksToScanBack, IsFirstRun ? "true" : "false");
 
+    bool bLastPaidChanged = false;
     for (auto& mnpair: mapMasternodes) {
+        const int nPrevBlockLastPaid = mnpair.second.nBlockLastPaid;
         mnpair.second.UpdateLastPaid(pindex, nMaxBlocksToScanBack);
+        if (mnpair.second.nBlockLastPaid != nPrevBlockLastPaid)
+            bLastPaidChanged = true;
     }
+    if (bLastPaidChanged)
+        SnapshotChanged();
 
     IsFirstRun = false;
 }
@@ -1456,6 +1573,7 @@ void CMasternodeMan::UpdateWatchdogVoteTime(const COutPoint& outpoint, uint64_t
     }
     pmn->UpdateWatchdogVoteTime(nVoteTime);
     nLastWatchdogVoteTime = GetTime();
+    SnapshotChanged();
 }
 
 bool CMasternodeMan::IsWatchdogActive()
@@ -1470,7 +1588,10 @@ void CMasternodeMan::CheckMasternode(const CPubKey& pubKeyMasternode, bool fForc
     LOCK(cs);
     for (auto& mnpair : mapMasternodes) {
         if (mnpair.second.pubKeyMasternode == pubKeyMasternode) {
+            const int nPrevState = mnpair.second.nActiveState;
             mnpair.second.Check(fForce);
+            if (mnpair.second.nActiveState != nPrevState)
+                SnapshotChanged();
             return;
         }
     }
@@ -1479,7 +1600,7 @@ void CMasternodeMan::CheckMasternode(const CPubKey& pubKeyMasternode, bool fForc
 bool CMasternodeMan::IsMasternodePingedWithin(const COutPoint& outpoint, int nSeconds, int64_t nTimeToCheckAt)
 {
     LOCK(cs);
-    CMasternode* pmn = Find(outpoint);
+    const CMasternode* pmn = FindReadOnly(outpoint);
     return pmn ? pmn->IsPingedWithin(nSeconds, nTimeToCheckAt) : false;
 }
 
@@ -1491,6 +1612,7 @@ void CMasternodeMan::SetMasternodeLastPing(const COutPoint& outpoint, const CMas
         return;
     }
     pmn->lastPing = mnp;
+    SnapshotChanged();
     mapSeenMasternodePing.insert(std::make_pair(mnp.GetHash(), mnp));
 
     CMasternodeBroadcast mnb(*pmn);
@@ -1505,10 +1627,59 @@ void CMasternodeMan::SetMasternodeFee(const COutPoint& outpoint, const CAmount n
     LOCK(cs);
     CMasternode* pmn = Find(outpoint);
     if (pmn) {
+        m_StorageFeeStats.Update(pmn->aMNFeePerMB, newFee);
         pmn->aMNFeePerMB = newFee;
+        SnapshotChanged();
     }
 }
 
+void CMasternodeMan::AddFeeStats(const CMasternode& mn)
+{
+    m_StorageFeeStats.Add(mn.aMNFeePerMB);
+    m_NFTTicketFeeStats.Add(mn.aNFTTicketFeePerKB);
+}
+
+void CMasternodeMan::RemoveFeeStats(const CMasternode& mn)
+{
+    m_StorageFeeStats.Remove(mn.aMNFeePerMB);
+    m_NFTTicketFeeStats.Remove(mn.aNFTTicketFeePerKB);
+}
+
+void CMasternodeMan::RebuildFeeStats()
+{
+    LOCK(cs);
+    m_StorageFeeStats.Clear();
+    m_NFTTicketFeeStats.Clear();
+    for (const auto& [outpoint, mn] : mapMasternodes)
+        AddFeeStats(mn);
+}
+
+/**
+ * Get network storage fee per MB - trimmed mean (25%) of the fees reported by masternodes.
+ * 
+ * \param nDefaultFee - fee for masternodes that did not set the fee
+ * \return network storage fee per MB, nDefaultFee if masternode list is empty
+ */
+CAmount CMasternodeMan::GetNetworkFeePerMB(const CAmount nDefaultFee) const
+{
+    LOCK(cs);
+    if (m_StorageFeeStats.empty())
+        return nDefaultFee;
+    return static_cast<CAmount>(ceil(m_StorageFeeStats.GetTrimmedMean(0.25, nDefaultFee)));
+}
+
+/**
+ * Get NFT ticket fee per KB - mean of the fees reported by masternodes.
+ * 
+ * \param nDefaultFee - fee for masternodes that did not set the fee
+ * \return NFT ticket fee per KB, nDefaultFee if masternode list is empty
+ */
+CAmount CMasternodeMan::GetNFTTicketFeePerKB(const CAmount nDefaultFee) const
+{
+    LOCK(cs);
+    return m_NFTTicketFeeStats.GetMean(nDefaultFee);
+}
+
 void CMasternodeMan::UpdatedBlockTip(const CBlockIndex *pindex)
 {
     nCachedBlockHeight = pindex->nHeight;
@@ -1527,40 +1698,69 @@ void CMasternodeMan::UpdatedBlockTip(const CBlockIndex *pindex)
     if (topMNs.size() < masterNodeCtrl.nMasternodeTopMNsNumberMin) {
         LogPrintf("CMasternodeMan::UpdatedBlockTip -- ERROR: Failed to find enough Top MasterNodes\n");
     } else {
-        mapHistoricalTopMNs[nCachedBlockHeight] = topMNs;
+        const int64_t nHistoryBlocks = max<int64_t>(GetArg("-topmnhistory", DEFAULT_TOP_MN_HISTORY_BLOCKS), 1);
+        LOCK(cs);
+        mapHistoricalTopMNs[nCachedBlockHeight] = move(topMNs);
+        // remove top MNs for the blocks out of the history window
+        const int64_t nMinHeight = nCachedBlockHeight - nHistoryBlocks + 1;
+        if (nMinHeight > 0)
+            mapHistoricalTopMNs.erase(mapHistoricalTopMNs.begin(), mapHistoricalTopMNs.lower_bound(static_cast<int>(nMinHeight)));
     }
 }
 
-std::vector<CMasternode> CMasternodeMan::CalculateTopMNsForBlock(int nBlockHeight)
+CMasternodeMan::outpoint_vec_t CMasternodeMan::CalculateTopMNsForBlock(int nBlockHeight)
 {
+    const size_t nTopMNsNumber = static_cast<size_t>(masterNodeCtrl.nMasternodeTopMNsNumber);
+    outpoint_vec_t topMNs;
+    topMNs.reserve(nTopMNsNumber);
     rank_pair_vec_t vMasternodeRanks;
-    if (!GetMasternodeRanks(vMasternodeRanks, nBlockHeight) ||
-        vMasternodeRanks.size() < masterNodeCtrl.nMasternodeTopMNsNumberMin) {
-        LogPrintf("CMasternodeMan::CalculateTopMNsForBlock -- ERROR: Failed to find Top MasterNodes\n");
-        return std::vector<CMasternode>{};
-    }
-    
-    std::vector<CMasternode> topMNs;
-    for (auto mn : vMasternodeRanks){
-        if (mn.second.IsValidForPayment())
-            topMNs.push_back(mn.second);
-        if(topMNs.size() == masterNodeCtrl.nMasternodeTopMNsNumber)
+    // request only top ranks, double the number of ranks if not enough MNs are valid for payment
+    size_t nMaxCount = max<size_t>(nTopMNsNumber, 1);
+    while (true)
+    {
+        if (!GetMasternodeRanks(vMasternodeRanks, nBlockHeight, 0, nMaxCount) ||
+            vMasternodeRanks.size() < masterNodeCtrl.nMasternodeTopMNsNumberMin) {
+            LogPrintf("CMasternodeMan::CalculateTopMNsForBlock -- ERROR: Failed to find Top MasterNodes\n");
+            return outpoint_vec_t{};
+        }
+
+        LOCK(cs);
+        topMNs.clear();
+        for (const auto& [nRank, outpoint] : vMasternodeRanks)
+        {
+            auto pmn = FindReadOnly(outpoint);
+            if (pmn && pmn->IsValidForPayment())
+                topMNs.push_back(outpoint);
+            if (topMNs.size() == nTopMNsNumber)
+                break;
+        }
+        // stop if found enough top MNs or all masternodes are ranked
+        if (topMNs.size() == nTopMNsNumber || vMasternodeRanks.size() < nMaxCount)
             break;
+        nMaxCount *= 2;
     }
-
     return topMNs;
 }
 
-std::vector<CMasternode> CMasternodeMan::GetTopMNsForBlock(int nBlockHeight, bool bCalculateIfNotSeen)
+/**
+ * Get outpoints of the top masternodes for the given block.
+ * 
+ * \param nBlockHeight - block height, -1 - use active chain height
+ * \param bCalculateIfNotSeen - calculate top MNs if block is not found in the history
+ * \return outpoints of the top masternodes, ordered by rank
+ */
+CMasternodeMan::outpoint_vec_t CMasternodeMan::GetTopMNsForBlock(int nBlockHeight, bool bCalculateIfNotSeen)
 {
     if(nBlockHeight == -1) nBlockHeight = chainActive.Height();
     
-    auto it = mapHistoricalTopMNs.find(nBlockHeight);
-    if (it != mapHistoricalTopMNs.end()){
-        return it->second;
-    } else if (bCalculateIfNotSeen){
-        return CalculateTopMNsForBlock(nBlockHeight);
+    {
+        LOCK(cs);
+        auto it = mapHistoricalTopMNs.find(nBlockHeight);
+        if (it != mapHistoricalTopMNs.end())
+            return it->second;
     }
+    if (bCalculateIfNotSeen)
+        return CalculateTopMNsForBlock(nBlockHeight);
 
-    return std::vector<CMasternode>{};
+    return outpoint_vec_t{};
 }
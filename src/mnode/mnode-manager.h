@@ -3,27 +3,38 @@
 // Copyright (c) 2018-2021 The Pastel Core developers
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
 #include <map>
 #include <list>
 #include <set>
+#include <unordered_map>
 
 #include "net.h"
 #include "sync.h"
 
 #include "mnode/mnode-masternode.h"
+#include "mnode/mnode-fee-stats.h"
+#include "mnode/mnode-rank-cache.h"
 
 using namespace std;
 
+// default number of blocks to keep in the top masternodes history
+constexpr uint32_t DEFAULT_TOP_MN_HISTORY_BLOCKS = 2880;
 class CMasternodeMan
 {
 public:
-    typedef std::pair<arith_uint256, CMasternode*> score_pair_t;
-    typedef std::vector<score_pair_t> score_pair_vec_t;
-    typedef std::pair<int, CMasternode> rank_pair_t;
+    typedef CMasternodeRankCache::score_pair_t score_pair_t;
+    typedef CMasternodeRankCache::score_pair_vec_t score_pair_vec_t;
+    // masternode rank (starting from 1) and outpoint
+    typedef std::pair<int, COutPoint> rank_pair_t;
     typedef std::vector<rank_pair_t> rank_pair_vec_t;
+    typedef std::vector<COutPoint> outpoint_vec_t;
+    typedef std::map<COutPoint, CMasternode> masternode_map_t;
+    // immutable shared snapshot of the masternode list
+    typedef std::shared_ptr<const masternode_map_t> masternode_snapshot_t;
 
 private:
     static const std::string SERIALIZATION_VERSION_STRING;
@@ -51,7 +62,11 @@ private:
     int nCachedBlockHeight;
 
     // map to hold all MNs
-    std::map<COutPoint, CMasternode> mapMasternodes;
+    masternode_map_t mapMasternodes;
+    // read-only snapshot of mapMasternodes, republished under cs on the first read after the list change
+    mutable masternode_snapshot_t m_pSnapshot;
+    // true if mapMasternodes was changed after the snapshot was published
+    mutable std::atomic_bool m_bSnapshotChanged;
     // who's asked for the Masternode list and the last time
     std::map<CNetAddr, int64_t> mAskedUsForMasternodeList;
     // who we asked for the Masternode list and the last time
@@ -66,15 +81,37 @@ private:
     std::map<uint256, std::vector<CMasternodeBroadcast> > mMnbRecoveryGoodReplies;
     std::list< std::pair<CService, uint256> > listScheduledMnbRequestConnections;
     
-    std::map<int, std::vector<CMasternode>> mapHistoricalTopMNs;
+    // top masternodes history: block height -> outpoints of the top masternodes,
+    // keeps only last -topmnhistory blocks
+    std::map<int, outpoint_vec_t> mapHistoricalTopMNs;
     
     int64_t nLastWatchdogVoteTime;
 
+    typedef CMasternodeRankCache::mn_rank_cache_entry_t mn_rank_cache_entry_t;
+    // per-block masternode rank cache
+    CMasternodeRankCache m_RankCache;
+
     friend class CMasternodeSync;
+    friend class TestMasternodeRankCache; // class for unit testing
     /// Find an entry
     CMasternode* Find(const COutPoint& outpoint);
-
-    bool GetMasternodeScores(const uint256& nBlockHash, score_pair_vec_t& vecMasternodeScoresRet, int nMinProtocol = 0);
+    /// Find an entry for read-only access
+    const CMasternode* FindReadOnly(const COutPoint& outpoint) const;
+
+    // get scores entry for the block hash with at least nTopCount entries sorted by rank (0 - sort all)
+    mn_rank_cache_entry_t* GetMasternodeScores(const uint256& nBlockHash, const int nMinProtocol, const size_t nTopCount);
+    // invalidate rank cache, should be called on any change that can affect masternode scores
+    void InvalidateRankCache() noexcept { m_RankCache.Clear(); }
+    // mark masternode list snapshot as outdated, cs should be held
+    void SnapshotChanged() noexcept { m_bSnapshotChanged = true; }
+
+    // order statistics of the fees reported by masternodes, updated on any masternode fee change
+    CMasternodeFeeStats m_StorageFeeStats;    // storage fee per MB
+    CMasternodeFeeStats m_NFTTicketFeeStats;  // NFT ticket fee per KB
+    // add/remove masternode fees to/from the fee stats, cs should be held
+    void AddFeeStats(const CMasternode& mn);
+    void RemoveFeeStats(const CMasternode& mn);
+    void RebuildFeeStats();
 
 public:
     // Keep track of all broadcasts I've seen
@@ -111,10 +148,18 @@ public:
         READWRITE(mapSeenMasternodeBroadcast);
         READWRITE(mapSeenMasternodePing);
         
-        READWRITE(mapHistoricalTopMNs);
+        // top MNs history format was changed in Version-8, do not read it from the older versions
+        if (!bRead || (strVersion == SERIALIZATION_VERSION_STRING))
+            READWRITE(mapHistoricalTopMNs);
         
         if(bRead && (strVersion != SERIALIZATION_VERSION_STRING))
             Clear();
+        if (bRead)
+        {
+            RebuildFeeStats();
+            InvalidateRankCache();
+            SnapshotChanged();
+        }
     }
 
     CMasternodeMan();
@@ -165,9 +210,11 @@ public:
     /// Find a random entry
     masternode_info_t FindRandomNotInVec(const std::vector<COutPoint> &vecToExclude, int nProtocolVersion = -1);
 
-    auto GetFullMasternodeMap() const noexcept { return mapMasternodes; }
+    // get immutable snapshot of the masternode list, does not copy the list if it was not changed
+    masternode_snapshot_t GetMasternodeSnapshot() const;
 
-    bool GetMasternodeRanks(rank_pair_vec_t& vecMasternodeRanksRet, int nBlockHeight = -1, int nMinProtocol = 0);
+    // get masternode ranks for the block, only first nMaxCount ranks are returned (0 - all)
+    bool GetMasternodeRanks(rank_pair_vec_t& vecMasternodeRanksRet, int nBlockHeight = -1, int nMinProtocol = 0, const size_t nMaxCount = 0);
     bool GetMasternodeRank(const COutPoint &outpoint, int& nRankRet, int nBlockHeight = -1, int nMinProtocol = 0);
 
     void ProcessMasternodeConnections();
@@ -204,9 +251,13 @@ public:
     void SetMasternodeLastPing(const COutPoint& outpoint, const CMasternodePing& mnp);
 
     void SetMasternodeFee(const COutPoint& outpoint, const CAmount newFee);
+    // get network fees calculated from the fees reported by masternodes
+    CAmount GetNetworkFeePerMB(const CAmount nDefaultFee) const;
+    CAmount GetNFTTicketFeePerKB(const CAmount nDefaultFee) const;
 
     void UpdatedBlockTip(const CBlockIndex *pindex);
     
-    std::vector<CMasternode> GetTopMNsForBlock(int nBlockHeight = -1, bool bCalculateIfNotSeen = false);
-    std::vector<CMasternode> CalculateTopMNsForBlock(int nBlockHeight = -1);
+    // get outpoints of the top masternodes for the given block
+    outpoint_vec_t GetTopMNsForBlock(int nBlockHeight = -1, bool bCalculateIfNotSeen = false);
+    outpoint_vec_t CalculateTopMNsForBlock(int nBlockHeight = -1);
 };
@@ -380,7 +380,7 @@ void CMasternode::UpdateLastPaid(const CBlockIndex *pindex, int nMaxBlocksToScan
     // LogPrint("masternode", "CMasternode::UpdateLastPaidBlock -- searching for block with payment to %s -- keeping old %d\n", vin.prevout.ToStringShort(), nBlockLastPaid);
 }
 
-bool CMasternode::IsPoSeVerified()
+bool CMasternode::IsPoSeVerified() const
 {
     return nPoSeBanScore <= -masterNodeCtrl.MasternodePOSEBanMaxScore;
 }
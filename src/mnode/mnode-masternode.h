@@ -226,7 +226,7 @@ public:
     bool IsPreEnabled() const noexcept { return nActiveState == MASTERNODE_PRE_ENABLED; }
     bool IsPoSeBanned() const noexcept { return nActiveState == MASTERNODE_POSE_BAN; }
     // NOTE: this one relies on nPoSeBanScore, not on nActiveState as everything else here
-    bool IsPoSeVerified();
+    bool IsPoSeVerified() const;
     bool IsExpired() const noexcept { return nActiveState == MASTERNODE_EXPIRED; }
     bool IsOutpointSpent() const noexcept { return nActiveState == MASTERNODE_OUTPOINT_SPENT; }
     bool IsUpdateRequired() const noexcept { return nActiveState == MASTERNODE_UPDATE_REQUIRED; }
@@ -241,7 +241,7 @@ public:
                 nActiveStateIn == MASTERNODE_WATCHDOG_EXPIRED;
     }
 
-    bool IsValidForPayment() noexcept
+    bool IsValidForPayment() const noexcept
     {
         if(nActiveState == MASTERNODE_ENABLED) {
             return true;
@@ -132,8 +132,8 @@ std::string CMasternodeMessage::ToString() const
 
 void CMasternodeMessageProcessor::BroadcastNewFee(const CAmount newFee)
 {
-    const auto mapMasternodes = masterNodeCtrl.masternodeManager.GetFullMasternodeMap();
-    for (const auto& [op, mn] : mapMasternodes) {
+    const auto pMasternodes = masterNodeCtrl.masternodeManager.GetMasternodeSnapshot();
+    for (const auto& [op, mn] : *pMasternodes) {
         masterNodeCtrl.masternodeMessages.SendMessage(mn.pubKeyMasternode, CMasternodeMessageType::SETFEE, std::to_string(newFee));
     }
 }
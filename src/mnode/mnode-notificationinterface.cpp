@@ -28,7 +28,6 @@ void CACNotificationInterface::NotifyHeaderTip(const CBlockIndex *pindexNew, boo
 void CACNotificationInterface::UpdatedBlockTip(const CBlockIndex *pindexNew, bool fInitialDownload)
 {
     masterNodeCtrl.masternodeSync.UpdatedBlockTip(pindexNew, fInitialDownload);
-	masterNodeCtrl.masternodeTickets.UpdatedBlockTip(pindexNew, fInitialDownload);
 	
 	if (fInitialDownload) {
 		return;
@@ -38,3 +37,14 @@ void CACNotificationInterface::UpdatedBlockTip(const CBlockIndex *pindexNew, boo
 	masterNodeCtrl.masternodePayments.UpdatedBlockTip(pindexNew);
 	masterNodeCtrl.masternodeGovernance.UpdatedBlockTip(pindexNew);
 }
+
+void CACNotificationInterface::ChainTip(const CBlockIndex *pindex, const CBlock *pblock, SaplingMerkleTree saplingTree, bool added)
+{
+    // called for each connected or disconnected block with the block already in memory
+    if (!pblock)
+        return;
+    if (added)
+        masterNodeCtrl.masternodeTickets.ConnectBlock(pindex, *pblock);
+    else
+        masterNodeCtrl.masternodeTickets.DisconnectBlock(pindex, *pblock);
+}
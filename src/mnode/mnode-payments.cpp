@@ -583,7 +583,7 @@ void CMasternodePayments::CheckPreviousBlockVotes(int nPrevBlockHeight)
     debugStr += strprintf("CMasternodePayments::CheckPreviousBlockVotes -- nPrevBlockHeight=%d, expected voting MNs:\n", nPrevBlockHeight);
 
     CMasternodeMan::rank_pair_vec_t mns;
-    if (!masterNodeCtrl.masternodeManager.GetMasternodeRanks(mns, nPrevBlockHeight + masterNodeCtrl.nMasternodePaymentsVotersIndexDelta)) {
+    if (!masterNodeCtrl.masternodeManager.GetMasternodeRanks(mns, nPrevBlockHeight + masterNodeCtrl.nMasternodePaymentsVotersIndexDelta, 0, MNPAYMENTS_SIGNATURES_TOTAL)) {
         debugStr += "CMasternodePayments::CheckPreviousBlockVotes -- GetMasternodeRanks failed\n";
         LogPrint("mnpayments", "%s", debugStr);
         return;
@@ -605,7 +605,7 @@ void CMasternodePayments::CheckPreviousBlockVotes(int nPrevBlockHeight)
                         continue;
                     }
                     auto vote = mapMasternodePaymentVotes[voteHash];
-                    if (vote.vinMasternode.prevout == mn.second.vin.prevout) {
+                    if (vote.vinMasternode.prevout == mn.second) {
                         payee = vote.payee;
                         found = true;
                         break;
@@ -616,8 +616,8 @@ void CMasternodePayments::CheckPreviousBlockVotes(int nPrevBlockHeight)
 
         if (!found) {
             debugStr += strprintf("CMasternodePayments::CheckPreviousBlockVotes --   %s - no vote received\n",
-                                  mn.second.vin.prevout.ToStringShort());
-            mapMasternodesDidNotVote[mn.second.vin.prevout]++;
+                                  mn.second.ToStringShort());
+            mapMasternodesDidNotVote[mn.second]++;
             continue;
         }
 
@@ -627,7 +627,7 @@ void CMasternodePayments::CheckPreviousBlockVotes(int nPrevBlockHeight)
         std::string address = keyIO.EncodeDestination(dest);
 
         debugStr += strprintf("CMasternodePayments::CheckPreviousBlockVotes --   %s - voted for %s\n",
-                              mn.second.vin.prevout.ToStringShort(), address);
+                              mn.second.ToStringShort(), address);
     }
     debugStr += "CMasternodePayments::CheckPreviousBlockVotes -- Masternodes which missed a vote in the past:\n";
     for (auto it : mapMasternodesDidNotVote) {
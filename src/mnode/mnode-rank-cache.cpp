@@ -0,0 +1,30 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <algorithm>
+
+#include <mnode/mnode-rank-cache.h>
+
+using namespace std;
+
+/**
+ * Sort at least nTopCount scores of the cache entry by rank.
+ * Scores that are already sorted are not touched - all unsorted scores
+ * have lower rank than the sorted ones, so only the rest is sorted.
+ *
+ * \param entry - cache entry
+ * \param nTopCount - min number of the scores that should be sorted by rank (0 - sort all)
+ */
+void CMasternodeRankCache::SortScores(mn_rank_cache_entry_t& entry, const size_t nTopCount)
+{
+    const size_t nScores = entry.vScores.size();
+    const size_t nSortCount = (nTopCount == 0) ? nScores : min(nTopCount, nScores);
+    if (nSortCount <= entry.nSortedCount)
+        return;
+    const auto itSortedEnd = entry.vScores.begin() + entry.nSortedCount;
+    if (nSortCount == nScores)
+        sort(itSortedEnd, entry.vScores.end(), CompareScore());
+    else
+        partial_sort(itSortedEnd, entry.vScores.begin() + nSortCount, entry.vScores.end(), CompareScore());
+    entry.nSortedCount = nSortCount;
+}
@@ -0,0 +1,127 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <arith_uint256.h>
+#include <uint256.h>
+#include <primitives/transaction.h>
+
+// max number of block hashes to keep calculated masternode ranks for
+constexpr size_t MAX_MN_RANK_CACHE_SIZE = 10;
+
+struct COutPointHasher
+{
+    size_t operator()(const COutPoint& outpoint) const noexcept
+    {
+        return static_cast<size_t>(outpoint.hash.GetCheapHash() ^ outpoint.n);
+    }
+};
+
+/**
+ * Per-block cache of the masternode scores.
+ * Scores are sorted by rank lazily: top-N requests use partial sort,
+ * sorting is continued by the next requests with the higher N.
+ * Most recently used entries are kept at the front, the least recently used entry
+ * is dropped when the cache is full.
+ */
+class CMasternodeRankCache
+{
+public:
+    typedef std::pair<arith_uint256, COutPoint> score_pair_t;
+    typedef std::vector<score_pair_t> score_pair_vec_t;
+
+    // masternode scores calculated for the block hash, sorted by rank lazily
+    typedef struct _mn_rank_cache_entry_t
+    {
+        uint256 blockHash;
+        int nMinProtocol = 0;
+        // masternode scores, first nSortedCount entries are sorted by rank
+        score_pair_vec_t vScores;
+        size_t nSortedCount = 0;
+        // outpoint -> rank, filled in when all scores are sorted
+        std::unordered_map<COutPoint, int, COutPointHasher> mapRanks;
+        // false if some masternode score can change (collateral min conf block hash is not known yet)
+        bool bFinal = true;
+    } mn_rank_cache_entry_t;
+
+    // masternodes with higher score have higher rank (rank 1 is the highest one),
+    // masternodes with the same score are ordered by outpoint (higher outpoint - higher rank)
+    struct CompareScore
+    {
+        bool operator()(const score_pair_t& t1, const score_pair_t& t2) const
+        {
+            return (t1.first != t2.first) ? (t1.first > t2.first) : (t2.second < t1.second);
+        }
+    };
+
+    CMasternodeRankCache(const size_t nMaxSize = MAX_MN_RANK_CACHE_SIZE) noexcept :
+        m_nMaxSize(nMaxSize)
+    {}
+
+    template <typename F>
+    mn_rank_cache_entry_t* Get(const uint256& blockHash, const int nMinProtocol, const size_t nTopCount, F fnCalculateScores);
+    // drop all cached scores, should be called on any change that can affect masternode scores
+    void Clear() noexcept { m_Entries.clear(); }
+    size_t size() const noexcept { return m_Entries.size(); }
+    bool empty() const noexcept { return m_Entries.empty(); }
+
+    // sort at least nTopCount scores of the entry by rank (0 - sort all)
+    static void SortScores(mn_rank_cache_entry_t& entry, const size_t nTopCount);
+
+protected:
+    size_t m_nMaxSize;
+    // cache entries, most recently used entries at the front
+    std::list<mn_rank_cache_entry_t> m_Entries;
+};
+
+/**
+ * Get masternode scores for the block hash with at least nTopCount scores sorted by rank.
+ * Scores are calculated only if there is no cache entry for the block hash or
+ * some scores of the cached entry could change.
+ *
+ * \param blockHash - block hash to get masternode scores for
+ * \param nMinProtocol - min masternode protocol version
+ * \param nTopCount - min number of the scores that should be sorted by rank (0 - all)
+ * \param fnCalculateScores - functor to calculate scores: void f(mn_rank_cache_entry_t& entry),
+ *      fills in entry.vScores and resets entry.bFinal if some score can change
+ * \return cache entry with masternode scores or nullptr if no scores were calculated
+ */
+template <typename F>
+CMasternodeRankCache::mn_rank_cache_entry_t* CMasternodeRankCache::Get(const uint256& blockHash, const int nMinProtocol,
+    const size_t nTopCount, F fnCalculateScores)
+{
+    auto it = std::find_if(m_Entries.begin(), m_Entries.end(), [&](const mn_rank_cache_entry_t& entry)
+        {
+            return entry.blockHash == blockHash && entry.nMinProtocol == nMinProtocol;
+        });
+    if (it != m_Entries.end() && !it->bFinal)
+    {
+        // some scores could change, recalculate them
+        m_Entries.erase(it);
+        it = m_Entries.end();
+    }
+    if (it == m_Entries.end())
+    {
+        mn_rank_cache_entry_t entry;
+        entry.blockHash = blockHash;
+        entry.nMinProtocol = nMinProtocol;
+        fnCalculateScores(entry);
+        if (entry.vScores.empty())
+            return nullptr;
+        if (m_Entries.size() >= m_nMaxSize)
+            m_Entries.pop_back();
+        m_Entries.push_front(std::move(entry));
+        it = m_Entries.begin();
+    } else if (it != m_Entries.begin())
+        m_Entries.splice(m_Entries.begin(), m_Entries, it);
+
+    SortScores(*it, nTopCount);
+    return &(*it);
+}
@@ -14,17 +14,25 @@
 
 using namespace std;
 
-UniValue formatMnsInfo(const vector<CMasternode>& topBlockMNs)
+UniValue formatMnsInfo(const CMasternodeMan::outpoint_vec_t& topBlockMNs)
 {
     UniValue mnArray(UniValue::VARR);
 
     int i = 0;
     KeyIO keyIO(Params());
-    for (const auto& mn : topBlockMNs)
+    for (const auto& outpoint : topBlockMNs)
     {
         UniValue objItem(UniValue::VOBJ);
         objItem.pushKV("rank", strprintf("%d", ++i));
 
+        // top MNs history keeps only outpoints, masternode could be already removed from the list
+        CMasternode mn;
+        if (!masterNodeCtrl.masternodeManager.Get(outpoint, mn))
+        {
+            objItem.pushKV("outpoint", outpoint.ToStringShort());
+            mnArray.push_back(move(objItem));
+            continue;
+        }
         objItem.pushKV("IP:port", mn.addr.ToString());
         objItem.pushKV("protocol", (int64_t)mn.nProtocolVersion);
         objItem.pushKV("outpoint", mn.vin.prevout.ToStringShort());
@@ -119,15 +127,15 @@ Available modes:
         masterNodeCtrl.masternodeManager.GetMasternodeRanks(vMasternodeRanks);
         for (const auto& mnpair : vMasternodeRanks)
         {
-            string strOutpoint = mnpair.second.vin.prevout.ToStringShort();
+            string strOutpoint = mnpair.second.ToStringShort();
             if (!strFilter.empty() && strOutpoint.find(strFilter) == string::npos)
                 continue;
             obj.pushKV(strOutpoint, mnpair.first);
         }
     } else {
-        const auto mapMasternodes = masterNodeCtrl.masternodeManager.GetFullMasternodeMap();
+        const auto pMasternodes = masterNodeCtrl.masternodeManager.GetMasternodeSnapshot();
         const bool bShowAllNodes = strExtra == "allnode";
-        for (const auto& [outpoint, mn] : mapMasternodes)
+        for (const auto& [outpoint, mn] : *pMasternodes)
         {
             if( mn.IsNewStartRequired() && ! mn.IsPingedWithin(masterNodeCtrl.MNStartRequiredExpirationTime) && !bShowAllNodes ) 
             {
@@ -2,8 +2,12 @@
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or https://www.opensource.org/licenses/mit-license.php.
 
+#include <utilstrencodings.h>
+#include <rpc/protocol.h>
 #include "mnode/rpc/mnode-rpc-utils.h"
 
+using namespace std;
+
 int get_number(const UniValue& v)
 {
     return v.isStr() ? std::stoi(v.get_str()) : v.get_int();
@@ -13,3 +17,81 @@ long long get_long_number(const UniValue& v)
 {
     return v.isStr() ? std::stoll(v.get_str()) : (long long)v.get_int();
 }
+
+/**
+ * Extract optional paging parameter of the 'tickets list' and 'tickets find' rpcs.
+ * Paging parameter is the last rpc parameter - json object (or string with json object):
+ *   {
+ *      "limit": <max number of tickets>,
+ *      "start": "<primary key of the first ticket>",
+ *      "continuation": "<continuation token returned with the previous page>"
+ *   }
+ * 
+ * \param params - rpc parameters
+ * \param nMinParams - number of mandatory rpc parameters
+ * \param page - returns ticket page if paging parameter is defined
+ * \return rpc parameters without paging parameter
+ */
+UniValue extract_ticket_list_page(const UniValue& params, const size_t nMinParams, std::optional<ticket_list_page_t>& page)
+{
+    page.reset();
+    if (params.size() <= nMinParams)
+        return params;
+    const UniValue& lastParam = params[params.size() - 1];
+    UniValue pageParam(UniValue::VOBJ);
+    if (lastParam.isObject())
+        pageParam = lastParam;
+    else if (!lastParam.isStr() || lastParam.get_str().empty() || (lastParam.get_str().front() != '{') ||
+             !pageParam.read(lastParam.get_str()) || !pageParam.isObject())
+        return params;
+
+    ticket_list_page_t ticketPage;
+    const UniValue& limit = find_value(pageParam, "limit");
+    if (!limit.isNull())
+    {
+        const int nLimit = get_number(limit);
+        if (nLimit <= 0)
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid page limit, must be positive");
+        ticketPage.nLimit = static_cast<size_t>(nLimit);
+    }
+    const UniValue& start = find_value(pageParam, "start");
+    if (!start.isNull())
+        ticketPage.sStartKey = start.get_str();
+    const UniValue& continuation = find_value(pageParam, "continuation");
+    if (!continuation.isNull())
+    {
+        const string& sToken = continuation.get_str();
+        if (!IsHex(sToken))
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid continuation token");
+        const auto vKey = ParseHex(sToken);
+        ticketPage.sStartKey.assign(vKey.cbegin(), vKey.cend());
+    }
+    page = move(ticketPage);
+
+    UniValue retParams(UniValue::VARR);
+    for (size_t i = 0; i < params.size() - 1; ++i)
+        retParams.push_back(params[i]);
+    return retParams;
+}
+
+/**
+ * Create json object with the page of tickets:
+ *   {
+ *      "tickets": [ ... ],
+ *      "continuation": "<token to get the next page>" - only if there are more tickets
+ *   }
+ * 
+ * \param sTicketsJSON - json array with tickets
+ * \param page - ticket page
+ * \return json object
+ */
+UniValue ticket_list_page_to_json(const string& sTicketsJSON, const ticket_list_page_t& page)
+{
+    UniValue tickets(UniValue::VARR);
+    tickets.read(sTicketsJSON);
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("tickets", move(tickets));
+    if (!page.sNextKey.empty())
+        obj.pushKV("continuation", HexStr(page.sNextKey));
+    return obj;
+}
@@ -1,6 +1,14 @@
 #pragma once
 
+#include <optional>
+
 #include <univalue.h>
+#include <mnode/ticket-processor.h>
 
 int get_number(const UniValue& v);
 long long get_long_number(const UniValue& v);
+
+// extract optional paging parameter {"limit": n, "start": "key", "continuation": "token"} of the tickets rpcs
+UniValue extract_ticket_list_page(const UniValue& params, const size_t nMinParams, std::optional<ticket_list_page_t>& page);
+// create json object with the page of tickets and the continuation token
+UniValue ticket_list_page_to_json(const std::string& sTicketsJSON, const ticket_list_page_t& page);
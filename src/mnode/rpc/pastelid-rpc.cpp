@@ -5,7 +5,9 @@
 #include "pastelid/pastel_key.h"
 #include "rpc/rpc_parser.h"
 #include "rpc/rpc_consts.h"
+#include "rpc/server.h"
 #include "mnode/rpc/pastelid-rpc.h"
+#include "mnode/rpc/mnode-rpc-utils.h"
 
 using namespace std;
 
@@ -122,6 +124,60 @@ Verify "text"'s "signature" with with the private key associated with the Pastel
     return resultObj;
 }
 
+UniValue pastelid_verifybatch(const UniValue& params)
+{
+    if (params.size() != 2)
+        throw JSONRPCError(RPC_INVALID_PARAMETER,
+R"(pastelid verify-batch [{"text": "text", "signature": "signature", "pastelid": "PastelID", "algorithm": "algorithm"},...]
+Verify multiple "text"'s "signature"s with the public keys associated with the PastelIDs (algorithm: ed448 [default] or legroast).
+Signatures are verified in parallel.)");
+
+    UniValue items;
+    if (params[1].isStr())
+    {
+        if (!items.read(params[1].get_str()))
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Failed to parse signatures json array");
+    } else
+        items = params[1];
+    if (!items.isArray())
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Signatures should be passed as json array");
+
+    const size_t nCount = items.size();
+    // texts are kept separately - verify_item_t does not own the text
+    v_strings vTexts(nCount);
+    vector<CPastelID::verify_item_t> vItems(nCount);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const UniValue& obj = items[i];
+        if (!obj.isObject())
+            throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("Signature #%zu should be json object", i));
+        vTexts[i] = find_value(obj, "text").get_str();
+        auto& item = vItems[i];
+        item.psText = &vTexts[i];
+        item.sSignature = find_value(obj, "signature").get_str();
+        item.sPastelID = find_value(obj, "pastelid").get_str();
+        const UniValue& alg = find_value(obj, "algorithm");
+        const string sAlgorithm = alg.isNull() ? "" : alg.get_str();
+        item.alg = CPastelID::GetAlgorithmByName(sAlgorithm);
+        if (item.alg == CPastelID::SIGN_ALGORITHM::not_defined)
+            throw runtime_error(strprintf("Signing algorithm '%s' is not supported", sAlgorithm));
+        item.fBase64 = true;
+    }
+
+    v_strings vErrors;
+    const v_bools vResults = CPastelID::VerifyBatch(vItems, &vErrors);
+    UniValue resultArray(UniValue::VARR);
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        UniValue resultObj(UniValue::VOBJ);
+        resultObj.pushKV("verification", vResults[i] ? "OK" : "Failed");
+        if (!vErrors[i].empty())
+            resultObj.pushKV("error", vErrors[i]);
+        resultArray.push_back(move(resultObj));
+    }
+    return resultArray;
+}
+
 UniValue pastelid_signbykey(const UniValue& params)
 {
     if (params.size() != 4)
@@ -170,6 +226,52 @@ strprintf(R"(pastelid passwd "PastelID" "old_passphrase" "new_passphrase"
     return resultObj;
 }
 
+UniValue pastelid_unlock(const UniValue& params)
+{
+    if (params.size() != 4)
+        throw JSONRPCError(RPC_INVALID_PARAMETER,
+R"(pastelid unlock "PastelID" "passphrase" timeout
+Keep decrypted private keys associated with the PastelID in memory for 'timeout' seconds (max 100000000).
+"sign" with the same passphrase does not need to decrypt secure container during this time.
+Issuing "unlock" while PastelID is already unlocked will set a new unlock time that overrides the old one.)");
+
+    string sPastelID(params[1].get_str());
+    SecureString strKeyPass(params[2].get_str());
+    if (strKeyPass.empty())
+        throw runtime_error(
+R"(pastelid unlock "PastelID" <"passphrase"> timeout
+passphrase for the private key cannot be empty!)");
+    // timeout range is checked in CPastelID::Unlock before the timer is created
+    const int64_t nTimeout = get_long_number(params[3]);
+
+    string error;
+    if (!CPastelID::Unlock(error, sPastelID, move(strKeyPass), nTimeout))
+        throw runtime_error(error);
+    // lock PastelID after timeout, replaces previous timer for this PastelID
+    RPCRunLater("lockpastelid_" + sPastelID, [sPastelID]() { CPastelID::Lock(sPastelID); }, nTimeout);
+
+    UniValue resultObj(UniValue::VOBJ);
+    resultObj.pushKV(RPC_KEY_RESULT, RPC_RESULT_SUCCESS);
+    resultObj.pushKV("unlocked_until", pastelIDSessionStore.GetUnlockedUntil(sPastelID));
+    return resultObj;
+}
+
+UniValue pastelid_lock(const UniValue& params)
+{
+    if (params.size() > 2)
+        throw JSONRPCError(RPC_INVALID_PARAMETER,
+R"(pastelid lock ("PastelID")
+Remove decrypted private keys associated with the PastelID from memory (all PastelIDs if not specified).)");
+
+    if (params.size() == 2)
+        CPastelID::Lock(params[1].get_str());
+    else
+        pastelIDSessionStore.LockAll();
+    UniValue resultObj(UniValue::VOBJ);
+    resultObj.pushKV(RPC_KEY_RESULT, RPC_RESULT_SUCCESS);
+    return resultObj;
+}
+
 /**
  * pastelid RPC command.
  * 
@@ -179,7 +281,7 @@ strprintf(R"(pastelid passwd "PastelID" "old_passphrase" "new_passphrase"
  */
 UniValue pastelid(const UniValue& params, bool fHelp)
 {
-    RPC_CMD_PARSER(PASTELID, params, newkey, importkey, list, sign, sign__by__key, verify, passwd);
+    RPC_CMD_PARSER(PASTELID, params, newkey, importkey, list, sign, sign__by__key, verify, verify__batch, passwd, unlock, lock);
 
     if (fHelp || !PASTELID.IsCmdSupported())
         throw runtime_error(
@@ -201,7 +303,10 @@ Available commands:
   sign "text" "PastelID" "passphrase" ("algorithm")   - Sign "text" with the internally stored private key associated with the PastelID (algorithm: ed448 or legroast).
   sign-by-key "text" "key" "passphrase"               - Sign "text" with the private "key" (EdDSA448) as PKCS8 encrypted string in PEM format.
   verify "text" "signature" "PastelID" ("algorithm")  - Verify "text"'s "signature" with the private key associated with the PastelID (algorithm: ed448 or legroast).
+  verify-batch [{"text":...},...]                     - Verify multiple signatures in parallel, each item is json object with "text", "signature", "pastelid" and optional "algorithm".
   passwd "PastelID" "old_passphrase" "new_passphrase" - Change passphrase used to encrypt the secure container associated with the PastelID.
+  unlock "PastelID" "passphrase" timeout              - Keep decrypted private keys associated with the PastelID in memory for 'timeout' seconds.
+  lock ("PastelID")                                   - Remove decrypted private keys associated with the PastelID (or all PastelIDs) from memory.
 )");
 
     UniValue result(UniValue::VOBJ);
@@ -234,10 +339,24 @@ Available commands:
         result = pastelid_verify(params);
         break;
 
+    // verify multiple signatures in parallel
+    case RPC_CMD_PASTELID::verify__batch: // verify-batch
+        result = pastelid_verifybatch(params);
+        break;
+
     case RPC_CMD_PASTELID::passwd:
         result = pastelid_passwd(params);
         break;
 
+    // start signing session for the PastelID
+    case RPC_CMD_PASTELID::unlock:
+        result = pastelid_unlock(params);
+        break;
+
+    case RPC_CMD_PASTELID::lock:
+        result = pastelid_lock(params);
+        break;
+
     default:
         break;
     } // switch PASTELID.cmd()
@@ -6,9 +6,14 @@
 #include <mnode/tickets/tickets-all.h>
 #include <mnode/rpc/tickets-find.h>
 #include <rpc/server.h>
+#include <mnode/mnode-controller.h>
+#include <mnode/rpc/mnode-rpc-utils.h>
+
+static std::string mvkey_to_string(const std::string& key) { return key; }
+static std::string mvkey_to_string(const int key) { return std::to_string(key); }
 
 template <class T, class T2 = const std::string&, typename Lambda = std::function<std::vector<T>(T2)>>
-static UniValue getTickets(const std::string& key, T2 key2 = "", Lambda otherFunc = nullptr)
+static UniValue getTickets(const std::string& key, T2 key2 = "", Lambda otherFunc = nullptr, ticket_list_page_t* pPage = nullptr)
 {
     T ticket;
     if (T::FindTicketInDb(key, ticket))
@@ -17,6 +22,18 @@ static UniValue getTickets(const std::string& key, T2 key2 = "", Lambda otherFun
         obj.read(ticket.ToJSON());
         return obj;
     }
+    if (pPage)
+    {
+        // list one page of tickets directly from the ticket DB: by PastelID first, then by the second key
+        auto& tickets = masterNodeCtrl.masternodeTickets;
+        std::string sMVKey = key;
+        if (!tickets.HasTicketsByMVKey(T::GetID(), sMVKey) && otherFunc != nullptr)
+            sMVKey = mvkey_to_string(key2);
+        if (!tickets.HasTicketsByMVKey(T::GetID(), sMVKey))
+            return "Key is not found";
+        // key exists - return page object even if the page is empty
+        return ticket_list_page_to_json(tickets.ListTicketsByMVKey<T>(sMVKey, pPage), *pPage);
+    }
     auto tickets = T::FindAllTicketByPastelID(key);
     if (tickets.empty() && otherFunc != nullptr)
         tickets = otherFunc(key2);
@@ -32,14 +49,19 @@ static UniValue getTickets(const std::string& key, T2 key2 = "", Lambda otherFun
     return "Key is not found";
 }
 
-UniValue tickets_find(const UniValue& params)
+UniValue tickets_find(const UniValue& rpcParams)
 {
+    // optional paging parameter is always the last one
+    std::optional<ticket_list_page_t> page;
+    const UniValue params = extract_ticket_list_page(rpcParams, 3, page);
+    ticket_list_page_t* pPage = page.has_value() ? &page.value() : nullptr;
+
     RPC_CMD_PARSER2(FIND, params, id, nft, act, sell, buy, trade, 
         down, royalty, username, ethereumaddress, action, action__act);
 
     if (!FIND.IsCmdSupported())
         throw JSONRPCError(RPC_INVALID_PARAMETER,
-R"(tickets find "type" "key""
+R"(tickets find "type" "key" ({"limit": n, "start": "key", "continuation": "token"})
 Set of commands to find different types of Pastel tickets.
 
 Available types:
@@ -72,6 +94,8 @@ Available types:
 
 Arguments:
 1. "key"    (string, required) The Key to use for ticket search. See types above...
+2. paging   (json object, optional) If defined and multiple tickets found - returns only one page of tickets.
+            See 'tickets list' for paging parameter and result format.
 
 Example: Find id ticket
 )" + HelpExampleCli("tickets find id", "jXYqZNPj21RVnwxnEJ654wEdzi7GZTZ5LAdiotBmPrF7pDMkpX1JegDMQZX55WZLkvy9fxNpZcbBJuE8QYUqBF") +
@@ -93,22 +117,22 @@ As json rpc
     } break;
 
     case RPC_CMD_FIND::nft:
-        return getTickets<CNFTRegTicket>(key);
+        return getTickets<CNFTRegTicket>(key, "", {}, pPage);
 
     case RPC_CMD_FIND::act:
-        return getTickets<CNFTActivateTicket, int>(key, atoi(key), CNFTActivateTicket::FindAllTicketByCreatorHeight);
+        return getTickets<CNFTActivateTicket, int>(key, atoi(key), CNFTActivateTicket::FindAllTicketByCreatorHeight, pPage);
 
     case RPC_CMD_FIND::sell:
-        return getTickets<CNFTSellTicket>(key, key, CNFTSellTicket::FindAllTicketByNFTTxnID);
+        return getTickets<CNFTSellTicket>(key, key, CNFTSellTicket::FindAllTicketByNFTTxnID, pPage);
 
     case RPC_CMD_FIND::buy:
-        return getTickets<CNFTBuyTicket>(key);
+        return getTickets<CNFTBuyTicket>(key, "", {}, pPage);
 
     case RPC_CMD_FIND::trade:
-        return getTickets<CNFTTradeTicket>(key);
+        return getTickets<CNFTTradeTicket>(key, "", {}, pPage);
 
     case RPC_CMD_FIND::royalty:
-        return getTickets<CNFTRoyaltyTicket>(key);
+        return getTickets<CNFTRoyaltyTicket>(key, "", {}, pPage);
 
     case RPC_CMD_FIND::down: {
         //            CTakeDownTicket ticket;
@@ -135,10 +159,10 @@ As json rpc
     } break;
 
     case RPC_CMD_FIND::action: 
-        return getTickets<CActionRegTicket>(key);
+        return getTickets<CActionRegTicket>(key, "", {}, pPage);
 
     case RPC_CMD_FIND::action__act:
-        return getTickets<CActionActivateTicket, int>(key, atoi(key), CActionActivateTicket::FindAllTicketByCalledAtHeight);
+        return getTickets<CActionActivateTicket, int>(key, atoi(key), CActionActivateTicket::FindAllTicketByCalledAtHeight, pPage);
 
     default:
         break;
@@ -9,12 +9,33 @@
 #include "mnode/rpc/mnode-rpc-utils.h"
 #include "mnode/rpc/tickets-list.h"
 
-UniValue tickets_list(const UniValue& params)
+/**
+ * List all tickets of the specific type.
+ * If nMinHeight is defined - uses height index to list only tickets registered at or after this height.
+ * 
+ * \param nMinHeight - min ticket block height
+ * \param pPage - optional page of tickets to list
+ * \return json array with tickets
+ */
+template <class _TicketType>
+static std::string listAllTickets(const int nMinHeight, ticket_list_page_t* pPage)
 {
+    if (nMinHeight > 0)
+        return masterNodeCtrl.masternodeTickets.ListTicketsByHeight<_TicketType>(static_cast<uint32_t>(nMinHeight), pPage);
+    return masterNodeCtrl.masternodeTickets.ListTickets<_TicketType>(pPage);
+}
+
+UniValue tickets_list(const UniValue& rpcParams)
+{
+    // optional paging parameter is always the last one
+    std::optional<ticket_list_page_t> page;
+    const UniValue params = extract_ticket_list_page(rpcParams, 2, page);
+    ticket_list_page_t* pPage = page.has_value() ? &page.value() : nullptr;
+
     RPC_CMD_PARSER2(LIST, params, id, nft, act, sell, buy, trade, down, royalty, username, ethereumaddress, action, action__act);
     if ((params.size() < 2 || params.size() > 4) || !LIST.IsCmdSupported())
         throw JSONRPCError(RPC_INVALID_PARAMETER,
-R"(tickets list "type" ("filter") ("minheight")
+R"(tickets list "type" ("filter") ("minheight") ({"limit": n, "start": "key", "continuation": "token"})
 List all tickets of the specific type registered in the system
 
 Available types:
@@ -74,10 +95,25 @@ Available types:
 
 Arguments:
 1. minheight	 - minimum height for returned tickets (only tickets registered after this height will be returned).
+                 Applied when listing all tickets of the type, tickets are returned in the block height order.
+2. paging        - optional json object, always the last parameter. If defined - returns only one page of tickets:
+    {
+        "limit": n,             - max number of tickets in the page
+        "start": "key",         - primary key of the first ticket in the page
+        "continuation": "token" - continuation token returned with the previous page
+    }
+    Returns json object:
+    {
+        "tickets": [ ... ],     - tickets of the page
+        "continuation": "token" - token to get the next page, not returned for the last page
+    }
 
 Example: List ALL PastelID tickets
 )" + HelpExampleCli("tickets list id", "") +
 R"(
+Example: List first 100 NFT tickets
+)" + HelpExampleCli("tickets list nft", R"(all '{"limit": 100}')") +
+R"(
 As json rpc
 )" + HelpExampleRpc("tickets", R"("list", "id")"));
 
@@ -93,39 +129,39 @@ As json rpc
         && LIST.cmd() != RPC_CMD_LIST::sell)                   // RPC_CMD_LIST::sell has its own parsing logic
         minheight = get_number(params[3]);
 
-    UniValue obj(UniValue::VARR);
+    std::string sTicketsJSON;
     switch (LIST.cmd()) {
     case RPC_CMD_LIST::id:
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CPastelIDRegTicket>());
+            sTicketsJSON = listAllTickets<CPastelIDRegTicket>(minheight, pPage);
         else if (filter == "mn")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterPastelIDTickets(1));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterPastelIDTickets(1, nullptr, pPage);
         else if (filter == "personal")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterPastelIDTickets(2));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterPastelIDTickets(2, nullptr, pPage);
         else if (filter == "mine") {
             const auto mapIDs = CPastelID::GetStoredPastelIDs(true);
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterPastelIDTickets(3, &mapIDs));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterPastelIDTickets(3, &mapIDs, pPage);
         }
         break;
 
     case RPC_CMD_LIST::nft:
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CNFTRegTicket>());
+            sTicketsJSON = listAllTickets<CNFTRegTicket>(minheight, pPage);
         else if (filter == "active")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterNFTTickets(1));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterNFTTickets(1, pPage);
         else if (filter == "inactive")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterNFTTickets(2));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterNFTTickets(2, pPage);
         else if (filter == "sold")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterNFTTickets(3));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterNFTTickets(3, pPage);
         break;
 
     case RPC_CMD_LIST::act:
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CNFTActivateTicket>());
+            sTicketsJSON = listAllTickets<CNFTActivateTicket>(minheight, pPage);
         else if (filter == "available")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterActTickets(1));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterActTickets(1, pPage);
         else if (filter == "sold")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterActTickets(2));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterActTickets(2, pPage);
         break;
 
     case RPC_CMD_LIST::sell: {
@@ -156,15 +192,15 @@ As json rpc
             }
         }
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterSellTickets(0, pastelID));
+            sTicketsJSON = pastelID.empty() ? listAllTickets<CNFTSellTicket>(minheight, pPage) : masterNodeCtrl.masternodeTickets.ListFilterSellTickets(0, pastelID, pPage);
         else if (filter == "available")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterSellTickets(1, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterSellTickets(1, pastelID, pPage);
         else if (filter == "unavailable")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterSellTickets(2, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterSellTickets(2, pastelID, pPage);
         else if (filter == "expired")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterSellTickets(3, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterSellTickets(3, pastelID, pPage);
         else if (filter == "sold")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterSellTickets(4, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterSellTickets(4, pastelID, pPage);
         break;
     }
 
@@ -196,11 +232,11 @@ As json rpc
             }
         }
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterBuyTickets(0, pastelID));
+            sTicketsJSON = pastelID.empty() ? listAllTickets<CNFTBuyTicket>(minheight, pPage) : masterNodeCtrl.masternodeTickets.ListFilterBuyTickets(0, pastelID, pPage);
         else if (filter == "expired")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterBuyTickets(1, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterBuyTickets(1, pastelID, pPage);
         else if (filter == "sold")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterBuyTickets(2, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterBuyTickets(2, pastelID, pPage);
         break;
     }
 
@@ -232,49 +268,54 @@ As json rpc
             }
         }
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterTradeTickets(0, pastelID));
+            sTicketsJSON = pastelID.empty() ? listAllTickets<CNFTTradeTicket>(minheight, pPage) : masterNodeCtrl.masternodeTickets.ListFilterTradeTickets(0, pastelID, pPage);
         else if (filter == "available")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterTradeTickets(1, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterTradeTickets(1, pastelID, pPage);
         else if (filter == "sold")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterTradeTickets(2, pastelID));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterTradeTickets(2, pastelID, pPage);
         break;
     }
 
     case RPC_CMD_LIST::royalty: {
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CNFTRoyaltyTicket>());
+            sTicketsJSON = listAllTickets<CNFTRoyaltyTicket>(minheight, pPage);
         break;
     }
 
     case RPC_CMD_LIST::username: {
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CChangeUsernameTicket>());
+            sTicketsJSON = listAllTickets<CChangeUsernameTicket>(minheight, pPage);
         break;
     }
 
     case RPC_CMD_LIST::ethereumaddress: {
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CChangeEthereumAddressTicket>());
+            sTicketsJSON = listAllTickets<CChangeEthereumAddressTicket>(minheight, pPage);
         break;
     }
 
     case RPC_CMD_LIST::action:
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CActionRegTicket>());
+            sTicketsJSON = listAllTickets<CActionRegTicket>(minheight, pPage);
         else if (filter == "active")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterActionTickets(1));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterActionTickets(1, pPage);
         else if (filter == "inactive")
-            obj.read(masterNodeCtrl.masternodeTickets.ListFilterActionTickets(2));
+            sTicketsJSON = masterNodeCtrl.masternodeTickets.ListFilterActionTickets(2, pPage);
         break;
 
     case RPC_CMD_LIST::action__act:
         if (filter == "all")
-            obj.read(masterNodeCtrl.masternodeTickets.ListTickets<CActionActivateTicket>());
+            sTicketsJSON = listAllTickets<CActionActivateTicket>(minheight, pPage);
         break;
 
     default:
         break;
     } // switch RPC_CMD_LIST::cmd()
 
+    if (pPage)
+        return ticket_list_page_to_json(sTicketsJSON.empty() ? "[]" : sTicketsJSON, *pPage);
+    UniValue obj(UniValue::VARR);
+    if (!sTicketsJSON.empty())
+        obj.read(sTicketsJSON);
     return obj;
 }
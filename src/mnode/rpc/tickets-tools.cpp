@@ -258,11 +258,9 @@ inline namespace ns
  */
 void from_json(const json &j, search_thumbids_t& p)
 {
-    // mandatory creator PastelId - will throw json::exception if does not exist
-    if (!j.contains("creator"))
-        throw nlohmann::detail::other_error::create(500, "'creator' parameter not found", j);
-
-    j["creator"].get_to(p.sCreatorPastelId);
+    // optional creator PastelId - search across all creators if not defined
+    if (j.contains("creator"))
+        j["creator"].get_to(p.sCreatorPastelId);
     // other fields are optional
     const auto DeserializeRangeParam = [&](
         const char* szParamName,                 // parameter name: param: [min, max]
@@ -318,7 +316,8 @@ void from_json(const json &j, search_thumbids_t& p)
 
 void to_json(json& j, const search_thumbids_t& p)
 {
-    j["creator"] = p.sCreatorPastelId;
+    if (!p.sCreatorPastelId.empty())
+        j["creator"] = p.sCreatorPastelId;
     const auto addRange = [&](const char *szName, const optional<numeric_range<uint32_t>>& rng) 
     {
         if (!rng.has_value())
@@ -347,21 +346,17 @@ UniValue thumbids_search(const search_thumbids_t &p)
     /**
      * matchedNftTicket function is called when the NFT registration ticket has been found that matches all search criterias.
      * 
-     * \param pTicket - pointer to NFT registration ticket (CNFTRegTicket)
-     * \param jNftAppTicket - parsed json "app ticket" from 'NFT Reg Ticket'
+     * \param sRegTxId - NFT registration ticket txid
+     * \param props - NFT registration ticket search properties
      * \return result array count (to break iterating through the tickets when result limit has been reached)
      */
-    function<size_t(const CPastelTicket*, const json&)> matchedNftTicket = [&](const CPastelTicket* pTicket, const json& jNftAppTicket) -> size_t
+    function<size_t(const string&, const CNFTSearchProps&)> matchedNftTicket = [&](const string& sRegTxId, const CNFTSearchProps& props) -> size_t
     {
-        const CNFTRegTicket* pNftTicket = dynamic_cast<const CNFTRegTicket*>(pTicket);
-        if (!pNftTicket)
-            return resultArray.size();
-        if (!jNftAppTicket.contains("thumbnail_hash"))
+        if (props.sThumbnailHash.empty())
             return resultArray.size();
-        string sThumbHash = jNftAppTicket["thumbnail_hash"];
         UniValue matchObj(UniValue::VOBJ);
-        matchObj.pushKV("txid", pNftTicket->GetTxId());
-        matchObj.pushKV("thumbnail_hash", move(sThumbHash));
+        matchObj.pushKV("txid", sRegTxId);
+        matchObj.pushKV("thumbnail_hash", props.sThumbnailHash);
         resultArray.push_back(move(matchObj));
         return resultArray.size();
     };
@@ -382,6 +377,8 @@ Arguments:
 {
     "creator": "creator-pastel-id", // return nft registered by the creator with this exact PastelID
                                     // this can have a special value - "mine"
+                                    // optional, if not defined - search across all creators
+                                    // (fuzzy terms of at least 3 characters use the trigram index)
     "blocks": [min, max],           // return nft with "min <= nft activation ticket block number <= max"
     "copies": [min, max],           // return nft with "min <= number of created copies <= max"
     "rareness_score": [min, max],   // return tickets with "min <= rareness_score <= max" (0 to 1000)
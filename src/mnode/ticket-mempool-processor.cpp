@@ -13,68 +13,18 @@ CPastelTicketMemPoolProcessor::CPastelTicketMemPoolProcessor(const TicketID tick
 
 /**
  * Initialize Pastel ticket mempool processor.
+ * Tickets are parsed and indexed by the mempool tracker when transactions are accepted to the mempool,
+ * so no mempool transactions are re-parsed here.
  * throws std::runtime_error in case of any errors
  * 
  * \param pool - transaction memory pool (you can pass default global mempool)
  * \param pMemPoolTracker - memory pool tracker, if not passed - default one is used from CPastelTicketProcessor class
  */
-void CPastelTicketMemPoolProcessor::Initialize(const CTxMemPool& pool, std::shared_ptr<ITxMemPoolTracker> pMemPoolTracker)
+void CPastelTicketMemPoolProcessor::Initialize([[maybe_unused]] const CTxMemPool& pool, std::shared_ptr<ITxMemPoolTracker> pMemPoolTracker)
 {
-    auto pTracker = dynamic_pointer_cast<CTicketTxMemPoolTracker>(pMemPoolTracker ? pMemPoolTracker : CPastelTicketProcessor::GetTxMemPoolTracker());
-    if (!pTracker)
+    m_pTracker = dynamic_pointer_cast<CTicketTxMemPoolTracker>(pMemPoolTracker ? pMemPoolTracker : CPastelTicketProcessor::GetTxMemPoolTracker());
+    if (!m_pTracker)
         throw runtime_error("Failed to get Pastel memory pool tracker for ticket transactions");
-
-    // vector of transaction hashes (txids) for the specified ticket id
-    v_uint256 vTxid;
-    pTracker->getTicketTransactions(m_TicketID, vTxid);
-
-    if (vTxid.empty())
-        return;
-    // get real transactions from the memory pool
-    // we may not get some of them - as they can be accepted already to the blockchain
-    vector<CMutableTransaction> vTx;
-    v_uints vBlockHeight;
-    pool.batch_lookup(vTxid, vTx, vBlockHeight);
-    if (vTx.size() != vBlockHeight.size())
-        throw runtime_error("Failed to retrieve ticket transactions from the memory pool");
-
-    CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
-    string error;
-    // parse P2FMS transactions and create tickets
-    size_t i = 0;
-    for (const auto& tx : vTx)
-    {
-        TicketID id;
-        data_stream.clear();
-        if (!CPastelTicketProcessor::preParseTicket(tx, data_stream, id, error))
-        {
-            LogPrint("mempool", "Failed to parse P2FMS transaction '%s'. %s\n", tx.GetHash().ToString(), error);
-            ++i;
-            continue;
-        }
-        if (id != m_TicketID)
-        {
-            LogPrint("mempool", "P2FMS transaction '%s': ticket id '%s' does not match '%s'. %s\n",
-                        tx.GetHash().ToString(), GetTicketDescription(id), GetTicketDescription(m_TicketID), error);
-            ++i;
-            continue;
-        }
-        auto ticket = CPastelTicketProcessor::CreateTicket(id);
-        if (!ticket)
-        {
-            LogPrint("mempool", "P2FMS transaction '%s': unknown ticket id %hhu\n",
-                        tx.GetHash().ToString(), to_integral_type<TicketID>(id));
-            ++i;
-            continue;
-        }
-        // deserialize ticket
-        data_stream >> *ticket;
-        // set additional ticket transaction data
-        ticket->SetTxId(tx.GetHash().ToString());
-        ticket->SetBlock(vBlockHeight[i]);
-        m_vTicket.emplace_back(move(ticket));
-        ++i;
-    }
 }
 
 /**
@@ -85,16 +35,7 @@ void CPastelTicketMemPoolProcessor::Initialize(const CTxMemPool& pool, std::shar
  */
 bool CPastelTicketMemPoolProcessor::TicketExists(const std::string& sKeyOne) const noexcept
 {
-    bool bRet = false;
-    for (const auto& tkt : m_vTicket)
-    {
-        if (sKeyOne == tkt->KeyOne())
-        {
-            bRet = true;
-            break;
-        }
-    }
-    return bRet;
+    return m_pTracker && m_pTracker->findTicket(m_TicketID, sKeyOne);
 }
 
 /**
@@ -105,16 +46,34 @@ bool CPastelTicketMemPoolProcessor::TicketExists(const std::string& sKeyOne) con
  */
 bool CPastelTicketMemPoolProcessor::TicketExistsBySecondaryKey(const std::string& sKeyTwo) const noexcept
 {
-    bool bRet = false;
-    for (const auto& tkt : m_vTicket)
+    return m_pTracker && m_pTracker->findTicketBySecondaryKey(m_TicketID, sKeyTwo);
+}
+
+/**
+ * Append copies of the mempool tickets to the ticket vector.
+ * Mempool tickets are shared with other processors and can't be modified,
+ * so each ticket is copied.
+ * 
+ * \param vTicket - ticket vector to append copies to
+ * \param vMemPoolTicket - mempool tickets
+ * \param psKeyTwo - optional secondary key filter
+ * \return true if at least one ticket was appended
+ */
+bool CPastelTicketMemPoolProcessor::appendTicketCopies(PastelTickets_t& vTicket, const mempool_tickets_t& vMemPoolTicket,
+    const std::string* psKeyTwo) const noexcept
+{
+    bool bAdded = false;
+    for (const auto& tkt : vMemPoolTicket)
     {
-        if (sKeyTwo == tkt->KeyTwo())
-        {
-            bRet = true;
-            break;
-        }
+        if (psKeyTwo && (*psKeyTwo != tkt->KeyTwo()))
+            continue;
+        auto ticket = CPastelTicketProcessor::CloneTicket(*tkt);
+        if (!ticket)
+            continue;
+        vTicket.emplace_back(move(ticket));
+        bAdded = true;
     }
-    return bRet;
+    return bAdded;
 }
 
 /**
@@ -122,21 +81,32 @@ bool CPastelTicketMemPoolProcessor::TicketExistsBySecondaryKey(const std::string
  * 
  * \param vTicket - returns ticket vector
  * \param sKeyOne - KeyOne filter
+ * \param psKeyTwo - optional KeyTwo filter
  * \return true if we found at least one ticket
  */
 bool CPastelTicketMemPoolProcessor::ListTickets(PastelTickets_t& vTicket, const std::string& sKeyOne, const std::string* psKeyTwo) const noexcept
 {
-    for (const auto& tkt : m_vTicket)
-    {
-        if (sKeyOne == tkt->KeyOne())
-        {
-            if (psKeyTwo && (*psKeyTwo != tkt->KeyTwo()))
-                continue;
-            vTicket.emplace_back(CPastelTicketProcessor::CreateTicket(m_TicketID));
-            if (vTicket.back())
-                vTicket.back().reset(tkt.get());
-        }
-    }
-    return !vTicket.empty();
+    if (!m_pTracker)
+        return false;
+    mempool_tickets_t vMemPoolTicket;
+    if (!m_pTracker->listTickets(m_TicketID, sKeyOne, vMemPoolTicket))
+        return false;
+    return appendTicketCopies(vTicket, vMemPoolTicket, psKeyTwo);
 }
 
+/**
+ * List tickets by multi-value key.
+ * 
+ * \param vTicket - returns ticket vector
+ * \param sMVKey - multi-value key filter
+ * \return true if we found at least one ticket
+ */
+bool CPastelTicketMemPoolProcessor::ListTicketsByMVKey(PastelTickets_t& vTicket, const std::string& sMVKey) const noexcept
+{
+    if (!m_pTracker)
+        return false;
+    mempool_tickets_t vMemPoolTicket;
+    if (!m_pTracker->listTicketsByMVKey(m_TicketID, sMVKey, vMemPoolTicket))
+        return false;
+    return appendTicketCopies(vTicket, vMemPoolTicket, nullptr);
+}
@@ -5,6 +5,7 @@
 
 #include <txmempool.h>
 #include <mnode/ticket-processor.h>
+#include <mnode/ticket-txmempool.h>
 
 class CPastelTicketMemPoolProcessor
 {
@@ -23,44 +24,24 @@ public:
     template <typename _TicketType>
     bool FindTicket(_TicketType& ticket) const noexcept
     {
-        const auto sKey = ticket.KeyOne();
-        bool bRet = false;
-        for (const auto& tkt : m_vTicket)
-        {
-            if (sKey == tkt->KeyOne())
-            {
-                ticket = *dynamic_cast<_TicketType*>(tkt.get());
-                bRet = true;
-                break;
-            }
-        }
-        return bRet;
+        if (!m_pTracker)
+            return false;
+        return copyTicket(m_pTracker->findTicket(m_TicketID, ticket.KeyOne()), ticket);
     }
 
     /**
      * Find Pastel ticket by secondary key.
-     * Uses ticket.KeyOne() as a search key.
+     * Uses ticket.KeyTwo() as a search key.
      * 
      * \param ticket - returns ticket if found
-     * \return - true if ticket was found by primary key
+     * \return - true if ticket was found by secondary key
      */
     template <typename _TicketType>
     bool FindTicketBySecondaryKey(_TicketType& ticket) const noexcept
     {
-        if (!ticket.HasKeyTwo())
+        if (!m_pTracker || !ticket.HasKeyTwo())
             return false;
-        const std::string sKeyTwo = ticket.KeyTwo();
-        bool bRet = false;
-        for (const auto& tkt : m_vTicket)
-        {
-            if (sKeyTwo == tkt->KeyTwo())
-            {
-                ticket = *dynamic_cast<_TicketType*>(tkt.get());
-                bRet = true;
-                break;
-            }
-        }
-        return bRet;
+        return copyTicket(m_pTracker->findTicketBySecondaryKey(m_TicketID, ticket.KeyTwo()), ticket);
     }
     // check if ticket exists by primary key
     bool TicketExists(const std::string& sKeyOne) const noexcept;
@@ -68,9 +49,22 @@ public:
     bool TicketExistsBySecondaryKey(const std::string& sKeyTwo) const noexcept;
     // list tickets by primary key (and optional secondary key)
     bool ListTickets(PastelTickets_t& vTicket, const std::string& sKeyOne, const std::string *psKeyTwo = nullptr) const noexcept;
+    // list tickets by multi-value key
+    bool ListTicketsByMVKey(PastelTickets_t& vTicket, const std::string& sMVKey) const noexcept;
 
 protected: 
     TicketID m_TicketID; 
-    // tickets in mempool with m_TicketID
-    PastelTickets_t m_vTicket;
+    // ticket mempool tracker with parsed & indexed mempool tickets
+    std::shared_ptr<CTicketTxMemPoolTracker> m_pTracker;
+
+    template <typename _TicketType>
+    static bool copyTicket(const mempool_ticket_t& pTicket, _TicketType& ticket) noexcept
+    {
+        const auto pTypedTicket = dynamic_cast<const _TicketType*>(pTicket.get());
+        if (!pTypedTicket)
+            return false;
+        ticket = *pTypedTicket;
+        return true;
+    }
+    bool appendTicketCopies(PastelTickets_t& vTicket, const mempool_tickets_t& vMemPoolTicket, const std::string* psKeyTwo) const noexcept;
 };
@@ -3,6 +3,10 @@
 // file COPYING or https://www.opensource.org/licenses/mit-license.php.
 
 #include <cinttypes>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <json/json.hpp>
 
 #if defined(HAVE_CONFIG_H)
@@ -20,11 +24,28 @@
 #include <mnode/mnode-controller.h>
 #include <mnode/ticket-processor.h>
 #include <mnode/ticket-txmempool.h>
+#include <mnode/ticket-validation-cache.h>
+#include <pastelid/pubkey_cache.h>
 
 using json = nlohmann::json;
 using namespace std;
 
 static shared_ptr<ITxMemPoolTracker> TicketTxMemPoolTracker;
+// value stored for the composite multi-value key, all data is in the key itself
+constexpr uint8_t TICKET_MVKEY_VALUE = 1;
+// ticket undo DB key prefix: <DB_TICKET_UNDO, block height> -> CTicketBlockUndo
+constexpr char DB_TICKET_UNDO = 'u';
+// ticket undo DB key for the last block indexed in the ticket DBs -> <height, block hash>
+constexpr char DB_TICKET_TIP = 'T';
+// max number of decoded tickets kept in the trading chain cache
+constexpr size_t MAX_TRADING_CHAIN_CACHE_SIZE = 10'000;
+// P2FMS fake key data chunk: pointer to the output script data and chunk size
+using p2fms_chunk_t = pair<const unsigned char*, size_t>;
+
+// cache of the decoded confirmed tickets referenced by the NFT trading chains: txid -> ticket,
+// cleared when any block with tickets is disconnected from the active chain
+static mutex csTradingChainCache;
+static unordered_map<string, shared_ptr<const CPastelTicket>> mapTradingChainCache;
 
 /**
  * Get height of the active blockchain + 1.
@@ -50,9 +71,493 @@ void CPastelTicketProcessor::InitTicketDB()
     nTotalCache = min(nTotalCache, nMaxDbCache << 20); // total cache cannot be greater than nMaxDbCache
     const uint64_t nTicketDBCache = nTotalCache / 8 / uint8_t(TicketID::COUNT);
 
+    const string sDBVersionKey(TICKET_DB_VERSION_KEY);
+    // rebuild all ticket DBs on -reindex or -reindextickets
+    const bool bWipe = fReindex || GetBoolArg("-reindextickets", false);
+    undoDB = make_unique<CDBWrapper>(ticketsDir / "undo", nTicketDBCache, false, bWipe);
+    bool bEmpty = true;
     // create DB for each ticket type
     for (uint8_t id = to_integral_type<TicketID>(TicketID::PastelID); id != to_integral_type<TicketID>(TicketID::COUNT); ++id)
-        dbs.emplace(static_cast<TicketID>(id), make_unique<CDBWrapper>(ticketsDir / TICKET_INFO[id].szDBSubFolder, nTicketDBCache, false, fReindex));
+    {
+        auto pDB = make_unique<CDBWrapper>(ticketsDir / TICKET_INFO[id].szDBSubFolder, nTicketDBCache, false, bWipe);
+        uint32_t nDBVersion = 0;
+        if (!pDB->Read(sDBVersionKey, nDBVersion) || (nDBVersion < TICKET_DB_VERSION))
+        {
+            if (!pDB->IsEmpty())
+            {
+                LogPrintf("Upgrading '%s' ticket DB from v%u to v%u...\n", TICKET_INFO[id].szDescription, nDBVersion, TICKET_DB_VERSION);
+                if (nDBVersion < 1)
+                {
+                    const size_t nUpgraded = UpgradeDB_MVK(*pDB);
+                    LogPrintf("'%s' ticket DB: %zu multi-value keys converted\n", TICKET_INFO[id].szDescription, nUpgraded);
+                }
+                if (nDBVersion < 2)
+                {
+                    const size_t nIndexed = UpgradeDB_HeightIndex(*pDB, static_cast<TicketID>(id));
+                    LogPrintf("'%s' ticket DB: %zu tickets added to the height index\n", TICKET_INFO[id].szDescription, nIndexed);
+                }
+                if ((nDBVersion < 6) && (static_cast<TicketID>(id) == TicketID::NFT))
+                {
+                    const size_t nExtracted = UpgradeDB_NFTSearchProps(*pDB);
+                    LogPrintf("'%s' ticket DB: search properties extracted for %zu tickets\n", TICKET_INFO[id].szDescription, nExtracted);
+                }
+                if ((nDBVersion < 5) && (static_cast<TicketID>(id) == TicketID::Trade))
+                {
+                    const size_t nCopies = UpgradeDB_NFTOwnership(*pDB);
+                    LogPrintf("'%s' ticket DB: %zu NFT copies added to the ownership index\n", TICKET_INFO[id].szDescription, nCopies);
+                }
+                bEmpty = false;
+            }
+            pDB->Write(sDBVersionKey, TICKET_DB_VERSION, true);
+        } else
+            bEmpty = false;
+        dbs.emplace(static_cast<TicketID>(id), move(pDB));
+    }
+
+    pair<int, uint256> tip;
+    if (undoDB->Read(DB_TICKET_TIP, tip))
+    {
+        nTicketDBHeight = tip.first;
+        hashTicketDBTip = tip.second;
+    }
+    else if (!bEmpty)
+    {
+        // ticket DBs created by the previous version do not have tip record -
+        // they were updated on each active chain tip change, so assume they are in sync with the active chain
+        LOCK(cs_main);
+        setTicketDBTip(chainActive.Tip(), true);
+    } else // new ticket DBs - all blocks should be indexed
+        undoDB->Write(DB_TICKET_TIP, make_pair(nTicketDBHeight, uint256()), true);
+}
+
+/**
+ * Build height index for all tickets in the ticket DB.
+ * 
+ * \param db - ticket DB
+ * \param id - ticket type
+ * \return number of tickets added to the height index
+ */
+size_t CPastelTicketProcessor::UpgradeDB_HeightIndex(CDBWrapper& db, const TicketID id)
+{
+    size_t nIndexed = 0;
+    CDBBatch batch(db);
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->SeekToFirst();
+    string sKey;
+    auto ticket = CreateTicket(id);
+    if (!ticket)
+        return 0;
+    while (pcursor->Valid())
+    {
+        sKey.clear();
+        // skip secondary, multi-value and service keys
+        if (pcursor->GetKey(sKey) && !sKey.empty() && (sKey.front() != '@') && pcursor->GetValue(*ticket))
+        {
+            batch.Write(CTicketHeightKey(ticket->GetBlock(), sKey), TICKET_MVKEY_VALUE);
+            ++nIndexed;
+        }
+        pcursor->Next();
+    }
+    if (nIndexed)
+        db.WriteBatch(batch, true);
+    return nIndexed;
+}
+
+/**
+ * Extract search properties for all NFT registration tickets in the NFT ticket DB.
+ * Search properties and trigram index are rebuilt - existing entries are removed first,
+ * including entries left by the overwritten NFT registration tickets.
+ * 
+ * \param db - NFT ticket DB
+ * \return number of tickets with extracted search properties
+ */
+size_t CPastelTicketProcessor::UpgradeDB_NFTSearchProps(CDBWrapper& db)
+{
+    size_t nExtracted = 0;
+    CDBBatch batch(db);
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    // all search properties keys start with the serialized prefix string
+    ticket_mvkey_t propsKey;
+    pcursor->Seek(string(NFT_SEARCH_PROPS_KEY_PREFIX));
+    while (pcursor->Valid() && pcursor->GetKey(propsKey) && (propsKey.first == NFT_SEARCH_PROPS_KEY_PREFIX))
+    {
+        batch.Erase(propsKey);
+        pcursor->Next();
+    }
+    CNFTTrigramKey trigramKey;
+    pcursor->Seek(string(NFT_TRIGRAM_KEY_PREFIX));
+    while (pcursor->Valid() && pcursor->GetKey(trigramKey) && trigramKey.IsValid())
+    {
+        batch.Erase(trigramKey);
+        pcursor->Next();
+    }
+    string sKey;
+    pcursor->SeekToFirst();
+    while (pcursor->Valid())
+    {
+        sKey.clear();
+        CNFTRegTicket ticket;
+        // skip secondary, multi-value and service keys
+        if (pcursor->GetKey(sKey) && !sKey.empty() && (sKey.front() != '@') && pcursor->GetValue(ticket))
+        {
+            updateNFTSearchProps(ticket, batch);
+            ++nExtracted;
+        }
+        pcursor->Next();
+    }
+    if (nExtracted)
+        db.WriteBatch(batch, true);
+    return nExtracted;
+}
+
+/**
+ * Build NFT ownership index for all trade tickets in the NFT trade ticket DB.
+ * Owner of each NFT copy is defined by the trade ticket with the highest block height.
+ * 
+ * \param db - NFT trade ticket DB
+ * \return number of NFT copies added to the ownership index
+ */
+size_t CPastelTicketProcessor::UpgradeDB_NFTOwnership(CDBWrapper& db)
+{
+    // <NFT registration txid, copy serial number> -> current copy owner
+    map<pair<string, string>, CNFTCopyOwner> mapOwners;
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->SeekToFirst();
+    string sKey;
+    while (pcursor->Valid())
+    {
+        sKey.clear();
+        CNFTTradeTicket ticket;
+        // skip secondary, multi-value and service keys
+        if (pcursor->GetKey(sKey) && !sKey.empty() && (sKey.front() != '@') && pcursor->GetValue(ticket) &&
+            !ticket.GetNFTRegTicketTxid().empty())
+        {
+            auto &owner = mapOwners[make_pair(ticket.GetNFTRegTicketTxid(), ticket.GetCopySerialNr())];
+            if (owner.sTradeTxId.empty() || (ticket.GetBlock() >= owner.nHeight))
+            {
+                owner.sOwnerPastelID = ticket.getPastelID();
+                owner.sTradeTxId = ticket.GetTxId();
+                owner.nHeight = ticket.GetBlock();
+            }
+        }
+        pcursor->Next();
+    }
+    if (mapOwners.empty())
+        return 0;
+    CDBBatch batch(db);
+    for (const auto& [copyKey, owner] : mapOwners)
+        batch.Write(NFTOwnershipKey(copyKey.first, copyKey.second), owner);
+    db.WriteBatch(batch, true);
+    return mapOwners.size();
+}
+
+/**
+ * Set the owner of the NFT copy traded by the trade ticket in the NFT trade ticket DB batch.
+ * Does nothing for other ticket types.
+ * 
+ * \param ticket - ticket added to the ticket DB
+ * \param batch - NFT trade ticket DB batch
+ */
+void CPastelTicketProcessor::updateNFTOwnership(const CPastelTicket& ticket, CDBBatch& batch)
+{
+    if (ticket.ID() != TicketID::Trade)
+        return;
+    const auto pTradeTicket = dynamic_cast<const CNFTTradeTicket*>(&ticket);
+    if (!pTradeTicket || pTradeTicket->GetNFTRegTicketTxid().empty())
+        return;
+    CNFTCopyOwner owner;
+    owner.sOwnerPastelID = pTradeTicket->getPastelID();
+    owner.sTradeTxId = ticket.GetTxId();
+    owner.nHeight = ticket.GetBlock();
+    batch.Write(NFTOwnershipKey(pTradeTicket->GetNFTRegTicketTxid(), pTradeTicket->GetCopySerialNr()), owner);
+}
+
+/**
+ * Restore the owner of the NFT copy traded by the reverted trade ticket.
+ * Previous owner is defined by the trade ticket the reverted ticket refers to (NFTTxnId),
+ * if it refers to the activation ticket - copy was not traded before and ownership record is removed.
+ * 
+ * \param sKeyOne - primary key of the reverted trade ticket
+ * \param db - NFT trade ticket DB
+ * \param batch - NFT trade ticket DB batch
+ */
+void CPastelTicketProcessor::undoNFTOwnership(const string& sKeyOne, const CDBWrapper& db, CDBBatch& batch) const
+{
+    CNFTTradeTicket tradeTicket;
+    if (!db.Read(sKeyOne, tradeTicket) || tradeTicket.GetNFTRegTicketTxid().empty())
+        return;
+    const auto ownershipKey = NFTOwnershipKey(tradeTicket.GetNFTRegTicketTxid(), tradeTicket.GetCopySerialNr());
+    bool bRestored = false;
+    // look for the previous trade ticket of this copy among the trade tickets of the NFT
+    processMVKeys(db, tradeTicket.GetNFTRegTicketTxid(), [&](const string& sPrimaryKey) -> bool
+        {
+            CNFTTradeTicket prevTicket;
+            if (db.Read(sPrimaryKey, prevTicket) && prevTicket.IsTxId(tradeTicket.NFTTxnId))
+            {
+                updateNFTOwnership(prevTicket, batch);
+                bRestored = true;
+                return false;
+            }
+            return true;
+        });
+    if (!bRestored)
+        batch.Erase(ownershipKey);
+}
+
+/**
+ * Get current owners of all traded copies of the NFT.
+ * 
+ * \param sRegTxId - NFT registration ticket txid
+ * \param mapOwners - returns map: copy serial number -> current copy owner
+ * \return number of traded NFT copies
+ */
+size_t CPastelTicketProcessor::GetNFTCopyOwners(const string& sRegTxId, map<string, CNFTCopyOwner>& mapOwners) const
+{
+    mapOwners.clear();
+    const auto itDB = dbs.find(TicketID::Trade);
+    if (itDB == dbs.cend())
+        return 0;
+    unique_ptr<CDBIterator> pcursor(itDB->second->NewIterator());
+    // all copies of the NFT are stored under the same <"@O@", NFT registration txid> key prefix
+    pcursor->Seek(make_pair(string(NFT_OWNERSHIP_KEY_PREFIX), sRegTxId));
+    nft_ownership_key_t key;
+    while (pcursor->Valid())
+    {
+        if (!pcursor->GetKey(key) || (key.first != NFT_OWNERSHIP_KEY_PREFIX) || (key.second.first != sRegTxId))
+            break;
+        CNFTCopyOwner owner;
+        if (pcursor->GetValue(owner))
+            mapOwners.emplace(key.second.second, move(owner));
+        pcursor->Next();
+    }
+    return mapOwners.size();
+}
+
+/**
+ * Add search properties and trigram index of the NFT registration ticket to the NFT ticket DB batch.
+ * Does nothing for other ticket types.
+ * 
+ * \param ticket - ticket added to the ticket DB
+ * \param batch - NFT ticket DB batch
+ */
+void CPastelTicketProcessor::updateNFTSearchProps(const CPastelTicket& ticket, CDBBatch& batch)
+{
+    if (ticket.ID() != TicketID::NFT)
+        return;
+    const auto pNftTicket = dynamic_cast<const CNFTRegTicket*>(&ticket);
+    if (!pNftTicket)
+        return;
+    CNFTSearchProps props;
+    string error;
+    if (!props.Extract(*pNftTicket, error))
+        LogPrint("tickets", "failed to extract search properties for NFT registration ticket (%s). %s\n", ticket.GetTxId(), error);
+    batch.Write(NFTSearchPropsKey(ticket.GetTxId()), props);
+    for (const auto& trigram : props.GetIndexTrigrams())
+        batch.Write(CNFTTrigramKey(trigram, ticket.GetTxId()), TICKET_MVKEY_VALUE);
+}
+
+/**
+ * Remove search properties and trigram index of the NFT registration ticket stored
+ * in the NFT ticket DB under the primary key sKeyOne.
+ * Used when the ticket is reverted or overwritten by the ticket with the same primary key.
+ * 
+ * \param sKeyOne - primary key of the NFT registration ticket
+ * \param db - NFT ticket DB
+ * \param batch - NFT ticket DB batch
+ */
+void CPastelTicketProcessor::eraseNFTSearchProps(const string& sKeyOne, const CDBWrapper& db, CDBBatch& batch) const
+{
+    CNFTRegTicket nftTicket;
+    if (!db.Read(sKeyOne, nftTicket))
+        return;
+    const auto propsKey = NFTSearchPropsKey(nftTicket.GetTxId());
+    CNFTSearchProps props;
+    if (db.Read(propsKey, props))
+    {
+        for (const auto& trigram : props.GetIndexTrigrams())
+            batch.Erase(CNFTTrigramKey(trigram, nftTicket.GetTxId()));
+    }
+    batch.Erase(propsKey);
+}
+
+/**
+ * Get search properties of the NFT registration ticket.
+ * 
+ * \param sRegTxId - NFT registration ticket txid
+ * \param props - returns NFT search properties
+ * \return true if search properties were found
+ */
+bool CPastelTicketProcessor::GetNFTSearchProps(const string& sRegTxId, CNFTSearchProps& props) const
+{
+    const auto itDB = dbs.find(TicketID::NFT);
+    if (itDB == dbs.cend())
+        return false;
+    return itDB->second->Read(NFTSearchPropsKey(sRegTxId), props);
+}
+
+/**
+ * Find NFT registration tickets using fuzzy search trigram index.
+ * Returns txids of the tickets that can pass all fuzzy search filters using trigram index:
+ * fuzzy search property value contains all trigrams of the filter value or
+ * property has no string value (such properties are skipped or checked in the app ticket by the search).
+ * This is a superset of the matching tickets - filters should be checked by the caller.
+ * 
+ * \param vFuzzyFilters - fuzzy search filters: <app ticket property name, lowercased filter value>
+ * \param setRegTxIds - returns NFT registration ticket txids
+ * \return false if none of the filters can use trigram index (unknown property or filter value is too short)
+ */
+bool CPastelTicketProcessor::findNFTsByTrigrams(const vector<pair<string, string>>& vFuzzyFilters, set<string>& setRegTxIds) const
+{
+    setRegTxIds.clear();
+    const auto itDB = dbs.find(TicketID::NFT);
+    bool bIndexUsed = false;
+    set<string> setFilterTxIds;
+    for (const auto& [sPropName, sFilterValue] : vFuzzyFilters)
+    {
+        const int nPropIndex = CNFTSearchProps::GetFuzzyPropIndex(sPropName);
+        if (nPropIndex < 0)
+            continue;
+        nft_trigram_set_t setTrigrams;
+        CNFTSearchProps::AddTrigrams(static_cast<uint8_t>(nPropIndex), sFilterValue, setTrigrams);
+        if (setTrigrams.empty())
+            continue;
+        if (itDB == dbs.cend())
+            return true;
+        findNFTsByFilterTrigrams(*itDB->second, setTrigrams, setFilterTxIds);
+        if (bIndexUsed)
+        {
+            // keep only txids found for all filters
+            for (auto it = setRegTxIds.begin(); it != setRegTxIds.end();)
+            {
+                if (setFilterTxIds.count(*it))
+                    ++it;
+                else
+                    it = setRegTxIds.erase(it);
+            }
+        } else
+            setRegTxIds.swap(setFilterTxIds);
+        bIndexUsed = true;
+        if (setRegTxIds.empty())
+            break;
+    }
+    return bIndexUsed;
+}
+
+/**
+ * Find NFT registration tickets for one fuzzy search filter using trigram index.
+ * Txids for each trigram are stored together and sorted, all posting lists are
+ * iterated in turn until the shortest one ends - cost is proportional to the size of the shortest list.
+ * Txids of the shortest list are then checked in the other lists with point lookups.
+ * NFTs without string value of the property (empty trigram) are added to the result.
+ * 
+ * \param db - NFT ticket DB
+ * \param setTrigrams - trigrams of the filter value (same property index)
+ * \param setRegTxIds - returns NFT registration ticket txids
+ */
+void CPastelTicketProcessor::findNFTsByFilterTrigrams(const CDBWrapper& db, const nft_trigram_set_t& setTrigrams, set<string>& setRegTxIds)
+{
+    setRegTxIds.clear();
+    if (setTrigrams.empty())
+        return;
+    const vector<nft_trigram_t> vTrigrams(setTrigrams.cbegin(), setTrigrams.cend());
+    const size_t nListCount = vTrigrams.size();
+    CNFTTrigramKey key;
+    // read next txid of the trigram posting list, returns false if the list has ended
+    auto readNext = [&](CDBIterator& cursor, const nft_trigram_t& trigram) -> bool
+    {
+        return cursor.Valid() && cursor.GetKey(key) && key.IsValid() &&
+            (key.nPropIndex == trigram.first) && (key.sTrigram == trigram.second);
+    };
+
+    vector<unique_ptr<CDBIterator>> vCursors;
+    vCursors.reserve(nListCount);
+    for (const auto& trigram : vTrigrams)
+    {
+        vCursors.emplace_back(db.NewIterator());
+        // all txids for the trigram are stored together, empty txid is the first one
+        vCursors.back()->Seek(CNFTTrigramKey(trigram, ""));
+    }
+    vector<v_strings> vTxIds(nListCount);
+    size_t nShortest = nListCount;
+    while (nShortest == nListCount)
+    {
+        for (size_t i = 0; i < nListCount; ++i)
+        {
+            if (!readNext(*vCursors[i], vTrigrams[i]))
+            {
+                nShortest = i;
+                break;
+            }
+            vTxIds[i].emplace_back(move(key.sRegTxId));
+            vCursors[i]->Next();
+        }
+    }
+    vCursors.clear();
+    for (auto& sTxId : vTxIds[nShortest])
+    {
+        bool bFound = true;
+        for (size_t i = 0; i < nListCount; ++i)
+        {
+            if ((i != nShortest) && !db.Exists(CNFTTrigramKey(vTrigrams[i], sTxId)))
+            {
+                bFound = false;
+                break;
+            }
+        }
+        if (bFound)
+            setRegTxIds.insert(move(sTxId));
+    }
+
+    // NFTs without string value of the property
+    const nft_trigram_t noValueTrigram(vTrigrams.front().first, "");
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->Seek(CNFTTrigramKey(noValueTrigram, ""));
+    while (readNext(*pcursor, noValueTrigram))
+    {
+        setRegTxIds.insert(move(key.sRegTxId));
+        pcursor->Next();
+    }
+}
+
+/**
+ * Convert legacy multi-value keys into composite keys.
+ * Legacy format: "@M@<mvkey>" -> serialized vector of primary keys.
+ * New format: <"@M@<mvkey>", primary key> -> empty value, one record per primary key.
+ * 
+ * \param db - ticket DB to upgrade
+ * \return number of converted legacy multi-value keys
+ */
+size_t CPastelTicketProcessor::UpgradeDB_MVK(CDBWrapper& db)
+{
+    const string sMVKeyPrefix = RealMVKey("");
+    size_t nUpgraded = 0;
+    CDBBatch batch(db);
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->SeekToFirst();
+    string sKey;
+    v_strings vMainKeys;
+    while (pcursor->Valid())
+    {
+        sKey.clear();
+        // composite keys start with the same serialized string - 
+        // legacy key is the one that consists of this string only
+        if (pcursor->GetKey(sKey) && (sKey.compare(0, sMVKeyPrefix.size(), sMVKeyPrefix) == 0) &&
+            (pcursor->GetKeySize() == GetSerializeSize(sKey, SER_DISK, CLIENT_VERSION)))
+        {
+            vMainKeys.clear();
+            if (pcursor->GetValue(vMainKeys))
+            {
+                for (const auto& sMainKey : vMainKeys)
+                    batch.Write(make_pair(sKey, sMainKey), TICKET_MVKEY_VALUE);
+            }
+            batch.Erase(sKey);
+            ++nUpgraded;
+        }
+        pcursor->Next();
+    }
+    if (nUpgraded)
+        db.WriteBatch(batch, true);
+    return nUpgraded;
 }
 
 /**
@@ -119,73 +624,577 @@ unique_ptr<CPastelTicket> CPastelTicketProcessor::CreateTicket(const TicketID ti
     return ticket;
 }
 
-void CPastelTicketProcessor::UpdatedBlockTip(const CBlockIndex* cBlockIndex, bool fInitialDownload)
+/**
+ * Index tickets of the block connected to the active chain.
+ * Block is already validated and loaded - tickets are parsed directly from
+ * the block transactions and written using one DB batch per ticket type.
+ * 
+ * \param pindex - block index of the connected block
+ * \param block - connected block
+ */
+void CPastelTicketProcessor::ConnectBlock(const CBlockIndex* pindex, const CBlock& block)
 {
-    if (!cBlockIndex)
+    if (!pindex)
         return;
 
-    if (fInitialDownload) {
-        //??
+    // index missing blocks first if the ticket DBs are behind the active chain
+    if (nTicketDBHeight + 1 < pindex->nHeight)
+    {
+        string error;
+        if (!SyncTicketDB(pindex->pprev, error))
+            LogPrintf("CPastelTicketProcessor::ConnectBlock -- ERROR: %s\n", error);
     }
+    connectTickets(pindex, parseBlockTickets(block, pindex->nHeight), true);
+}
 
-    CBlock block;
-    if (!ReadBlockFromDisk(block, cBlockIndex, Params().GetConsensus()))
+/**
+ * Parse all tickets of the block.
+ * 
+ * \param block - block to parse
+ * \param nBlockHeight - block height
+ * \return tickets found in the block
+ */
+PastelTickets_t CPastelTicketProcessor::parseBlockTickets(const CBlock& block, const uint32_t nBlockHeight)
+{
+    PastelTickets_t vTickets;
+    string error;
+    for (const auto& tx : block.vtx)
     {
-        LogPrintf("CPastelTicket::UpdatedBlockTip -- ERROR: Can't read block from disk\n");
+        auto ticket = ParseTicket(tx, nBlockHeight, error);
+        if (ticket)
+            vTickets.emplace_back(move(ticket));
+    }
+    return vTickets;
+}
+
+/**
+ * Add tickets of the block to the ticket DBs and move ticket DB tip to this block.
+ * 
+ * \param pindex - block index
+ * \param vTickets - tickets of the block
+ * \param bSaveUndo - if true - save undo record for the block tickets
+ */
+void CPastelTicketProcessor::connectTickets(const CBlockIndex* pindex, const PastelTickets_t& vTickets, const bool bSaveUndo)
+{
+    const uint32_t nHeight = static_cast<uint32_t>(pindex->nHeight);
+    if (!vTickets.empty())
+    {
+        if (bSaveUndo && undoDB)
+        {
+            // save ticket DB state before the tickets are added
+            CTicketBlockUndo blockUndo;
+            blockUndo.hashBlock = pindex->GetBlockHash();
+            blockUndo.vTicketUndo.reserve(vTickets.size());
+            for (const auto& ticket : vTickets)
+            {
+                CTicketUndo undo;
+                if (getTicketUndo(*ticket, undo))
+                    blockUndo.vTicketUndo.emplace_back(move(undo));
+            }
+            undoDB->Write(make_pair(DB_TICKET_UNDO, nHeight), blockUndo, true);
+        }
+        UpdateDB(vTickets);
+    }
+    // undo records are not needed for blocks that cannot be disconnected anymore
+    if (undoDB && (nHeight > MAX_REORG_LENGTH))
+        undoDB->Erase(make_pair(DB_TICKET_UNDO, nHeight - MAX_REORG_LENGTH - 1));
+    // tip must be persisted after the tickets are written, otherwise the block would be indexed again
+    // on restart with the undo record overwritten by the state that already includes block tickets.
+    // Losing the tip of the block without tickets only means that the block is indexed again.
+    setTicketDBTip(pindex, !vTickets.empty());
+}
+
+/**
+ * Save the last block indexed in the ticket DBs.
+ * 
+ * \param pindex - block index
+ * \param bSync - if true - wait until the tip record is flushed to disk
+ */
+void CPastelTicketProcessor::setTicketDBTip(const CBlockIndex* pindex, const bool bSync)
+{
+    if (!pindex)
         return;
+    nTicketDBHeight = pindex->nHeight;
+    hashTicketDBTip = pindex->GetBlockHash();
+    if (undoDB)
+        undoDB->Write(DB_TICKET_TIP, make_pair(pindex->nHeight, pindex->GetBlockHash()), bSync);
+}
+
+/**
+ * Disconnect blocks indexed in the ticket DBs that are not in the active chain.
+ * Ticket DB tip can be on a stale fork or above the active chain tip if the node
+ * was stopped after the ticket DBs were updated but before the chain state was flushed.
+ * Blocks are reverted down to the fork point using ticket undo records.
+ * Called with cs_main held.
+ * 
+ * \param error - returns error message if ticket DBs can't be reverted
+ * \return true if the ticket DB tip is in the active chain
+ */
+bool CPastelTicketProcessor::rollbackTicketDB(string& error)
+{
+    AssertLockHeld(cs_main);
+    // ticket DBs are empty or created by the previous version without tip hash
+    if (hashTicketDBTip.IsNull())
+        return true;
+    const CBlockIndex* pindex = chainActive[nTicketDBHeight];
+    if (pindex && (pindex->GetBlockHash() == hashTicketDBTip))
+        return true;
+    const auto it = mapBlockIndex.find(hashTicketDBTip);
+    if (it == mapBlockIndex.cend() || !it->second)
+    {
+        error = strprintf("Ticket DB tip block %s at height %d is not found, restart with -reindextickets",
+            hashTicketDBTip.ToString(), nTicketDBHeight);
+        return false;
     }
+    pindex = it->second;
+    const CBlockIndex* pindexFork = chainActive.FindFork(pindex);
+    LogPrintf("Ticket DB tip %s at height %d is not in the active chain, reverting tickets down to the block at height %d\n",
+        hashTicketDBTip.ToString(), nTicketDBHeight, pindexFork ? pindexFork->nHeight : -1);
+    const auto& consensusParams = Params().GetConsensus();
+    CBlock block;
+    while (pindex && (pindex != pindexFork))
+    {
+        // block is used only if the undo record is not found
+        const bool bHasUndo = undoDB && undoDB->Exists(make_pair(DB_TICKET_UNDO, static_cast<uint32_t>(pindex->nHeight)));
+        block = CBlock();
+        if (!bHasUndo && !ReadBlockFromDisk(block, pindex, consensusParams))
+        {
+            error = strprintf("Can't revert tickets of the block %s at height %d - no undo record and block can't be read from disk, restart with -reindextickets",
+                pindex->GetBlockHash().ToString(), pindex->nHeight);
+            return false;
+        }
+        DisconnectBlock(pindex, block);
+        pindex = pindex->pprev;
+    }
+    return true;
+}
 
-    for (const CTransaction& tx : block.vtx)
+/**
+ * Index tickets of all blocks up to pindexTip that are not yet indexed in the ticket DBs.
+ * Blocks indexed in the ticket DBs that are not in the active chain are reverted first.
+ * Called with cs_main held - active chain can't change while ticket DBs are rebuilt.
+ * 
+ * \param pindexTip - last block to index
+ * \param error - returns error message if ticket DBs can't be synced with the active chain
+ * \return true if ticket DBs are synced up to pindexTip
+ */
+bool CPastelTicketProcessor::SyncTicketDB(const CBlockIndex* pindexTip, string& error)
+{
+    AssertLockHeld(cs_main);
+    if (!rollbackTicketDB(error))
+        return false;
+    if (!pindexTip || (nTicketDBHeight >= pindexTip->nHeight))
+        return true;
+    const uint32_t nStartHeight = static_cast<uint32_t>(nTicketDBHeight + 1);
+    LogPrintf("Rebuilding ticket DBs for blocks %u..%d\n", nStartHeight, pindexTip->nHeight);
+    const int64_t nStartTime = GetTimeMillis();
+    if (!rebuildTicketDB(pindexTip, nStartHeight, error))
+        return false;
+    LogPrintf("Ticket DBs rebuilt up to block %d in %" PRId64 "ms\n", nTicketDBHeight, GetTimeMillis() - nStartTime);
+    return true;
+}
+
+/**
+ * Rebuild ticket DBs for the range of blocks [nStartHeight..pindexTip].
+ * Worker threads read block ranges from disk, decompress and deserialize tickets.
+ * Parsed ranges are applied by the calling thread strictly in the order of block heights,
+ * one batch per ticket type per block.
+ * 
+ * \param pindexTip - last block to index
+ * \param nStartHeight - height of the first block to index
+ * \param error - returns error message if block can't be read from disk
+ * \return false if ticket DBs were not rebuilt up to pindexTip because of the read error
+ */
+bool CPastelTicketProcessor::rebuildTicketDB(const CBlockIndex* pindexTip, const uint32_t nStartHeight, string& error)
+{
+    const uint32_t nTipHeight = static_cast<uint32_t>(pindexTip->nHeight);
+    if (nStartHeight > nTipHeight)
+        return true;
+    const uint32_t nRangeCount = (nTipHeight - nStartHeight) / TICKET_REINDEX_RANGE_SIZE + 1;
+
+    int nThreads = static_cast<int>(GetArg("-ticketreindexthreads", DEFAULT_TICKET_REINDEX_THREADS));
+    if (nThreads <= 0)
+        nThreads += GetNumCores();
+    nThreads = max(1, min(nThreads, MAX_TICKET_REINDEX_THREADS));
+    nThreads = static_cast<int>(min<uint32_t>(nThreads, nRangeCount));
+    // limit number of parsed ranges waiting to be written
+    const uint32_t nMaxPendingRanges = 2 * nThreads;
+
+    using block_tickets_t = vector<pair<const CBlockIndex*, PastelTickets_t>>;
+    map<uint32_t, block_tickets_t> mapParsedRanges; // range index -> parsed blocks of the range
+    mutex mtx;
+    condition_variable cvParsed;  // new range parsed
+    condition_variable cvWritten; // range written
+    atomic<uint32_t> nNextRange(0);
+    uint32_t nNextRangeToWrite = 0;
+    atomic_bool bStop(false);
+    string sReadError;
+    const auto& consensusParams = Params().GetConsensus();
+
+    // bStop is changed under mtx - waiting thread can't miss the notification
+    // between the predicate check and blocking on the condition variable
+    auto stop = [&]()
     {
-        CMutableTransaction mtx(tx);
-        ParseTicketAndUpdateDB(mtx, cBlockIndex->nHeight);
+        {
+            lock_guard<mutex> lck(mtx);
+            bStop = true;
+        }
+        cvParsed.notify_all();
+        cvWritten.notify_all();
+    };
+
+    auto worker = [&]()
+    {
+        CBlock block;
+        while (!bStop)
+        {
+            const uint32_t nRange = nNextRange++;
+            if (nRange >= nRangeCount)
+                break;
+            {
+                unique_lock<mutex> lck(mtx);
+                cvWritten.wait(lck, [&]() { return bStop || (nRange < nNextRangeToWrite + nMaxPendingRanges); });
+            }
+            if (bStop)
+                break;
+            const uint32_t nRangeStart = nStartHeight + nRange * TICKET_REINDEX_RANGE_SIZE;
+            const uint32_t nRangeEnd = min(nRangeStart + TICKET_REINDEX_RANGE_SIZE - 1, nTipHeight);
+            block_tickets_t vBlocks;
+            vBlocks.reserve(nRangeEnd - nRangeStart + 1);
+            for (uint32_t nHeight = nRangeStart; nHeight <= nRangeEnd; ++nHeight)
+            {
+                const CBlockIndex* pindex = pindexTip->GetAncestor(nHeight);
+                if (!pindex || !ReadBlockFromDisk(block, pindex, consensusParams))
+                {
+                    {
+                        lock_guard<mutex> lck(mtx);
+                        if (sReadError.empty())
+                            sReadError = strprintf("Can't read block %u from disk, restart with -reindex", nHeight);
+                    }
+                    LogPrintf("CPastelTicketProcessor::rebuildTicketDB -- ERROR: can't read block %u from disk\n", nHeight);
+                    stop();
+                    break;
+                }
+                vBlocks.emplace_back(pindex, parseBlockTickets(block, nHeight));
+            }
+            if (bStop)
+                break;
+            {
+                lock_guard<mutex> lck(mtx);
+                mapParsedRanges.emplace(nRange, move(vBlocks));
+            }
+            cvParsed.notify_all();
+        }
+        cvParsed.notify_all();
+    };
+
+    vector<thread> vWorkers;
+    vWorkers.reserve(nThreads);
+    for (int i = 0; i < nThreads; ++i)
+        vWorkers.emplace_back(worker);
+
+    // blocks that can still be disconnected need undo records
+    const uint32_t nUndoStartHeight = nTipHeight > MAX_REORG_LENGTH ? nTipHeight - MAX_REORG_LENGTH : 0;
+    for (uint32_t nRange = 0; nRange < nRangeCount; ++nRange)
+    {
+        block_tickets_t vBlocks;
+        {
+            unique_lock<mutex> lck(mtx);
+            cvParsed.wait(lck, [&]() { return bStop || (mapParsedRanges.count(nRange) > 0); });
+            auto it = mapParsedRanges.find(nRange);
+            if (it == mapParsedRanges.end())
+                break;
+            vBlocks = move(it->second);
+            mapParsedRanges.erase(it);
+        }
+        for (const auto& [pindex, vTickets] : vBlocks)
+            connectTickets(pindex, vTickets, static_cast<uint32_t>(pindex->nHeight) >= nUndoStartHeight);
+        {
+            lock_guard<mutex> lck(mtx);
+            nNextRangeToWrite = nRange + 1;
+        }
+        cvWritten.notify_all();
+        LogPrint("tickets", "Ticket DBs rebuilt up to block %d\n", nTicketDBHeight);
+        if (ShutdownRequested())
+            break;
+    }
+    stop();
+    for (auto& t : vWorkers)
+        t.join();
+    if (!sReadError.empty())
+    {
+        error = move(sReadError);
+        return false;
     }
+    return true;
 }
 
-void CPastelTicketProcessor::UpdateDB_MVK(const CPastelTicket& ticket, const string& mvKey)
+/**
+ * Revert tickets of the block disconnected from the active chain.
+ * Uses undo record saved when the block was connected to restore primary,
+ * secondary and multi-value keys. All changes for one ticket type are written in one batch.
+ * 
+ * \param pindex - block index of the disconnected block
+ * \param block - disconnected block
+ */
+void CPastelTicketProcessor::DisconnectBlock(const CBlockIndex* pindex, const CBlock& block)
 {
-    v_strings mainKeys;
-    auto realMVKey = RealMVKey(mvKey);
-    auto itDB = dbs.find(ticket.ID());
-    if (itDB == dbs.end())
+    if (!pindex)
         return;
-    itDB->second->Read(realMVKey, mainKeys);
-    if (find(mainKeys.cbegin(), mainKeys.cend(), ticket.KeyOne()) == mainKeys.cend())
+
+    // cached validations are bound to the chain tip, entries for the disconnected tip are not needed anymore
+    ticketValidationCache.Clear();
+    // LegRoast public keys are looked up in the PastelID registration tickets
+    pastelIDPubKeyCache.ClearLegRoastKeys();
+    const auto undoKey = make_pair(DB_TICKET_UNDO, static_cast<uint32_t>(pindex->nHeight));
+    CTicketBlockUndo blockUndo;
+    bool bHasUndo = undoDB && undoDB->Read(undoKey, blockUndo);
+    if (bHasUndo && (blockUndo.hashBlock != pindex->GetBlockHash()))
     {
-        mainKeys.emplace_back(ticket.KeyOne());
-        itDB->second->Write(realMVKey, mainKeys, true);
+        LogPrintf("CPastelTicketProcessor::DisconnectBlock -- ERROR: ticket undo record for block %s at height %d belongs to the block %s\n",
+            pindex->GetBlockHash().ToString(), pindex->nHeight, blockUndo.hashBlock.ToString());
+        bHasUndo = false;
     }
+    if (!bHasUndo)
+    {
+        // no undo record - just remove tickets of the block, previous state can't be restored
+        string error;
+        for (const auto& tx : block.vtx)
+        {
+            auto ticket = ParseTicket(tx, pindex->nHeight, error);
+            if (!ticket)
+                continue;
+            CTicketUndo undo;
+            undo.nTicketID = to_integral_type<TicketID>(ticket->ID());
+            undo.sKeyOne = ticket->KeyOne();
+            if (ticket->HasKeyTwo())
+                undo.sKeyTwo = ticket->KeyTwo();
+            if (ticket->HasMVKeyOne())
+                undo.vNewMVKeys.emplace_back(ticket->MVKeyOne());
+            if (ticket->HasMVKeyTwo())
+                undo.vNewMVKeys.emplace_back(ticket->MVKeyTwo());
+            if (ticket->HasMVKeyThree())
+                undo.vNewMVKeys.emplace_back(ticket->MVKeyThree());
+            blockUndo.vTicketUndo.emplace_back(move(undo));
+        }
+        if (!blockUndo.vTicketUndo.empty())
+            LogPrintf("CPastelTicketProcessor::DisconnectBlock -- WARNING: no ticket undo record found for block %s, %zu tickets removed\n",
+                pindex->GetBlockHash().ToString(), blockUndo.vTicketUndo.size());
+    }
+    if (blockUndo.vTicketUndo.empty())
+    {
+        setTicketDBTip(pindex->pprev, true);
+        return;
+    }
+
+    {
+        // tickets of the disconnected block can be referenced by the cached trading chains
+        lock_guard<mutex> lck(csTradingChainCache);
+        mapTradingChainCache.clear();
+    }
+    db_batch_map_t batches;
+    // revert tickets in the reverse order
+    for (auto it = blockUndo.vTicketUndo.crbegin(); it != blockUndo.vTicketUndo.crend(); ++it)
+        undoTicket(*it, static_cast<uint32_t>(pindex->nHeight), batches);
+    writeDB(batches);
+    if (undoDB)
+        undoDB->Erase(undoKey, true);
+    setTicketDBTip(pindex->pprev, true);
+    LogPrint("tickets", "CPastelTicketProcessor::DisconnectBlock -- %zu tickets reverted for block %s at height %d\n",
+        blockUndo.vTicketUndo.size(), pindex->GetBlockHash().ToString(), pindex->nHeight);
 }
 
-bool CPastelTicketProcessor::UpdateDB(CPastelTicket &ticket, string& txid, const unsigned int nBlockHeight)
+/**
+ * Get undo information for the ticket before it is added to the ticket DB.
+ * 
+ * \param ticket - ticket to add
+ * \param undo - returns undo information
+ * \return false if DB for the ticket type does not exist
+ */
+bool CPastelTicketProcessor::getTicketUndo(const CPastelTicket& ticket, CTicketUndo& undo) const
 {
-    if (!txid.empty())
-        ticket.SetTxId(move(txid));
-    if (nBlockHeight != 0)
-        ticket.SetBlock(nBlockHeight);
-    auto itDB = dbs.find(ticket.ID());
-    if (itDB == dbs.end())
+    const auto itDB = dbs.find(ticket.ID());
+    if (itDB == dbs.cend())
         return false;
-    itDB->second->Write(ticket.KeyOne(), ticket, true);
+    const auto& db = *itDB->second;
+    undo.nTicketID = to_integral_type<TicketID>(ticket.ID());
+    undo.sKeyOne = ticket.KeyOne();
+    // ticket with the same primary key is overwritten
+    auto prevTicket = CreateTicket(ticket.ID());
+    if (prevTicket && db.Read(undo.sKeyOne, *prevTicket))
+    {
+        CDataStream ss(SER_DISK, CLIENT_VERSION);
+        ss << *prevTicket;
+        undo.vPrevTicketData.assign(ss.begin(), ss.end());
+    }
     if (ticket.HasKeyTwo())
     {
-        auto realKeyTwo = RealKeyTwo(ticket.KeyTwo());
-        itDB->second->Write(realKeyTwo, ticket.KeyOne(), true);
+        undo.sKeyTwo = ticket.KeyTwo();
+        db.Read(RealKeyTwo(undo.sKeyTwo), undo.sPrevKeyOne);
+    }
+    v_strings vMVKeys;
+    if (ticket.HasMVKeyOne())
+        vMVKeys.emplace_back(ticket.MVKeyOne());
+    if (ticket.HasMVKeyTwo())
+        vMVKeys.emplace_back(ticket.MVKeyTwo());
+    if (ticket.HasMVKeyThree())
+        vMVKeys.emplace_back(ticket.MVKeyThree());
+    for (auto& sMVKey : vMVKeys)
+    {
+        if (!db.Exists(RealMVKey(sMVKey, undo.sKeyOne)))
+            undo.vNewMVKeys.emplace_back(move(sMVKey));
+    }
+    return true;
+}
+
+/**
+ * Add operations to revert the ticket to the ticket DB batch.
+ * 
+ * \param undo - ticket undo information
+ * \param nBlockHeight - height of the block with the ticket
+ * \param batches - map of ticket DB batches
+ * \return false if DB for the ticket type does not exist or failed to restore previous ticket
+ */
+bool CPastelTicketProcessor::undoTicket(const CTicketUndo& undo, const uint32_t nBlockHeight, db_batch_map_t& batches) const
+{
+    if (undo.nTicketID >= to_integral_type<TicketID>(TicketID::COUNT))
+        return false;
+    const auto id = static_cast<TicketID>(undo.nTicketID);
+    const auto itDB = dbs.find(id);
+    if (itDB == dbs.cend())
+        return false;
+    auto& batch = batches.try_emplace(id, *itDB->second).first->second;
+    for (const auto& sMVKey : undo.vNewMVKeys)
+        batch.Erase(RealMVKey(sMVKey, undo.sKeyOne));
+    batch.Erase(CTicketHeightKey(nBlockHeight, undo.sKeyOne));
+    if (id == TicketID::NFT)
+        eraseNFTSearchProps(undo.sKeyOne, *itDB->second, batch);
+    if (id == TicketID::Trade)
+        undoNFTOwnership(undo.sKeyOne, *itDB->second, batch);
+    if (!undo.sKeyTwo.empty())
+    {
+        if (undo.sPrevKeyOne.empty())
+            batch.Erase(RealKeyTwo(undo.sKeyTwo));
+        else
+            batch.Write(RealKeyTwo(undo.sKeyTwo), undo.sPrevKeyOne);
+    }
+    if (undo.vPrevTicketData.empty())
+    {
+        batch.Erase(undo.sKeyOne);
+        return true;
     }
+    auto prevTicket = CreateTicket(id);
+    if (!prevTicket)
+        return false;
+    try
+    {
+        CDataStream ss(undo.vPrevTicketData, SER_DISK, CLIENT_VERSION);
+        ss >> *prevTicket;
+    }
+    catch (const exception& ex)
+    {
+        LogPrintf("CPastelTicketProcessor::undoTicket -- ERROR: failed to restore '%s' ticket [key=%s]. %s\n",
+            GetTicketDescription(id), undo.sKeyOne, ex.what());
+        batch.Erase(undo.sKeyOne);
+        return false;
+    }
+    batch.Write(undo.sKeyOne, *prevTicket);
+    batch.Write(CTicketHeightKey(prevTicket->GetBlock(), undo.sKeyOne), TICKET_MVKEY_VALUE);
+    updateNFTSearchProps(*prevTicket, batch);
+    return true;
+}
+
+/**
+ * Add ticket primary key to the multi-value key.
+ * Composite key <mvkey, primary key> is just inserted - no need to read
+ * and rewrite all primary keys already stored for this mvkey.
+ * 
+ * \param ticket - ticket to add
+ * \param mvKey - multi-value key
+ * \param batch - ticket DB batch
+ */
+void CPastelTicketProcessor::UpdateDB_MVK(const CPastelTicket& ticket, const string& mvKey, CDBBatch& batch)
+{
+    batch.Write(RealMVKey(mvKey, ticket.KeyOne()), TICKET_MVKEY_VALUE);
+}
+
+/**
+ * Add ticket keys to the batch for the ticket DB.
+ * 
+ * \param ticket - ticket to add
+ * \param batches - map of ticket DB batches, batch is created if it does not exist yet
+ * \return false if DB for the ticket type does not exist
+ */
+bool CPastelTicketProcessor::updateDB(const CPastelTicket& ticket, db_batch_map_t& batches) const
+{
+    const auto itDB = dbs.find(ticket.ID());
+    if (itDB == dbs.cend())
+        return false;
+    auto& batch = batches.try_emplace(ticket.ID(), *itDB->second).first->second;
+    batch.Write(ticket.KeyOne(), ticket);
+    // height index: entry for the overwritten ticket with the same primary key is left as is,
+    // height index readers skip entries with the height that does not match the ticket height
+    batch.Write(CTicketHeightKey(ticket.GetBlock(), ticket.KeyOne()), TICKET_MVKEY_VALUE);
+    // search properties of the overwritten NFT registration ticket are stored under its txid
+    if (ticket.ID() == TicketID::NFT)
+        eraseNFTSearchProps(ticket.KeyOne(), *itDB->second, batch);
+    updateNFTSearchProps(ticket, batch);
+    updateNFTOwnership(ticket, batch);
+    if (ticket.HasKeyTwo())
+        batch.Write(RealKeyTwo(ticket.KeyTwo()), ticket.KeyOne());
 
     if (ticket.HasMVKeyOne())
-        UpdateDB_MVK(ticket, ticket.MVKeyOne());
+        UpdateDB_MVK(ticket, ticket.MVKeyOne(), batch);
     if (ticket.HasMVKeyTwo())
-        UpdateDB_MVK(ticket, ticket.MVKeyTwo());
+        UpdateDB_MVK(ticket, ticket.MVKeyTwo(), batch);
     if (ticket.HasMVKeyThree())
+        UpdateDB_MVK(ticket, ticket.MVKeyThree(), batch);
+    return true;
+}
+
+/**
+ * Write ticket DB batches.
+ * 
+ * \param batches - map of ticket DB batches
+ */
+void CPastelTicketProcessor::writeDB(db_batch_map_t& batches)
+{
+    for (auto& [id, batch] : batches)
     {
-        UpdateDB_MVK(ticket, ticket.MVKeyThree());
+        const auto itDB = dbs.find(id);
+        if (itDB != dbs.cend())
+            itDB->second->WriteBatch(batch, true);
     }
-        
+}
+
+bool CPastelTicketProcessor::UpdateDB(CPastelTicket &ticket, string& txid, const unsigned int nBlockHeight)
+{
+    if (!txid.empty())
+        ticket.SetTxId(move(txid));
+    if (nBlockHeight != 0)
+        ticket.SetBlock(nBlockHeight);
+    db_batch_map_t batches;
+    if (!updateDB(ticket, batches))
+        return false;
+    writeDB(batches);
     //LogPrintf("tickets", "CPastelTicketProcessor::UpdateDB -- Ticket added into DB with key %s (txid - %s)\n", ticket.KeyOne(), ticket.ticketTnx);
     return true;
 }
 
+/**
+ * Write tickets to the ticket DBs.
+ * All tickets of the same type are written in one batch.
+ * 
+ * \param vTickets - tickets to write
+ */
+void CPastelTicketProcessor::UpdateDB(const PastelTickets_t& vTickets)
+{
+    db_batch_map_t batches;
+    for (const auto& ticket : vTickets)
+        updateDB(*ticket, batches);
+    writeDB(batches);
+}
+
 /**
  * Reads P2FMS (Pay-to-Fake-Multisig) transaction into CDataStream object.
  * Parses the first byte from the stream - it defines ticket id.
@@ -199,12 +1208,22 @@ bool CPastelTicketProcessor::UpdateDB(CPastelTicket &ticket, string& txid, const
  * \return 
  */
 bool CPastelTicketProcessor::preParseTicket(const CMutableTransaction& tx, CCompressedDataStream& data_stream, TicketID& ticket_id, string& error, const bool bLog)
+{
+    return preParseTicket(tx.vout, data_stream, ticket_id, error);
+}
+
+bool CPastelTicketProcessor::preParseTicket(const CTransaction& tx, CCompressedDataStream& data_stream, TicketID& ticket_id, string& error, const bool bLog)
+{
+    return preParseTicket(tx.vout, data_stream, ticket_id, error);
+}
+
+bool CPastelTicketProcessor::preParseTicket(const vector<CTxOut>& vout, CCompressedDataStream& data_stream, TicketID& ticket_id, string& error)
 {
     CSerializeData vOutputData;
     bool bRet = false;
     do
     {
-        if (!ParseP2FMSTransaction(tx, vOutputData, error))
+        if (!parseP2FMSOutputs(vout, vOutputData, error))
             break;
         if (vOutputData.empty())
         {
@@ -459,6 +1478,28 @@ ticket_validation_t CPastelTicketProcessor::ValidateIfTicketTransaction(const ui
             tv.state = TICKET_VALIDATION_STATE::NOT_TICKET;
             break;
         }
+        // tickets compressed with v2 (dictionary) compressor can't be parsed by the nodes
+        // that do not support it - they are accepted only after activation height
+        if (data_stream.IsCompressed() && (data_stream.GetCompressorVersion() == CCompressedDataStream::COMPRESSOR_VERSION_DICT) &&
+            !Params().GetConsensus().IsTicketDictCompressorActive(nHeight))
+        {
+            tv.errorMsg = strprintf("ticket compressor v%hhu is not active at height %u",
+                CCompressedDataStream::COMPRESSOR_VERSION_DICT, nHeight);
+            LogPrintf("ValidateIfTicketTransaction -- Invalid ticket ['%s', txid=%s, nHeight=%u]. ERROR: %s\n",
+                GetTicketDescription(ticket_id), tx.GetHash().GetHex(), nHeight, tv.errorMsg);
+            break;
+        }
+
+        // check if this ticket transaction was already validated in the same chain context
+        // (for example, when it was accepted into the mempool)
+        const uint256 cacheEntry = ticketValidationCache.ComputeEntry(tx.GetHash().GetHex(), nHeight, 0);
+        if (ticketValidationCache.Get(cacheEntry))
+        {
+            LogPrint("tickets", "ValidateIfTicketTransaction -- ticket ['%s', txid=%s, nHeight=%u] found in validation cache\n",
+                GetTicketDescription(ticket_id), tx.GetHash().GetHex(), nHeight);
+            tv.setValid();
+            break;
+        }
 
         // this is a ticket and it needs to be validated
         bool bOk = false;
@@ -504,47 +1545,59 @@ ticket_validation_t CPastelTicketProcessor::ValidateIfTicketTransaction(const ui
         }
 
         tv.setValid();
+        ticketValidationCache.Set(cacheEntry);
     } while (false);
     return tv;
 }
 
-bool CPastelTicketProcessor::ParseTicketAndUpdateDB(CMutableTransaction& tx, const unsigned int nBlockHeight)
+/**
+ * Parse ticket from the transaction.
+ * 
+ * \param tx - ticket transaction
+ * \param nBlockHeight - ticket block height
+ * \param error - returns an error message if any
+ * \return ticket object or nullptr if transaction is not a ticket or failed to parse the ticket
+ */
+unique_ptr<CPastelTicket> CPastelTicketProcessor::ParseTicket(const CTransaction& tx, const uint32_t nBlockHeight, string& error)
 {
-    string error_ret;
     CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
     TicketID ticket_id;
 
-    if (!preParseTicket(tx, data_stream, ticket_id, error_ret))
-        return false;
+    error.clear();
+    if (!preParseTicket(tx, data_stream, ticket_id, error))
+        return nullptr;
 
-    try {
+    unique_ptr<CPastelTicket> ticket;
+    try
+    {
         string txid = tx.GetHash().GetHex();
 
-        LogPrintf("ParseTicketAndUpdateDB -- Processing ticket ['%s', txid=%s, nBlockHeight=%u]\n", 
+        LogPrintf("ParseTicket -- Processing ticket ['%s', txid=%s, nBlockHeight=%u]\n", 
             GetTicketDescription(ticket_id), txid, nBlockHeight);
 
-        auto ticket = CreateTicket(ticket_id);
+        ticket = CreateTicket(ticket_id);
         if (!ticket)
-            error_ret = strprintf("unknown ticket type %hhu", to_integral_type<TicketID>(ticket_id));
+            error = strprintf("unknown ticket type %hhu", to_integral_type<TicketID>(ticket_id));
         else
         {
             data_stream >> *ticket;
-            return UpdateDB(*ticket, txid, nBlockHeight);
+            ticket->SetTxId(move(txid));
+            ticket->SetBlock(nBlockHeight);
+            return ticket;
         }
     }
     catch (const exception& ex)
     {
-        error_ret = strprintf("Failed to parse and unpack ticket - %s", ex.what());
+        error = strprintf("Failed to parse and unpack ticket - %s", ex.what());
     }
     catch (...)
     {
-        error_ret = "Failed to parse and unpack ticket - Unknown exception";
+        error = "Failed to parse and unpack ticket - Unknown exception";
     }
 
-    LogPrintf("ParseTicketAndUpdateDB -- Invalid ticket ['%s', txid=%s, nBlockHeight=%u]. ERROR: %s\n", 
-        GetTicketDescription(ticket_id), tx.GetHash().GetHex(), nBlockHeight, error_ret);
-
-    return false;
+    LogPrintf("ParseTicket -- Invalid ticket ['%s', txid=%s, nBlockHeight=%u]. ERROR: %s\n", 
+        GetTicketDescription(ticket_id), tx.GetHash().GetHex(), nBlockHeight, error);
+    return nullptr;
 }
 
 string CPastelTicketProcessor::GetTicketJSON(const uint256 &txid)
@@ -576,14 +1629,12 @@ unique_ptr<CPastelTicket> CPastelTicketProcessor::GetTicket(const uint256 &txid)
     if (!GetTransaction(txid, tx, Params().GetConsensus(), hashBlock, true, &nTicketHeight))
         throw runtime_error(strprintf("No information available about transaction"));
 
-    CMutableTransaction mtx(tx);
-
     TicketID ticket_id;
     string error_ret;
     CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
 
     // parse ticket transaction into data_stream
-    if (!preParseTicket(mtx, data_stream, ticket_id, error_ret))
+    if (!preParseTicket(tx, data_stream, ticket_id, error_ret))
         throw runtime_error(strprintf("Failed to parse P2FMS transaction from data provided. %s", error_ret));
 
     unique_ptr<CPastelTicket> ticket;
@@ -635,6 +1686,33 @@ unique_ptr<CPastelTicket> CPastelTicketProcessor::GetTicket(const string& _txid,
     return ticket;
 }
 
+/**
+ * Create a copy of the ticket.
+ * Ticket is copied via serialization, txid and block height are copied as well.
+ * 
+ * \param ticket - ticket to copy
+ * \return ticket copy or nullptr if ticket could not be copied
+ */
+unique_ptr<CPastelTicket> CPastelTicketProcessor::CloneTicket(const CPastelTicket& ticket)
+{
+    auto pTicket = CreateTicket(ticket.ID());
+    if (!pTicket)
+        return nullptr;
+    try
+    {
+        CDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+        data_stream << ticket;
+        data_stream >> *pTicket;
+    } catch (const exception& e)
+    {
+        LogPrint("tickets", "Failed to copy '%s' ticket [txid=%s]. %s\n", ticket.GetTicketName(), ticket.GetTxId(), e.what());
+        return nullptr;
+    }
+    pTicket->SetTxId(string(ticket.GetTxId()));
+    pTicket->SetBlock(ticket.GetBlock());
+    return pTicket;
+}
+
 bool CPastelTicketProcessor::CheckTicketExist(const CPastelTicket& ticket)
 {
     auto key = ticket.KeyOne();
@@ -673,61 +1751,132 @@ bool CPastelTicketProcessor::FindTicket(CPastelTicket& ticket) const
 }
 
 /**
- * Find ticket in DB by secondary key.
+ * Find ticket in DB by secondary key.
+ * 
+ * \param ticket - ticket object to return
+ * \return true if ticket has secondary key and the ticket was found
+ */
+bool CPastelTicketProcessor::FindTicketBySecondaryKey(CPastelTicket& ticket)
+{
+    if (ticket.HasKeyTwo())
+    {
+        string sMainKey;
+        const auto sRealKeyTwo = RealKeyTwo(ticket.KeyTwo());
+        const auto itDB = dbs.find(ticket.ID());
+        if (itDB != dbs.cend() && itDB->second->Read(sRealKeyTwo, sMainKey))
+            return itDB->second->Read(sMainKey, ticket);
+    }
+    return false;
+}
+
+/**
+ * Apply functor F to all primary keys stored under the multi-value key.
+ * All composite keys <mvkey, primary key> for the same mvkey are stored next
+ * to each other in the DB, so only this range of keys is iterated.
+ * 
+ * \param db - ticket DB
+ * \param mvKey - multi-value key
+ * \param f - functor to apply, if it returns false - enumeration is stopped
+ */
+template <typename F>
+void CPastelTicketProcessor::processMVKeys(const CDBWrapper& db, const string& mvKey, F f, const string& sStartKey)
+{
+    const auto sRealMVKey = RealMVKey(mvKey);
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    // composite key with empty primary key is the first one in the range
+    pcursor->Seek(RealMVKey(mvKey, sStartKey));
+    ticket_mvkey_t key;
+    while (pcursor->Valid())
+    {
+        if (!pcursor->GetKey(key) || (key.first != sRealMVKey))
+            break;
+        if (!f(key.second))
+            break;
+        pcursor->Next();
+    }
+}
+
+template <class _TicketType, typename F>
+void CPastelTicketProcessor::ProcessTicketsByMVKey(const string& mvKey, F f) const
+{
+    const auto itDB = dbs.find(_TicketType::GetID());
+    if (itDB == dbs.cend())
+        return;
+    const auto& db = *itDB->second;
+    processMVKeys(db, mvKey, [&](const string& sMainKey) -> bool
+    {
+        _TicketType ticket;
+        if (db.Read(sMainKey, ticket))
+            return f(ticket); // stop processing tickets if functor returned false
+        return true;
+    });
+}
+
+/**
+ * Apply functor F to the primary keys in the height index within the block height range.
+ * Keys are processed in the block height order.
  * 
- * \param ticket - ticket object to return
- * \return true if ticket has secondary key and the ticket was found
+ * \param db - ticket DB
+ * \param heightRange - block height range
+ * \param f - functor to apply: bool f(const CTicketHeightKey& key),
+ *      if functor returns false - enumeration will be stopped
+ * \param pStartKey - optional height key to start enumeration from (should be within heightRange)
  */
-bool CPastelTicketProcessor::FindTicketBySecondaryKey(CPastelTicket& ticket)
+template <typename F>
+void CPastelTicketProcessor::processHeightKeys(const CDBWrapper& db, const numeric_range<uint32_t>& heightRange, F f,
+    const CTicketHeightKey* pStartKey)
 {
-    if (ticket.HasKeyTwo())
+    unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    // height key with empty primary key is the first one for the block height
+    if (pStartKey)
+        pcursor->Seek(*pStartKey);
+    else
+        pcursor->Seek(CTicketHeightKey(heightRange.min(), ""));
+    CTicketHeightKey key;
+    while (pcursor->Valid())
     {
-        string sMainKey;
-        const auto sRealKeyTwo = RealKeyTwo(ticket.KeyTwo());
-        const auto itDB = dbs.find(ticket.ID());
-        if (itDB != dbs.cend() && itDB->second->Read(sRealKeyTwo, sMainKey))
-            return itDB->second->Read(sMainKey, ticket);
+        if (!pcursor->GetKey(key) || !key.IsValid() || (key.nHeight > heightRange.max()))
+            break;
+        if (!f(key))
+            break;
+        pcursor->Next();
     }
-    return false;
 }
 
+/**
+ * Apply functor F to the tickets registered in the block height range.
+ * Uses height index - only tickets in the range are read from the ticket DB.
+ * 
+ * \param heightRange - block height range
+ * \param f - functor to apply: bool f(const _TicketType& ticket),
+ *      if functor returns false - enumeration will be stopped
+ */
 template <class _TicketType, typename F>
-void CPastelTicketProcessor::ProcessTicketsByMVKey(const string& mvKey, F f) const
+void CPastelTicketProcessor::ProcessTicketsByHeight(const numeric_range<uint32_t>& heightRange, F f) const
 {
-    v_strings vMainKeys;
-    const auto realMVKey = RealMVKey(mvKey);
     const auto itDB = dbs.find(_TicketType::GetID());
     if (itDB == dbs.cend())
         return;
-    itDB->second->Read(realMVKey, vMainKeys);
-    for (const auto& key : vMainKeys)
+    const auto& db = *itDB->second;
+    processHeightKeys(db, heightRange, [&](const CTicketHeightKey& key) -> bool
     {
         _TicketType ticket;
-        if (itDB->second->Read(key, ticket))
-        {
-            if (!f(ticket))
-                break; // stop processing tickets if functor returned false
-        }
-    }
+        // skip stale entries left by the tickets overwritten at another height
+        if (!db.Read(key.sPrimaryKey, ticket) || (ticket.GetBlock() != key.nHeight))
+            return true;
+        return f(ticket); // stop processing tickets if functor returned false
+    });
 }
 
 template <class _TicketType>
 vector<_TicketType> CPastelTicketProcessor::FindTicketsByMVKey(const string& mvKey)
 {
     vector<_TicketType> tickets;
-    v_strings vMainKeys;
-    auto realMVKey = RealMVKey(mvKey);
-    const auto itDB = dbs.find(_TicketType::GetID());
-    if (itDB != dbs.cend())
+    ProcessTicketsByMVKey<_TicketType>(mvKey, [&](_TicketType& ticket) -> bool
     {
-        itDB->second->Read(realMVKey, vMainKeys);
-        for (const auto& key : vMainKeys)
-        {
-            _TicketType ticket;
-            if (itDB->second->Read(key, ticket))
-                tickets.emplace_back(ticket);
-        }
-    }
+        tickets.emplace_back(move(ticket));
+        return true;
+    });
     return tickets;
 }
 
@@ -778,69 +1927,242 @@ v_strings CPastelTicketProcessor::GetAllKeys(const TicketID id) const
 }
 
 /**
- * Apply functor F for all tickets with type _TicketType.
+ * Append ticket json to the json array string.
  * 
- * \param f - functor to apply
- *      if functor returns false - enumerations will be stopped
+ * \param sJSON - json array string without closing bracket
+ * \param ticket - ticket to add
+ * \param nCount - number of tickets in the array, incremented
+ */
+static void appendTicketJSON(string& sJSON, const CPastelTicket& ticket, size_t& nCount)
+{
+    if (nCount++)
+        sJSON += ',';
+    sJSON += ticket.ToJSON();
+}
+
+/**
+ * Apply functor F to the tickets with type _TicketType.
+ * Tickets are read directly from the ticket DB cursor in the primary key order.
+ * 
+ * \param f - functor to apply, returns true if the ticket was added to the list
+ * \param pPage - optional page of tickets to list:
+ *      - enumeration starts from the ticket with the primary key pPage->sStartKey
+ *      - enumeration stops when pPage->nLimit tickets were added,
+ *        pPage->sNextKey is set to the primary key of the next ticket
  */
 template <class _TicketType, typename F>
-void CPastelTicketProcessor::listTickets(F f) const
+void CPastelTicketProcessor::listTickets(F f, ticket_list_page_t* pPage) const
 {
-    auto vKeys = GetAllKeys(_TicketType::GetID());
-    for (auto& key : vKeys)
+    const auto itDB = dbs.find(_TicketType::GetID());
+    if (itDB == dbs.cend())
+        return;
+    unique_ptr<CDBIterator> pcursor(itDB->second->NewIterator());
+    if (pPage)
     {
-        if (key.front() == '@')
-            continue;
-        _TicketType ticket;
-        ticket.SetKeyOne(move(key));
-        if (!FindTicket(ticket))
+        pPage->sNextKey.clear();
+        if (pPage->sStartKey.empty())
+            pcursor->SeekToFirst();
+        else
+            pcursor->Seek(pPage->sStartKey);
+    } else
+        pcursor->SeekToFirst();
+    size_t nCount = 0;
+    string sKey;
+    while (pcursor->Valid())
+    {
+        // skip secondary, multi-value and service keys
+        if (!pcursor->GetKey(sKey) || sKey.empty() || (sKey.front() == '@'))
+        {
+            pcursor->Next();
             continue;
-        if (!f(ticket))
+        }
+        if (pPage && pPage->nLimit && (nCount >= pPage->nLimit))
+        {
+            pPage->sNextKey = move(sKey);
             break;
+        }
+        _TicketType ticket;
+        ticket.SetKeyOne(string(sKey));
+        if (pcursor->GetValue(ticket) && f(ticket))
+            ++nCount;
+        pcursor->Next();
     }
 }
 
 template <class _TicketType>
-string CPastelTicketProcessor::ListTickets() const
+string CPastelTicketProcessor::ListTickets(ticket_list_page_t* pPage) const
 {
-    json jArray;
+    string sJSON("[");
+    size_t nCount = 0;
     listTickets<_TicketType>([&](const _TicketType& ticket) -> bool
     {
-        jArray.push_back(json::parse(ticket.ToJSON()));
+        appendTicketJSON(sJSON, ticket, nCount);
         return true;
+    }, pPage);
+    sJSON += ']';
+    return sJSON;
+}
+template string CPastelTicketProcessor::ListTickets<CPastelIDRegTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CNFTRegTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CNFTActivateTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CNFTSellTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CNFTBuyTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CNFTTradeTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CNFTRoyaltyTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CChangeUsernameTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CChangeEthereumAddressTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CActionRegTicket>(ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTickets<CActionActivateTicket>(ticket_list_page_t*) const;
+
+/**
+ * List tickets with type _TicketType stored under the multi-value key.
+ * 
+ * \param mvKey - multi-value key
+ * \param pPage - optional page of tickets to list, pPage->sStartKey and pPage->sNextKey are primary keys
+ * \return json array with tickets
+ */
+template <class _TicketType>
+string CPastelTicketProcessor::ListTicketsByMVKey(const string& mvKey, ticket_list_page_t* pPage) const
+{
+    string sJSON("[");
+    const auto itDB = dbs.find(_TicketType::GetID());
+    if (itDB != dbs.cend())
+    {
+        const auto& db = *itDB->second;
+        size_t nCount = 0;
+        if (pPage)
+            pPage->sNextKey.clear();
+        processMVKeys(db, mvKey, [&](const string& sMainKey) -> bool
+        {
+            if (pPage && pPage->nLimit && (nCount >= pPage->nLimit))
+            {
+                pPage->sNextKey = sMainKey;
+                return false;
+            }
+            _TicketType ticket;
+            if (db.Read(sMainKey, ticket))
+                appendTicketJSON(sJSON, ticket, nCount);
+            return true;
+        }, pPage ? pPage->sStartKey : "");
+    }
+    sJSON += ']';
+    return sJSON;
+}
+template string CPastelTicketProcessor::ListTicketsByMVKey<CPastelIDRegTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CNFTRegTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CNFTActivateTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CNFTSellTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CNFTBuyTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CNFTTradeTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CNFTRoyaltyTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CChangeUsernameTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CChangeEthereumAddressTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CActionRegTicket>(const string&, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByMVKey<CActionActivateTicket>(const string&, ticket_list_page_t*) const;
+
+/**
+ * Check if any ticket of the specific type is stored under the multi-value key.
+ * 
+ * \param id - ticket type
+ * \param mvKey - multi-value key
+ * \return true if at least one ticket is stored under mvKey
+ */
+bool CPastelTicketProcessor::HasTicketsByMVKey(const TicketID id, const string& mvKey) const
+{
+    const auto itDB = dbs.find(id);
+    if (itDB == dbs.cend())
+        return false;
+    bool bFound = false;
+    processMVKeys(*itDB->second, mvKey, [&](const string&) -> bool
+    {
+        bFound = true;
+        return false;
     });
-    return jArray.dump();
-}
-template string CPastelTicketProcessor::ListTickets<CPastelIDRegTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CNFTRegTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CNFTActivateTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CNFTSellTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CNFTBuyTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CNFTTradeTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CNFTRoyaltyTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CChangeUsernameTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CChangeEthereumAddressTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CActionRegTicket>() const;
-template string CPastelTicketProcessor::ListTickets<CActionActivateTicket>() const;
+    return bFound;
+}
+
+/**
+ * List tickets with type _TicketType registered at or after nMinHeight in the block height order.
+ * Page start and next keys are primary keys, the start ticket is looked up in the ticket DB
+ * to find its position in the height index.
+ * 
+ * \param nMinHeight - min block height of the tickets
+ * \param pPage - optional page of tickets to list
+ * \return json array with tickets
+ */
+template <class _TicketType>
+string CPastelTicketProcessor::ListTicketsByHeight(const uint32_t nMinHeight, ticket_list_page_t* pPage) const
+{
+    string sJSON("[");
+    const auto itDB = dbs.find(_TicketType::GetID());
+    if (itDB != dbs.cend())
+    {
+        const auto& db = *itDB->second;
+        const numeric_range<uint32_t> heightRange(nMinHeight, numeric_limits<uint32_t>::max());
+        optional<CTicketHeightKey> startKey;
+        if (pPage)
+        {
+            pPage->sNextKey.clear();
+            if (!pPage->sStartKey.empty())
+            {
+                _TicketType startTicket;
+                // unknown start ticket - empty page
+                if (!db.Read(pPage->sStartKey, startTicket))
+                    return "[]";
+                if (startTicket.GetBlock() >= nMinHeight)
+                    startKey = CTicketHeightKey(startTicket.GetBlock(), pPage->sStartKey);
+            }
+        }
+        size_t nCount = 0;
+        processHeightKeys(db, heightRange, [&](const CTicketHeightKey& key) -> bool
+        {
+            _TicketType ticket;
+            if (!db.Read(key.sPrimaryKey, ticket) || (ticket.GetBlock() != key.nHeight))
+                return true;
+            if (pPage && pPage->nLimit && (nCount >= pPage->nLimit))
+            {
+                pPage->sNextKey = key.sPrimaryKey;
+                return false;
+            }
+            appendTicketJSON(sJSON, ticket, nCount);
+            return true;
+        }, startKey.has_value() ? &startKey.value() : nullptr);
+    }
+    sJSON += ']';
+    return sJSON;
+}
+template string CPastelTicketProcessor::ListTicketsByHeight<CPastelIDRegTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CNFTRegTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CNFTActivateTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CNFTSellTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CNFTBuyTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CNFTTradeTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CNFTRoyaltyTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CChangeUsernameTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CChangeEthereumAddressTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CActionRegTicket>(const uint32_t, ticket_list_page_t*) const;
+template string CPastelTicketProcessor::ListTicketsByHeight<CActionActivateTicket>(const uint32_t, ticket_list_page_t*) const;
 
 template <class _TicketType, typename F>
-string CPastelTicketProcessor::filterTickets(F f, const bool bCheckConfirmation) const
+string CPastelTicketProcessor::filterTickets(F f, const bool bCheckConfirmation, ticket_list_page_t* pPage) const
 {
-    json jArray;
+    string sJSON("[");
+    size_t nCount = 0;
     const unsigned int nChainHeight = GetActiveChainHeight();
     // list tickets with the specific type (_TicketType) and add to json array if functor f applies
     listTickets<_TicketType>([&](const _TicketType& ticket) -> bool
     {
         //check if the ticket is confirmed
         if (bCheckConfirmation && (nChainHeight - ticket.GetBlock() < masterNodeCtrl.MinTicketConfirmations))
-            return true;
+            return false;
         // apply functor to the current ticket
         if (f(ticket, nChainHeight))
-            return true;
-        jArray.push_back(json::parse(ticket.ToJSON()));
+            return false;
+        appendTicketJSON(sJSON, ticket, nCount);
         return true;
-    });
-    return jArray.dump();
+    }, pPage);
+    sJSON += ']';
+    return sJSON;
 }
 
 /**
@@ -853,7 +2175,7 @@ string CPastelTicketProcessor::filterTickets(F f, const bool bCheckConfirmation)
  * \param pmapIDs - map of locally stored PastelIDs -> LegRoast public key
  * \return json with filtered tickets
  */
-string CPastelTicketProcessor::ListFilterPastelIDTickets(const short filter, const pastelid_store_t* pmapIDs) const
+string CPastelTicketProcessor::ListFilterPastelIDTickets(const short filter, const pastelid_store_t* pmapIDs, ticket_list_page_t* pPage) const
 {
     return filterTickets<CPastelIDRegTicket>(
         [&](const CPastelIDRegTicket& t, const unsigned int chainHeight) -> bool
@@ -866,11 +2188,11 @@ string CPastelTicketProcessor::ListFilterPastelIDTickets(const short filter, con
                     pmapIDs && pmapIDs->find(t.pastelID) != pmapIDs->cend()))
                 return false;
             return true;
-        });
+        }, true, pPage);
 }
 
 // 1 - active;    2 - inactive;     3 - sold
-string CPastelTicketProcessor::ListFilterNFTTickets(const short filter) const
+string CPastelTicketProcessor::ListFilterNFTTickets(const short filter, ticket_list_page_t* pPage) const
 {
     return filterTickets<CNFTRegTicket>(
         [&](const CNFTRegTicket& t, const unsigned int nChainHeight) -> bool
@@ -896,11 +2218,11 @@ string CPastelTicketProcessor::ListFilterNFTTickets(const short filter) const
             } else if (filter == 2)
                 return false; //don't skip inactive
             return true;
-        });
+        }, true, pPage);
 }
 
 // 1 - active; 2 - inactive
-string CPastelTicketProcessor::ListFilterActionTickets(const short filter) const
+string CPastelTicketProcessor::ListFilterActionTickets(const short filter, ticket_list_page_t* pPage) const
 {
     return filterTickets<CActionRegTicket>(
         [&](const CActionRegTicket& t, const unsigned int nChainHeight) -> bool
@@ -913,11 +2235,11 @@ string CPastelTicketProcessor::ListFilterActionTickets(const short filter) const
             } else if (filter == 2)
                 return false; //don't skip inactive
             return true;
-        });
+        }, true, pPage);
 }
 
 // 1 - available;      2 - sold
-string CPastelTicketProcessor::ListFilterActTickets(const short filter) const
+string CPastelTicketProcessor::ListFilterActTickets(const short filter, ticket_list_page_t* pPage) const
 {
     return filterTickets<CNFTActivateTicket>(
         [&](const CNFTActivateTicket& t, const unsigned int chainHeight) -> bool
@@ -935,14 +2257,14 @@ string CPastelTicketProcessor::ListFilterActTickets(const short filter) const
             } else if (filter == 2)
                 return false; //don't skip sold
             return true;
-        });
+        }, true, pPage);
 }
 // 0 - all, 1 - available; 2 - unavailable; 3 - expired; 4 - sold
-string CPastelTicketProcessor::ListFilterSellTickets(const short filter, const string& pastelID) const
+string CPastelTicketProcessor::ListFilterSellTickets(const short filter, const string& pastelID, ticket_list_page_t* pPage) const
 {
     const bool checkConfirmation{filter > 0};
     if (filter == 0 && pastelID.empty()) {
-            return ListTickets<CNFTSellTicket>(); // get all
+            return ListTickets<CNFTSellTicket>(pPage); // get all
     }
     return filterTickets<CNFTSellTicket>(
         [&](const CNFTSellTicket& t, const unsigned int chainHeight) -> bool
@@ -985,15 +2307,15 @@ string CPastelTicketProcessor::ListFilterSellTickets(const short filter, const s
                     return true;
             }
             return false;
-        }, checkConfirmation);
+        }, checkConfirmation, pPage);
 }
 
 // 0 - all, 1 - expired;    2 - sold
-string CPastelTicketProcessor::ListFilterBuyTickets(const short filter, const string& pastelID) const
+string CPastelTicketProcessor::ListFilterBuyTickets(const short filter, const string& pastelID, ticket_list_page_t* pPage) const
 {
     const bool checkConfirmation{filter > 0};
     if (filter == 0 && pastelID.empty()) {
-            return ListTickets<CNFTBuyTicket>(); // get all
+            return ListTickets<CNFTBuyTicket>(pPage); // get all
     }
     return filterTickets<CNFTBuyTicket>(
         [&](const CNFTBuyTicket& t, const unsigned int chainHeight) -> bool
@@ -1008,15 +2330,15 @@ string CPastelTicketProcessor::ListFilterBuyTickets(const short filter, const st
             } else if (filter == 1 && t.GetBlock() + masterNodeCtrl.MaxBuyTicketAge < chainHeight)
                 return false; //don't skip non sold, and expired
             return true;
-        }, checkConfirmation);
+        }, checkConfirmation, pPage);
 }
 
 // 0 - all, 1 - available;      2 - sold
-string CPastelTicketProcessor::ListFilterTradeTickets(const short filter, const string& pastelID) const
+string CPastelTicketProcessor::ListFilterTradeTickets(const short filter, const string& pastelID, ticket_list_page_t* pPage) const
 {
     const bool checkConfirmation{filter > 0};
     if (filter == 0 && pastelID.empty()) {
-            return ListTickets<CNFTTradeTicket>(); // get all
+            return ListTickets<CNFTTradeTicket>(pPage); // get all
     }
     return filterTickets<CNFTTradeTicket>(
         [&](const CNFTTradeTicket& t, const unsigned int chainHeight) -> bool
@@ -1033,7 +2355,7 @@ string CPastelTicketProcessor::ListFilterTradeTickets(const short filter, const
             } else if (filter == 2)
                 return false; //don't skip sold
             return true;
-        }, checkConfirmation);
+        }, checkConfirmation, pPage);
 }
 
 /*static*/ bool CPastelTicketProcessor::WalkBackTradingChain(
@@ -1044,14 +2366,38 @@ string CPastelTicketProcessor::ListFilterTradeTickets(const short filter, const
 {
     unique_ptr<CPastelTicket> pastelTicket;
     
-    uint256 txid;
-    txid.SetHex(sTxId);
-    //  Get ticket pointed by NFTTxnId. This is either Activation or Trade tickets (Sell, Buy, Trade)
-    try
     {
-        pastelTicket = CPastelTicketProcessor::GetTicket(txid);
+        lock_guard<mutex> lck(csTradingChainCache);
+        const auto it = mapTradingChainCache.find(sTxId);
+        if (it != mapTradingChainCache.cend())
+            pastelTicket = CloneTicket(*it->second);
+    }
+    if (!pastelTicket)
+    {
+        uint256 txid;
+        txid.SetHex(sTxId);
+        //  Get ticket pointed by NFTTxnId. This is either Activation or Trade tickets (Sell, Buy, Trade)
+        try
+        {
+            pastelTicket = CPastelTicketProcessor::GetTicket(txid);
+        }
+        catch ([[maybe_unused]] const runtime_error& ex)
+        {
+            errRet = strprintf("Ticket [txid=%s] is not in the blockchain.", sTxId);
+            return false;
+        }
+        // cache only tickets from the blockchain (block height is defined)
+        if (pastelTicket && (pastelTicket->GetBlock() != numeric_limits<uint32_t>::max()))
+        {
+            auto pCachedTicket = CloneTicket(*pastelTicket);
+            lock_guard<mutex> lck(csTradingChainCache);
+            if (mapTradingChainCache.size() >= MAX_TRADING_CHAIN_CACHE_SIZE)
+                mapTradingChainCache.clear();
+            if (pCachedTicket)
+                mapTradingChainCache.emplace(sTxId, move(pCachedTicket));
+        }
     }
-    catch ([[maybe_unused]] const runtime_error& ex)
+    if (!pastelTicket)
     {
         errRet = strprintf("Ticket [txid=%s] is not in the blockchain.", sTxId);
         return false;
@@ -1158,7 +2504,21 @@ string CPastelTicketProcessor::SendTicket(const CPastelTicket& ticket, const opt
     data_stream << nTicketID;
     data_stream << ticket;
     const size_t nUncompressedSize = data_stream.size();
+    const unsigned int chainHeight = GetActiveChainHeight();
 #ifdef ENABLE_TICKET_COMPRESS
+    // v2 (dictionary) compressor is opt-in: tickets compressed with it can't be parsed by older nodes,
+    // v1 is used until v2 is activated (-ticketcompressor value is checked on startup)
+    auto nCompressorVersion = static_cast<uint8_t>(GetArg("-ticketcompressor", DEFAULT_TICKET_COMPRESSOR_VERSION));
+    if ((nCompressorVersion == CCompressedDataStream::COMPRESSOR_VERSION_DICT) &&
+        !Params().GetConsensus().IsTicketDictCompressorActive(chainHeight + 1))
+    {
+        LogPrint("compress", "Ticket compressor v%hhu is not active yet, using v%hhu\n", nCompressorVersion, CCompressedDataStream::COMPRESSOR_VERSION);
+        nCompressorVersion = CCompressedDataStream::COMPRESSOR_VERSION;
+    }
+    if (!data_stream.SetCompressorVersion(error, nCompressorVersion))
+        throw runtime_error(strprintf("Invalid ticket compressor version. %s", error));
+    // select compression level by ticket size to fit into compression latency budget (range is checked on startup)
+    data_stream.SetAdaptiveCompressLevel(static_cast<uint32_t>(GetArg("-ticketcompresslatency", DEFAULT_TICKET_COMPRESS_LATENCY_MS)));
     // compress ticket data
     if (!data_stream.CompressData(error, sizeof(TicketID), 
         [&](CSerializeData::iterator start, CSerializeData::iterator end)
@@ -1168,13 +2528,11 @@ string CPastelTicketProcessor::SendTicket(const CPastelTicket& ticket, const opt
         }))
         throw runtime_error(strprintf("Failed to compress ticket (%s) data. %s", ticket.GetTicketName(), error));
     if (data_stream.IsCompressed())
-        LogPrint("compress", "Ticket (%hhu) data compressed [%zu]->[%zu]\n", to_integral_type<TicketID>(ticket.ID()), nUncompressedSize, data_stream.size() + 1);
+        LogPrint("compress", "Ticket (%hhu) data compressed [%zu]->[%zu], level %d\n", to_integral_type<TicketID>(ticket.ID()), nUncompressedSize, data_stream.size() + 1, data_stream.GetCompressLevel());
     else
         LogPrint("compress", "Ticket (%hhu) data [%zu bytes] was not compressed due to size or bad compression ratio\n", to_integral_type<TicketID>(ticket.ID()), nUncompressedSize);
 #endif
 
-    unsigned int chainHeight = GetActiveChainHeight();
-
     CMutableTransaction tx;
     if (!CreateP2FMSTransactionWithExtra(data_stream, extraOutputs, extraAmount, tx, 
         ticket.TicketPrice(chainHeight), sFundingAddress, error))
@@ -1252,7 +2610,7 @@ bool isValuePassFuzzyFilter(const json &jProp, const string &sPropFilterValue) n
  * \param p - structure with search criterias
  * \param fnMatchFound - functor to apply when NFT registration ticket found that matches all search criterias
  */
-void CPastelTicketProcessor::SearchForNFTs(const search_thumbids_t& p, function<size_t(const CPastelTicket*, const json&)> &fnMatchFound) const
+void CPastelTicketProcessor::SearchForNFTs(const search_thumbids_t& p, function<size_t(const string&, const CNFTSearchProps&)> &fnMatchFound) const
 {
     v_strings vPastelIDs;
     // Creator PastelID can have special 'mine' value
@@ -1265,14 +2623,28 @@ void CPastelTicketProcessor::SearchForNFTs(const search_thumbids_t& p, function<
             for (const auto& [sPastelID, sLegRoastPubKey] : mapIDs)
                 vPastelIDs.push_back(sPastelID);
         }
-    } else
+    } else if (!p.sCreatorPastelId.empty())
         vPastelIDs.push_back(p.sCreatorPastelId);
-    size_t nResultCount = 0;
-    string sDataBase64, sData;
-    // process NFT activation tickets by PastelID (mvkey #1)
-    for (const auto &sPastelID : vPastelIDs)
+
+    // fuzzy search filters: <nft app ticket property name, filter value>
+    // filter values for the stored search properties are lowercased - these properties are stored lowercased
+    vector<pair<string, string>> vFuzzyFilters;
+    vFuzzyFilters.reserve(p.fuzzySearchMap.size());
+    for (const auto &[sSearchProp, sPropFilterValue] : p.fuzzySearchMap)
     {
-        ProcessTicketsByMVKey<CNFTActivateTicket>(sPastelID, [&](const CNFTActivateTicket& actTicket) -> bool
+        // first let's check if we have any fuzzy search mappings (search keyword->nft ticket property name)
+        const auto itMapping = p.fuzzyMappings.find(sSearchProp);
+        // found property name in the map -> use it, otherwise try to use search property and nft ticket property name as is
+        string sPropName = itMapping != p.fuzzyMappings.cend() ? itMapping->second : sSearchProp;
+        if (CNFTSearchProps::IsFuzzyProp(sPropName))
+            vFuzzyFilters.emplace_back(move(sPropName), lowercase(sPropFilterValue));
+        else
+            vFuzzyFilters.emplace_back(move(sPropName), sPropFilterValue);
+    }
+
+    size_t nResultCount = 0;
+    string error;
+    const auto fnProcessActTicket = [&](const CNFTActivateTicket& actTicket) -> bool
         {
             // check if we exceeded max results
             if (p.nMaxResultCount.has_value() && (nResultCount >= p.nMaxResultCount.value()))
@@ -1285,98 +2657,117 @@ void CPastelTicketProcessor::SearchForNFTs(const search_thumbids_t& p, function<
                     break;
 
                 const auto& regTxId = actTicket.getRegTxId();
-                // find NFT registration ticket by txid
-                auto pNftTicketPtr = CPastelTicketProcessor::GetTicket(regTxId, TicketID::NFT);
-                if (!pNftTicketPtr)
-                    break;
-                auto pNftTicket = dynamic_cast<const CNFTRegTicket*>(pNftTicketPtr.get());
-                if (!pNftTicket)
-                    break;
+                // NFT registration ticket is loaded only if search properties are not stored
+                // or fuzzy search uses app ticket properties that are not stored
+                unique_ptr<CPastelTicket> pNftTicketPtr;
+                const CNFTRegTicket* pNftTicket = nullptr;
+                auto fnLoadNftTicket = [&]() -> bool
+                {
+                    if (pNftTicket)
+                        return true;
+                    // find NFT registration ticket by txid
+                    pNftTicketPtr = CPastelTicketProcessor::GetTicket(regTxId, TicketID::NFT);
+                    pNftTicket = dynamic_cast<const CNFTRegTicket*>(pNftTicketPtr.get());
+                    return pNftTicket != nullptr;
+                };
+                CNFTSearchProps props;
+                if (!GetNFTSearchProps(regTxId, props))
+                {
+                    if (!fnLoadNftTicket())
+                        break;
+                    if (!props.Extract(*pNftTicket, error))
+                    {
+                        LogPrintf("ERROR: %s (%s)\n", error, regTxId);
+                        break;
+                    }
+                }
                 // filter by number of copies
-                if (p.copyCount.has_value() && !p.copyCount.value().contains(pNftTicket->getTotalCopies()))
+                if (p.copyCount.has_value() && !p.copyCount.value().contains(props.nTotalCopies))
                     break;
-                // NFT ticket data are base64 encoded
-                bool bInvalid = false;
-                sData = DecodeBase64(pNftTicket->ToStr(), &bInvalid);
-                if (bInvalid)
-                {
-                    LogPrintf("ERROR: failed to decode base64 encoded NFT ticket (%s)", regTxId);
+                // filter by rareness score
+                if (p.rarenessScore.has_value() && props.bHasRarenessScore && !p.rarenessScore.value().contains(props.nRarenessScore))
                     break;
-                }
-                json j;
-                try
-                {
-                    // parse NFT ticket json
-                    j = json::parse(sData);
-                } catch (const json::exception& ex)
-                {
-                    LogPrintf("ERROR: failed to parse NFT ticket json (%s). %s", regTxId, SAFE_SZ(ex.what()));
+                // filter by nsfw score
+                if (p.nsfwScore.has_value() && props.bHasNsfwScore && !p.nsfwScore.value().contains(props.nNsfwScore))
                     break;
-                }
-                json jApp; // app ticket json
-                if (j.contains("app_ticket"))
+                // fuzzy search
+                bool bPassedFilter = true;
+                json jApp; // app ticket json, parsed only for the properties that are not stored
+                bool bAppTicketParsed = false;
+                for (const auto &[sPropName, sPropFilterValue] : vFuzzyFilters)
                 {
-                    const json &jAppTicketBase64 = j["app_ticket"];
-                    if (jAppTicketBase64.is_string())
+                    // only string values of the fuzzy search properties are stored
+                    const string* psPropValue = CNFTSearchProps::IsFuzzyProp(sPropName) ? props.GetFuzzyProp(sPropName) : nullptr;
+                    if (psPropValue)
                     {
-                        bInvalid = false;
-                        jAppTicketBase64.get_to(sDataBase64);
-                        sData = DecodeBase64(sDataBase64, &bInvalid);
-                        if (bInvalid)
-                        {
-                            LogPrintf("ERROR: failed to decode base64 encoded NFT app ticket (%s)", regTxId);
-                            break;
-                        }
-                        try
-                        {
-                            // parse app ticket json
-                            jApp = json::parse(sData);
-                        } catch (const json::exception& ex)
+                        // stored property value and filter value are lowercased
+                        bPassedFilter = psPropValue->find(sPropFilterValue) != string::npos;
+                    } else
+                    {
+                        // property is not stored or has non-string value (number or boolean) - check it in the app ticket
+                        if (!bAppTicketParsed)
                         {
-                            LogPrintf("ERROR: failed to parse NFT app ticket json (%s). %s", regTxId, SAFE_SZ(ex.what()));
-                            break;
+                            bAppTicketParsed = true;
+                            if (!fnLoadNftTicket() || !CNFTSearchProps::ParseAppTicket(*pNftTicket, jApp, error))
+                            {
+                                bPassedFilter = false;
+                                break;
+                            }
                         }
+                        if (!jApp.contains(sPropName))
+                            continue; // just skip unknown properties
+                        bPassedFilter = isValuePassFuzzyFilter(jApp[sPropName], sPropFilterValue);
                     }
-                }
-                uint32_t nScore;
-                // filter by rareness score
-                if (p.rarenessScore.has_value() && jApp.contains("rareness_score"))
-                {
-                    jApp["rareness_score"].get_to(nScore);
-                    if (!p.rarenessScore.value().contains(nScore))
-                        break;
-                }
-                // filter by nsfw score
-                if (p.nsfwScore.has_value() && jApp.contains("nsfw_score"))
-                {
-                    jApp["nsfw_score"].get_to(nScore);
-                    if (!p.nsfwScore.value().contains(nScore))
+                    if (!bPassedFilter)
                         break;
                 }
-                // nft reg app ticket properties (name: value)
-                string sPropName, sPropValue;
-                // fuzzy search (key is lowercased in the fuzzySearchMap)
-                bool bPassedFilter = true;
-                for (const auto &[sSearchProp, sPropFilterValue] : p.fuzzySearchMap)
-                {
-                    // first let's check if we have any fuzzy search mappings (search keyword->nft ticket property name)
-                    const auto itMapping = p.fuzzyMappings.find(sSearchProp);
-                    if (itMapping != p.fuzzyMappings.cend())
-                        sPropName = itMapping->second; // found property name in the map -> use it
-                    else
-                        sPropName = sSearchProp; // try to use search property and nft ticket property name as is
-                    if (!jApp.contains(sPropName))
-                        continue; // just skip unknown properties
-                    bPassedFilter = isValuePassFuzzyFilter(jApp[sPropName], sPropFilterValue);
-                }
                 if (!bPassedFilter)
                     break;
                 // add NFT reg ticket info to the json array
-                nResultCount = fnMatchFound(pNftTicket, jApp);
+                nResultCount = fnMatchFound(regTxId, props);
             } while (false);
             return true;
+        };
+    // global search (creator is not defined) - use fuzzy search trigram index to find candidates
+    const bool bGlobalSearch = p.sCreatorPastelId.empty();
+    set<string> setRegTxIds;
+    if (bGlobalSearch && findNFTsByTrigrams(vFuzzyFilters, setRegTxIds))
+    {
+        const auto itDB = dbs.find(TicketID::Activate);
+        if (itDB == dbs.cend())
+            return;
+        for (const auto& sRegTxId : setRegTxIds)
+        {
+            // NFT activation ticket primary key is NFT registration ticket txid
+            CNFTActivateTicket actTicket;
+            if (!itDB->second->Read(sRegTxId, actTicket))
+                continue;
+            if (!fnProcessActTicket(actTicket))
+                break;
+        }
+        return;
+    }
+    if (p.blockRange.has_value())
+    {
+        // process NFT activation tickets registered in the block range using height index
+        const unordered_set<string> setPastelIDs(vPastelIDs.cbegin(), vPastelIDs.cend());
+        ProcessTicketsByHeight<CNFTActivateTicket>(p.blockRange.value(), [&](const CNFTActivateTicket& actTicket) -> bool
+        {
+            if (!bGlobalSearch && !setPastelIDs.count(actTicket.getPastelID()))
+                return true;
+            return fnProcessActTicket(actTicket);
         });
-    } // for
+        return;
+    }
+    if (bGlobalSearch)
+    {
+        // no creator, no indexed filters - process all NFT activation tickets
+        ProcessTicketsByHeight<CNFTActivateTicket>(numeric_range<uint32_t>(0, numeric_limits<uint32_t>::max()), fnProcessActTicket);
+        return;
+    }
+    // process NFT activation tickets by PastelID (mvkey #1)
+    for (const auto &sPastelID : vPastelIDs)
+        ProcessTicketsByMVKey<CNFTActivateTicket>(sPastelID, fnProcessActTicket);
 }
 
 /**
@@ -1623,7 +3014,16 @@ bool CPastelTicketProcessor::StoreP2FMSTransaction(const CMutableTransaction& tx
 bool CPastelTicketProcessor::ParseP2FMSTransaction(const CMutableTransaction& tx_in, string& output_string, string& error)
 {
     CSerializeData output_data;
-    const bool bOk = ParseP2FMSTransaction(tx_in, output_data, error);
+    const bool bOk = parseP2FMSOutputs(tx_in.vout, output_data, error);
+    if (bOk)
+        output_string = vector_to_string(output_data);
+    return bOk;
+}
+
+bool CPastelTicketProcessor::ParseP2FMSTransaction(const CTransaction& tx_in, string& output_string, string& error)
+{
+    CSerializeData output_data;
+    const bool bOk = parseP2FMSOutputs(tx_in.vout, output_data, error);
     if (bOk)
         output_string = vector_to_string(output_data);
     return bOk;
@@ -1639,38 +3039,136 @@ bool CPastelTicketProcessor::ParseP2FMSTransaction(const CMutableTransaction& tx
  */
 bool CPastelTicketProcessor::ParseP2FMSTransaction(const CMutableTransaction& tx_in, CSerializeData& output_data, string& error_ret)
 {
-    bool bFoundMS = false;
-    // reuse vector to process tx outputs
-    vector<v_uint8> vSolutions;
+    return parseP2FMSOutputs(tx_in.vout, output_data, error_ret);
+}
+
+bool CPastelTicketProcessor::ParseP2FMSTransaction(const CTransaction& tx_in, CSerializeData& output_data, string& error_ret)
+{
+    return parseP2FMSOutputs(tx_in.vout, output_data, error_ret);
+}
 
-    for (const auto& vout : tx_in.vout)
+/**
+ * Get fake keys (data chunks) from the P2FMS output script.
+ * Matches the same template as Solver for TX_MULTISIG: OP_m <33..65 bytes pubkeys> OP_n OP_CHECKMULTISIG,
+ * but does not copy script data - returned chunks point to the script buffer.
+ * 
+ * \param script - transaction output script
+ * \param vChunks - fake key chunks are appended to this vector
+ * \param nChunksSize - returns total size of the fake key chunks found in the script
+ * \return true if script is a multisig script
+ */
+static bool GetP2FMSScriptChunks(const CScript& script, vector<p2fms_chunk_t>& vChunks, size_t& nChunksSize)
+{
+    const size_t nSavedChunks = vChunks.size();
+    opcodetype opcode;
+    auto pc = script.begin();
+    // m - number of required signatures
+    if (!script.GetOp(pc, opcode) || opcode < OP_1 || opcode > OP_16)
+        return false;
+    const int m = CScript::DecodeOP_N(opcode);
+    size_t nSize = 0;
+    while (true)
+    {
+        const auto pcOp = pc;
+        if (!script.GetOp(pc, opcode))
+            break;
+        if (opcode > OP_PUSHDATA4)
+            break;
+        // push data header size: opcode + optional data size (1, 2 or 4 bytes)
+        size_t nHeaderSize = 1;
+        if (opcode == OP_PUSHDATA1)
+            nHeaderSize += 1;
+        else if (opcode == OP_PUSHDATA2)
+            nHeaderSize += 2;
+        else if (opcode == OP_PUSHDATA4)
+            nHeaderSize += 4;
+        const size_t nChunkSize = (pc - pcOp) - nHeaderSize;
+        if (nChunkSize < 33 || nChunkSize > 65)
+            break;
+        vChunks.emplace_back(&pcOp[nHeaderSize], nChunkSize);
+        nSize += nChunkSize;
+    }
+    // n - number of public keys, followed by OP_CHECKMULTISIG at the end of the script
+    const size_t nKeys = vChunks.size() - nSavedChunks;
+    bool bRet = opcode >= OP_1 && opcode <= OP_16;
+    if (bRet)
+    {
+        const int n = CScript::DecodeOP_N(opcode);
+        bRet = (m <= n) && (nKeys == static_cast<size_t>(n)) &&
+            script.GetOp(pc, opcode) && (opcode == OP_CHECKMULTISIG) && (pc == script.end());
+    }
+    if (!bRet)
     {
-        txnouttype typeRet; // script type
-        vSolutions.clear();
+        vChunks.resize(nSavedChunks);
+        return false;
+    }
+    nChunksSize += nSize;
+    return true;
+}
 
-        if (!Solver(vout.scriptPubKey, typeRet, vSolutions) || typeRet != TX_MULTISIG)
+/**
+ * Copy part of the P2FMS data defined by the chunks into the buffer.
+ * 
+ * \param vChunks - fake key chunks
+ * \param nOffset - offset of the data to copy (from the start of the first chunk)
+ * \param pDst - destination buffer
+ * \param nSize - size of the data to copy, should be available in chunks
+ */
+static void CopyP2FMSChunksData(const vector<p2fms_chunk_t>& vChunks, size_t nOffset, unsigned char* pDst, size_t nSize) noexcept
+{
+    for (const auto& [pChunk, nChunkSize] : vChunks)
+    {
+        if (!nSize)
+            break;
+        if (nOffset >= nChunkSize)
+        {
+            nOffset -= nChunkSize;
             continue;
+        }
+        const size_t nCopySize = min(nChunkSize - nOffset, nSize);
+        memcpy(pDst, pChunk + nOffset, nCopySize);
+        pDst += nCopySize;
+        nSize -= nCopySize;
+        nOffset = 0;
+    }
+}
+
+/**
+ * Reads P2FMS (Pay-to-Fake-Multisig) transaction outputs into output_data byte vector.
+ * Fake keys are not copied - data is reassembled from the output scripts directly 
+ * into the output_data buffer allocated only once.
+ * 
+ * \param vTxOut - transaction outputs
+ * \param output_data - output byte vector
+ * \param error_ret - returns an error if any
+ * \return true if P2FMS was found in the transaction outputs and successfully parsed, validated and copied to the output data
+ */
+bool CPastelTicketProcessor::parseP2FMSOutputs(const vector<CTxOut>& vTxOut, CSerializeData& output_data, string& error_ret)
+{
+    bool bFoundMS = false;
+    // each P2FMS script holds up to 3 fake keys
+    vector<p2fms_chunk_t> vChunks;
+    vChunks.reserve(vTxOut.size() * 3);
+    size_t nDataSize = 0;
 
-        bFoundMS = true;
-        size_t nReserve = 0;
-        for (size_t i = 1; vSolutions.size() - 1 > i; i++)
-            nReserve += vSolutions[i].size();
-        output_data.reserve(output_data.size() + nReserve);
-        for (size_t i = 1; vSolutions.size() - 1 > i; i++)
-            output_data.insert(output_data.end(), vSolutions[i].cbegin(), vSolutions[i].cend());
+    for (const auto& vout : vTxOut)
+    {
+        if (GetP2FMSScriptChunks(vout.scriptPubKey, vChunks, nDataSize))
+            bFoundMS = true;
     }
 
     bool bRet = false;
     do
     {
         error_ret.clear();
+        output_data.clear();
         if (!bFoundMS)
         {
             error_ret = "No data multisigs found in transaction";
             break;
         }
 
-        if (output_data.empty())
+        if (!nDataSize)
         {
             error_ret = "No data found in transaction";
             break;
@@ -1678,33 +3176,40 @@ bool CPastelTicketProcessor::ParseP2FMSTransaction(const CMutableTransaction& tx
 
         constexpr auto DATA_POS = uint256::SIZE + sizeof(uint64_t);
         //size_t size = 8 bytes; hash size = 32 bytes
-        if (output_data.size() < DATA_POS)
+        if (nDataSize < DATA_POS)
         {
             error_ret = "No correct data found in transaction";
             break;
         }
 
-        // interpret first 8-bytes as an output size
-        const auto nOutputLength = *reinterpret_cast<const uint64_t*>(output_data.data());
-        v_uint8 input_hash_vec(output_data.cbegin() + sizeof(uint64_t), output_data.cbegin() + DATA_POS); //hash length == 32
-        // erase [size(8 bytes) + hash(32-bytes)], leave data only
-        output_data.erase(output_data.cbegin(), output_data.cbegin() + DATA_POS);
-
-        if (output_data.size() < nOutputLength)
+        // +------------- P2FMS data -------------------------+---------+
+        // |     8 bytes     |    32 bytes     | nOutputLength | padding |
+        // +-----------------+-----------------+---------------+---------+
+        // |  nOutputLength  | input data hash |  output data  |         |
+        // +-----------------+-----------------+---------------+---------+
+        unsigned char header[DATA_POS];
+        CopyP2FMSChunksData(vChunks, 0, header, DATA_POS);
+        uint64_t nOutputLength = 0;
+        memcpy(&nOutputLength, header, sizeof(uint64_t));
+
+        if (nDataSize - DATA_POS < nOutputLength)
         {
             error_ret = "No correct data found in transaction - length is not matching";
             break;
         }
 
-        if (output_data.size() > nOutputLength)
-            output_data.erase(output_data.cbegin() + nOutputLength, output_data.cend());
+        // copy data only, skip header and padding
+        output_data.resize(nOutputLength);
+        CopyP2FMSChunksData(vChunks, DATA_POS, reinterpret_cast<unsigned char*>(output_data.data()), nOutputLength);
 
-        const uint256 input_hash_stored(input_hash_vec);
+        uint256 input_hash_stored;
+        memcpy(input_hash_stored.begin(), header + sizeof(uint64_t), uint256::SIZE);
         const uint256 input_hash_real = Hash(output_data.cbegin(), output_data.cend());
 
         if (input_hash_stored != input_hash_real)
         {
             error_ret = "No correct data found in transaction - hash is not matching";
+            output_data.clear();
             break;
         }
         bRet = true;
@@ -1722,40 +3227,20 @@ bool CPastelTicketProcessor::ParseP2FMSTransaction(const CMutableTransaction& tx
  */
 optional<reg_trade_txid_t> CPastelTicketProcessor::ValidateOwnership(const string &_txid, const string &_pastelID)
 {
-    optional<reg_trade_txid_t> retVal;
-    try
-    {
-        // Find ticket by txid
-        auto ticket = CPastelTicketProcessor::GetTicket(_txid, TicketID::NFT);
-        auto NFTTicket = dynamic_cast<CNFTRegTicket*>(ticket.get());
-        if (!NFTTicket)
-            return nullopt;
-
-        // Check if creator and _pastelID are equal
-        if ((NFTTicket->IsCreatorPastelId(_pastelID)) && CNFTActivateTicket::CheckTicketExistByNFTTicketID(NFTTicket->GetTxId()))
-            return make_tuple(_txid, "");
-
-    }
-    catch(const runtime_error& e)
-    {
-        LogPrintf("Was not able to process ValidateOwnership request due to: %s\n", e.what()); 
-    }
-
-    //If we are here it means it is a nested trade ticket 
-    //List trade tickets by reg txID and rearrange them by blockheight
-    const auto tradeTickets = CNFTTradeTicket::FindAllTicketByRegTnxID(_txid);
-    
-    // Go through each if not empty and rearrange them by block-height
-    if(!tradeTickets.empty())
+    // activation ticket is stored under NFT registration txid and can be registered only by the NFT creator
+    CNFTActivateTicket actTicket;
+    if (CNFTActivateTicket::FindTicketInDb(_txid, actTicket) && (actTicket.getPastelID() == _pastelID))
+        return make_tuple(_txid, "");
+
+    // check current owners of the traded NFT copies in the ownership index
+    map<string, CNFTCopyOwner> mapOwners;
+    GetNFTCopyOwners(_txid, mapOwners);
+    for (const auto& [sCopySerialNr, owner] : mapOwners)
     {
-        //sort(tradeTickets.begin(), tradeTickets.end(), [](CNFTTradeTicket & one, CNFTTradeTicket & two){return one.GetBlock() < two.GetBlock();});
-        const auto ownersPastelIds_with_TxIds = CNFTTradeTicket::GetPastelIdAndTxIdWithTopHeightPerCopy(tradeTickets);
-        const auto it = ownersPastelIds_with_TxIds.find(_pastelID);
-        if (it != ownersPastelIds_with_TxIds.cend())
-            retVal = make_tuple(_txid, it->second);
+        if (owner.sOwnerPastelID == _pastelID)
+            return make_tuple(_txid, owner.sTradeTxId);
     }
-
-    return retVal;
+    return nullopt;
 }
 
 #ifdef FAKE_TICKET
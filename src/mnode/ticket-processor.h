@@ -9,6 +9,7 @@
 
 #include <dbwrapper.h>
 #include <chain.h>
+#include <primitives/block.h>
 #include <str_types.h>
 #include <map_types.h>
 #include <numeric_range.h>
@@ -18,12 +19,104 @@
 #include <mnode/mnode-consts.h>
 #include <mnode/tickets/ticket-types.h>
 #include <mnode/tickets/ticket.h>
+#include <mnode/ticket-undo.h>
+#include <mnode/tickets/nft-search-props.h>
 #include <datacompressor.h>
+#include <crypto/common.h>
 
 constexpr int DATASTREAM_VERSION = 1;
 constexpr uint8_t TICKET_COMPRESS_ENABLE_MASK  = (1<<7); // using bit 7 to mark a ticket is compressed
 constexpr uint8_t TICKET_COMPRESS_DISABLE_MASK = 0x7F;
 
+// ticket DB format version, stored in each ticket DB under TICKET_DB_VERSION_KEY
+//   0 - legacy format: multi-value key "@M@<mvkey>" -> serialized vector of primary keys
+//   1 - multi-value keys are stored as composite keys <"@M@<mvkey>", primary key>
+//   2 - added height index <"@H@", block height, primary key>
+//   3 - added NFT search properties <"@S@", NFT registration txid> -> CNFTSearchProps (NFT ticket DB only)
+//   4 - added NFT fuzzy search trigram index <"@T@", property index, trigram, NFT registration txid> (NFT ticket DB only)
+//   5 - added NFT ownership index <"@O@", <NFT registration txid, copy serial number>> -> CNFTCopyOwner (NFT trade ticket DB only)
+//   6 - NFTs without string value of the fuzzy search property are added to the trigram index with empty trigram,
+//       search properties of the overwritten NFT registration tickets are removed (NFT ticket DB only)
+constexpr uint32_t TICKET_DB_VERSION = 6;
+constexpr auto TICKET_DB_VERSION_KEY = "@V@";
+constexpr auto TICKET_HEIGHT_KEY_PREFIX = "@H@";
+constexpr auto NFT_SEARCH_PROPS_KEY_PREFIX = "@S@";
+constexpr auto NFT_OWNERSHIP_KEY_PREFIX = "@O@";
+
+// composite multi-value key: <"@M@<mvkey>", primary key>
+using ticket_mvkey_t = std::pair<std::string, std::string>;
+// NFT ownership key: <"@O@", <NFT registration txid, copy serial number>>
+using nft_ownership_key_t = std::pair<std::string, std::pair<std::string, std::string>>;
+
+/**
+ * Current owner of the NFT copy - the last trade ticket in the copy trading chain.
+ */
+class CNFTCopyOwner
+{
+public:
+    std::string sOwnerPastelID; // PastelID of the current copy owner
+    std::string sTradeTxId;     // txid of the last trade ticket for this copy
+    uint32_t nHeight = 0;       // block height of the last trade ticket
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream>
+    inline void SerializationOp(Stream& s, const SERIALIZE_ACTION ser_action)
+    {
+        READWRITE(sOwnerPastelID);
+        READWRITE(sTradeTxId);
+        READWRITE(nHeight);
+    }
+};
+
+/**
+ * Height index key: <"@H@", block height, primary key>.
+ * Block height is serialized in big-endian byte order,
+ * so the keys are ordered by block height in the ticket DB.
+ */
+class CTicketHeightKey
+{
+public:
+    std::string sPrefix;     // TICKET_HEIGHT_KEY_PREFIX
+    uint32_t nHeight = 0;    // ticket block height
+    std::string sPrimaryKey; // ticket primary key
+
+    CTicketHeightKey() = default;
+    CTicketHeightKey(const uint32_t nBlockHeight, const std::string& sKey) :
+        sPrefix(TICKET_HEIGHT_KEY_PREFIX),
+        nHeight(nBlockHeight),
+        sPrimaryKey(sKey)
+    {}
+
+    bool IsValid() const noexcept { return sPrefix == TICKET_HEIGHT_KEY_PREFIX; }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream>
+    inline void SerializationOp(Stream& s, const SERIALIZE_ACTION ser_action)
+    {
+        unsigned char vHeight[4];
+        if (ser_action == SERIALIZE_ACTION::Write)
+            WriteBE32(vHeight, nHeight);
+        READWRITE(sPrefix);
+        READWRITE(FLATDATA(vHeight));
+        if (ser_action == SERIALIZE_ACTION::Read)
+            nHeight = ReadBE32(vHeight);
+        READWRITE(sPrimaryKey);
+    }
+};
+
+// compressor version used by default for the new tickets (CCompressedDataStream::COMPRESSOR_VERSION)
+constexpr uint8_t DEFAULT_TICKET_COMPRESSOR_VERSION = 1;
+// ticket compression latency budget in ms used to select compression level by ticket size (0 - always use max level)
+constexpr uint32_t DEFAULT_TICKET_COMPRESS_LATENCY_MS = 250;
+
+// number of threads used to rebuild ticket DBs (0 = auto, <0 = leave that many cores free)
+constexpr int DEFAULT_TICKET_REINDEX_THREADS = 0;
+constexpr int MAX_TICKET_REINDEX_THREADS = 16;
+// number of blocks processed by the ticket reindex worker at once
+constexpr uint32_t TICKET_REINDEX_RANGE_SIZE = 500;
+
 // tuple <NFT registration txid, NFT trade txid>
 using reg_trade_txid_t = std::tuple<std::string, std::string>;
 
@@ -43,7 +136,7 @@ typedef struct _search_thumbids_t
         { "descr", "creator_written_statement" }
     };
 
-    // PastelID of the creator - mandatory
+    // PastelID of the creator, empty - search across all creators
     std::string sCreatorPastelId;
     // block range for nft activation ticket search
     std::optional<numeric_range<uint32_t>> blockRange = std::nullopt;
@@ -59,25 +152,51 @@ typedef struct _search_thumbids_t
     mu_strings fuzzySearchMap;
 } search_thumbids_t;
 
+// page of tickets used by 'tickets list' and 'tickets find' rpcs
+typedef struct _ticket_list_page_t
+{
+    // primary key of the first ticket in the page, empty - start from the first ticket
+    std::string sStartKey;
+    // max number of tickets in the page, 0 - no limit
+    size_t nLimit = 0;
+    // returns primary key of the first ticket of the next page, empty if there are no more tickets
+    std::string sNextKey;
+} ticket_list_page_t;
+
 // Check if json value passes fuzzy search filter
 bool isValuePassFuzzyFilter(const nlohmann::json& jProp, const std::string& sPropFilterValue) noexcept;
 
 // Ticket  Processor ////////////////////////////////////////////////////////////////////////////////////////////////////
 class CPastelTicketProcessor
 {
+    friend class TestTicketProcessorUndo; // class for unit testing
+
     using db_map_t = std::unordered_map<TicketID, std::unique_ptr<CDBWrapper>>;
     db_map_t dbs; // ticket db storage
+    std::unique_ptr<CDBWrapper> undoDB; // ticket undo records for the last MAX_REORG_LENGTH blocks and ticket DB tip
+    int nTicketDBHeight{-1};            // height of the last block indexed in the ticket DBs (-1 - none)
+    uint256 hashTicketDBTip;            // hash of the last block indexed in the ticket DBs
 
+    // apply functor f to the page of tickets of the specific type
     template <class _TicketType, typename F>
-    void listTickets(F f) const;
+    void listTickets(F f, ticket_list_page_t* pPage = nullptr) const;
 
     // filter tickets of the specific type using functor f
     template <class _TicketType, typename F>
-    std::string filterTickets(F f, const bool bCheckConfirmation = true) const;
+    std::string filterTickets(F f, const bool bCheckConfirmation = true, ticket_list_page_t* pPage = nullptr) const;
 
     template <class _TicketType, typename F>
     void ProcessTicketsByMVKey(const std::string& mvKey, F f) const;
 
+    // apply functor F to all primary keys in the height index within block height range starting from startKey
+    template <typename F>
+    static void processHeightKeys(const CDBWrapper& db, const numeric_range<uint32_t>& heightRange, F f,
+        const CTicketHeightKey* pStartKey = nullptr);
+
+    // apply functor F to all primary keys stored under the multi-value key starting from sStartKey
+    template <typename F>
+    static void processMVKeys(const CDBWrapper& db, const std::string& mvKey, F f, const std::string& sStartKey = "");
+
 public:
     CPastelTicketProcessor() = default;
 
@@ -85,14 +204,36 @@ public:
     static std::unique_ptr<CPastelTicket> CreateTicket(const TicketID ticketId);
 
     void InitTicketDB();
-    void UpdatedBlockTip(const CBlockIndex* cBlockIndex, bool fInitialDownload);
-    bool ParseTicketAndUpdateDB(CMutableTransaction& tx, const unsigned int nBlockHeight);
+    // index tickets of the block connected to the active chain
+    void ConnectBlock(const CBlockIndex* pindex, const CBlock& block);
+    // revert tickets of the block disconnected from the active chain
+    void DisconnectBlock(const CBlockIndex* pindex, const CBlock& block);
+    // index tickets of all blocks up to pindexTip not yet indexed in the ticket DBs
+    bool SyncTicketDB(const CBlockIndex* pindexTip, std::string& error);
+    // parse ticket from the transaction, returns nullptr if transaction is not a valid ticket
+    static std::unique_ptr<CPastelTicket> ParseTicket(const CTransaction& tx, const uint32_t nBlockHeight, std::string& error);
 
     static std::string RealKeyTwo(const std::string& key) { return "@2@" + key; }
     static std::string RealMVKey(const std::string& key) { return "@M@" + key; }
+    static ticket_mvkey_t RealMVKey(const std::string& key, const std::string& sPrimaryKey) { return std::make_pair(RealMVKey(key), sPrimaryKey); }
+    // convert legacy vector-based multi-value keys into composite keys
+    static size_t UpgradeDB_MVK(CDBWrapper& db);
+    // build height index for all tickets in the ticket DB
+    static size_t UpgradeDB_HeightIndex(CDBWrapper& db, const TicketID id);
+    // extract search properties for all NFT registration tickets in the NFT ticket DB
+    static size_t UpgradeDB_NFTSearchProps(CDBWrapper& db);
+    static ticket_mvkey_t NFTSearchPropsKey(const std::string& sRegTxId) { return std::make_pair(NFT_SEARCH_PROPS_KEY_PREFIX, sRegTxId); }
+    // build NFT ownership index for all trade tickets in the NFT trade ticket DB
+    static size_t UpgradeDB_NFTOwnership(CDBWrapper& db);
+    static nft_ownership_key_t NFTOwnershipKey(const std::string& sRegTxId, const std::string& sCopySerialNr)
+    {
+        return std::make_pair(NFT_OWNERSHIP_KEY_PREFIX, std::make_pair(sRegTxId, sCopySerialNr));
+    }
 
     bool UpdateDB(CPastelTicket& ticket, std::string& txid, const unsigned int nBlockHeight);
-    void UpdateDB_MVK(const CPastelTicket& ticket, const std::string& mvKey);
+    // write tickets to the ticket DBs using one batch per ticket type
+    void UpdateDB(const PastelTickets_t& vTickets);
+    static void UpdateDB_MVK(const CPastelTicket& ticket, const std::string& mvKey, CDBBatch& batch);
 
     bool CheckTicketExist(const CPastelTicket& ticket);
     bool FindTicket(CPastelTicket& ticket) const;
@@ -102,26 +243,42 @@ public:
 
     template <class _TicketType>
     std::vector<_TicketType> FindTicketsByMVKey(const std::string& mvKey);
+    // apply functor f to tickets registered in the block height range (in block height order)
+    template <class _TicketType, typename F>
+    void ProcessTicketsByHeight(const numeric_range<uint32_t>& heightRange, F f) const;
 
     v_strings GetAllKeys(const TicketID id) const;
 
     std::string getValueBySecondaryKey(const CPastelTicket& ticket) const;
 
+    // list tickets of the specific type, if pPage is defined - list only one page
+    template <class _TicketType>
+    std::string ListTickets(ticket_list_page_t* pPage = nullptr) const;
+    // list tickets of the specific type stored under the multi-value key
     template <class _TicketType>
-    std::string ListTickets() const;
+    std::string ListTicketsByMVKey(const std::string& mvKey, ticket_list_page_t* pPage = nullptr) const;
+    // check if any ticket of the specific type is stored under the multi-value key
+    bool HasTicketsByMVKey(const TicketID id, const std::string& mvKey) const;
+    // list tickets of the specific type registered at or after nMinHeight (in block height order)
+    template <class _TicketType>
+    std::string ListTicketsByHeight(const uint32_t nMinHeight, ticket_list_page_t* pPage = nullptr) const;
 
     // list NFT registration tickets using filter
     std::string ListFilterPastelIDTickets(const short filter = 0, // 1 - mn;        2 - personal;     3 - mine
-                                          const pastelid_store_t* pmapIDs = nullptr) const;
-    std::string ListFilterNFTTickets(const short filter = 0) const;   // 1 - active;    2 - inactive;     3 - sold
-    std::string ListFilterActTickets(const short filter = 0) const;   // 1 - available; 2 - sold
-    std::string ListFilterSellTickets(const short filter = 0, const std::string& pastelID = "") const;  // 0 - all, 1 - available; 2 - unavailable;  3 - expired; 4 - sold
-    std::string ListFilterBuyTickets(const short filter = 0, const std::string& pastelID = "") const;   // 0 - all, 1 - traded;    2 - expired
-    std::string ListFilterTradeTickets(const short filter = 0, const std::string& pastelID = "") const; // 0 - all, 1 - available; 2 - sold
-    std::string ListFilterActionTickets(const short filter = 0) const; // 1 - active;    2 - inactive
+                                          const pastelid_store_t* pmapIDs = nullptr, ticket_list_page_t* pPage = nullptr) const;
+    std::string ListFilterNFTTickets(const short filter = 0, ticket_list_page_t* pPage = nullptr) const;   // 1 - active;    2 - inactive;     3 - sold
+    std::string ListFilterActTickets(const short filter = 0, ticket_list_page_t* pPage = nullptr) const;   // 1 - available; 2 - sold
+    std::string ListFilterSellTickets(const short filter = 0, const std::string& pastelID = "", ticket_list_page_t* pPage = nullptr) const;  // 0 - all, 1 - available; 2 - unavailable;  3 - expired; 4 - sold
+    std::string ListFilterBuyTickets(const short filter = 0, const std::string& pastelID = "", ticket_list_page_t* pPage = nullptr) const;   // 0 - all, 1 - traded;    2 - expired
+    std::string ListFilterTradeTickets(const short filter = 0, const std::string& pastelID = "", ticket_list_page_t* pPage = nullptr) const; // 0 - all, 1 - available; 2 - sold
+    std::string ListFilterActionTickets(const short filter = 0, ticket_list_page_t* pPage = nullptr) const; // 1 - active;    2 - inactive
 
     // search for NFT registration tickets, calls functor for each matching ticket
-    void SearchForNFTs(const search_thumbids_t &p, std::function<size_t(const CPastelTicket *, const nlohmann::json &)> &fnMatchFound) const;
+    void SearchForNFTs(const search_thumbids_t &p, std::function<size_t(const std::string&, const CNFTSearchProps&)> &fnMatchFound) const;
+    // get search properties of the NFT registration ticket
+    bool GetNFTSearchProps(const std::string& sRegTxId, CNFTSearchProps& props) const;
+    // get current owners of all traded copies of the NFT: copy serial number -> owner
+    size_t GetNFTCopyOwners(const std::string& sRegTxId, std::map<std::string, CNFTCopyOwner>& mapOwners) const;
 
     static size_t CreateP2FMSScripts(const CDataStream& input_stream, std::vector<CScript>& vOutScripts);
 #ifdef ENABLE_WALLET
@@ -134,13 +291,17 @@ public:
         const CAmount price, const opt_string_t& sFundingAddress, std::string& error_ret);
 #endif // ENABLE_WALLET
     static bool ParseP2FMSTransaction(const CMutableTransaction& tx_in, CSerializeData& output_data, std::string& error_ret);
+    static bool ParseP2FMSTransaction(const CTransaction& tx_in, CSerializeData& output_data, std::string& error_ret);
     static bool ParseP2FMSTransaction(const CMutableTransaction& tx_in, std::string& output_string, std::string& error_ret);
+    static bool ParseP2FMSTransaction(const CTransaction& tx_in, std::string& output_string, std::string& error_ret);
     // Add P2FMS transaction to the memory pool
     static bool StoreP2FMSTransaction(const CMutableTransaction& tx_out, std::string& error_ret);
 
     static std::string SendTicket(const CPastelTicket& ticket, const opt_string_t& sFundingAddress = std::nullopt);
 
     static std::unique_ptr<CPastelTicket> GetTicket(const uint256 &txid);
+    // create a copy of the ticket including txid and block height
+    static std::unique_ptr<CPastelTicket> CloneTicket(const CPastelTicket& ticket);
     static std::unique_ptr<CPastelTicket> GetTicket(const std::string& _txid, const TicketID ticketID);
     static std::string GetTicketJSON(const uint256 &txid);
 
@@ -161,10 +322,42 @@ public:
 
     // Reads P2FMS (Pay-to-Fake-Multisig) transaction into CCompressedDataStream object.
     static bool preParseTicket(const CMutableTransaction& tx, CCompressedDataStream& data_stream, TicketID& ticket_id, std::string& error, const bool bLog = true);
+    static bool preParseTicket(const CTransaction& tx, CCompressedDataStream& data_stream, TicketID& ticket_id, std::string& error, const bool bLog = true);
 
     // Get mempool tracker for ticket transactions
     static std::shared_ptr<ITxMemPoolTracker> GetTxMemPoolTracker();
 
 private:
+    // ticket DB batches for the ticket types
+    using db_batch_map_t = std::unordered_map<TicketID, CDBBatch>;
+
+    // add ticket keys to the ticket DB batch
+    bool updateDB(const CPastelTicket& ticket, db_batch_map_t& batches) const;
+    void writeDB(db_batch_map_t& batches);
+    static PastelTickets_t parseBlockTickets(const CBlock& block, const uint32_t nBlockHeight);
+    // add tickets of the block to the ticket DBs and move ticket DB tip to this block
+    void connectTickets(const CBlockIndex* pindex, const PastelTickets_t& vTickets, const bool bSaveUndo);
+    void setTicketDBTip(const CBlockIndex* pindex, const bool bSync);
+    // disconnect blocks indexed in the ticket DBs that are not in the active chain
+    bool rollbackTicketDB(std::string& error);
+    // parse blocks in parallel and index tickets block by block
+    bool rebuildTicketDB(const CBlockIndex* pindexTip, const uint32_t nStartHeight, std::string& error);
+    // get undo information for the ticket before it is added to the ticket DB
+    bool getTicketUndo(const CPastelTicket& ticket, CTicketUndo& undo) const;
+    // add undo operations for the ticket to the ticket DB batch
+    bool undoTicket(const CTicketUndo& undo, const uint32_t nBlockHeight, db_batch_map_t& batches) const;
+    // add search properties and trigram index of the NFT registration ticket to the NFT ticket DB batch
+    static void updateNFTSearchProps(const CPastelTicket& ticket, CDBBatch& batch);
+    static void updateNFTOwnership(const CPastelTicket& ticket, CDBBatch& batch);
+    void undoNFTOwnership(const std::string& sKeyOne, const CDBWrapper& db, CDBBatch& batch) const;
+    // remove search properties and trigram index of the NFT registration ticket stored under the primary key
+    void eraseNFTSearchProps(const std::string& sKeyOne, const CDBWrapper& db, CDBBatch& batch) const;
+    // find NFT registration txids with fuzzy search property values containing all trigrams of the filters
+    bool findNFTsByTrigrams(const std::vector<std::pair<std::string, std::string>>& vFuzzyFilters, std::set<std::string>& setRegTxIds) const;
+    // find NFT registration txids for one fuzzy search filter using trigram index
+    static void findNFTsByFilterTrigrams(const CDBWrapper& db, const nft_trigram_set_t& setTrigrams, std::set<std::string>& setRegTxIds);
+
+    static bool parseP2FMSOutputs(const std::vector<CTxOut>& vout, CSerializeData& output_data, std::string& error_ret);
+    static bool preParseTicket(const std::vector<CTxOut>& vout, CCompressedDataStream& data_stream, TicketID& ticket_id, std::string& error);
     static ticket_validation_t ValidateTicketFees(const uint32_t nHeight, const CTransaction& tx, std::unique_ptr<CPastelTicket>&& ticket) noexcept;
 };
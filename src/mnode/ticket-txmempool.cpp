@@ -6,24 +6,142 @@
 
 using namespace std;
 
+/**
+ * Parse ticket from the mempool transaction entry.
+ * 
+ * \param entry - transaction memory pool entry
+ * \param ticket_id - returns ticket id if transaction is recognized as a ticket P2FMS transaction
+ * \return parsed ticket or nullptr if transaction is not a ticket transaction
+ *         or ticket could not be deserialized (ticket_id is still set in this case)
+ */
+mempool_ticket_t CTicketTxMemPoolTracker::parseTicket(const CTxMemPoolEntry& entry, TicketID &ticket_id) const noexcept
+{
+    CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+    string error;
+    const auto& tx = entry.GetTx();
+    ticket_id = TicketID::COUNT;
+    if (!CPastelTicketProcessor::preParseTicket(tx, data_stream, ticket_id, error, false))
+    {
+        ticket_id = TicketID::COUNT;
+        return nullptr;
+    }
+    auto ticket = CPastelTicketProcessor::CreateTicket(ticket_id);
+    if (!ticket)
+        return nullptr;
+    try
+    {
+        data_stream >> *ticket;
+    } catch (const exception& e)
+    {
+        LogPrint("mempool", "Failed to deserialize '%s' ticket from transaction '%s'. %s\n",
+            GetTicketDescription(ticket_id), tx.GetHash().ToString(), e.what());
+        return nullptr;
+    }
+    ticket->SetTxId(tx.GetHash().ToString());
+    ticket->SetBlock(entry.GetHeight());
+    return ticket;
+}
+
+/**
+ * Get key indexes for the given ticket type.
+ * Should be called under m_rwlock.
+ * 
+ * \param ticket_id - ticket type
+ * \return pointer to the key index or nullptr if there are no tickets of this type
+ */
+const CTicketTxMemPoolTracker::ticket_key_index_t* CTicketTxMemPoolTracker::getKeyIndex(const TicketID ticket_id) const noexcept
+{
+    const auto it = m_mapKeyIndex.find(ticket_id);
+    if (it == m_mapKeyIndex.cend())
+        return nullptr;
+    return &it->second;
+}
+
+/**
+ * Add ticket keys to the key indexes.
+ * Should be called under unique m_rwlock.
+ * 
+ * \param txid - ticket transaction hash
+ * \param ticket - parsed ticket
+ */
+void CTicketTxMemPoolTracker::addTicketKeys(const uint256& txid, const CPastelTicket& ticket)
+{
+    auto& keyIndex = m_mapKeyIndex[ticket.ID()];
+    keyIndex.mapKeyOne.emplace(ticket.KeyOne(), txid);
+    if (ticket.HasKeyTwo())
+        keyIndex.mapKeyTwo.emplace(ticket.KeyTwo(), txid);
+    if (ticket.HasMVKeyOne())
+        keyIndex.mapMVKey.emplace(ticket.MVKeyOne(), txid);
+    if (ticket.HasMVKeyTwo())
+        keyIndex.mapMVKey.emplace(ticket.MVKeyTwo(), txid);
+    if (ticket.HasMVKeyThree())
+        keyIndex.mapMVKey.emplace(ticket.MVKeyThree(), txid);
+}
+
+/**
+ * Remove ticket keys from the key indexes.
+ * Should be called under unique m_rwlock.
+ * 
+ * \param txid - ticket transaction hash
+ * \param ticket - parsed ticket
+ */
+void CTicketTxMemPoolTracker::removeTicketKeys(const uint256& txid, const CPastelTicket& ticket)
+{
+    auto itIndex = m_mapKeyIndex.find(ticket.ID());
+    if (itIndex == m_mapKeyIndex.end())
+        return;
+    auto& keyIndex = itIndex->second;
+    // remove only entry with the given txid in the range of the same keys
+    const auto fnErase = [&](mempool_keymap_t& mapKey, const string& sKey)
+    {
+        const auto range = mapKey.equal_range(sKey);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == txid)
+            {
+                mapKey.erase(it);
+                break;
+            }
+        }
+    };
+    fnErase(keyIndex.mapKeyOne, ticket.KeyOne());
+    if (ticket.HasKeyTwo())
+        fnErase(keyIndex.mapKeyTwo, ticket.KeyTwo());
+    if (ticket.HasMVKeyOne())
+        fnErase(keyIndex.mapMVKey, ticket.MVKeyOne());
+    if (ticket.HasMVKeyTwo())
+        fnErase(keyIndex.mapMVKey, ticket.MVKeyTwo());
+    if (ticket.HasMVKeyThree())
+        fnErase(keyIndex.mapMVKey, ticket.MVKeyThree());
+    if (keyIndex.mapKeyOne.empty())
+        m_mapKeyIndex.erase(itIndex);
+}
+
 /**
  * Handle notification: transaction was added to the local memory pool.
  * Add txid to a local map if it is recognized as a ticket P2FMS transaction.
+ * Ticket is parsed only once here and indexed by its keys.
  * 
  * \param entry - transaction memory pool entry
  */
 void CTicketTxMemPoolTracker::processTransaction(const CTxMemPoolEntry& entry, [[maybe_unused]] const bool fCurrentEstimate)
 {
-    CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
     TicketID ticket_id;
-    string error;
-    const auto& tx = entry.GetTx();
-    if (!CPastelTicketProcessor::preParseTicket(tx, data_stream, ticket_id, error))
+    // parse ticket outside of the lock
+    auto ticket = parseTicket(entry, ticket_id);
+    if (ticket_id == TicketID::COUNT)
         return;
+    const auto& txid = entry.GetTx().GetHash();
     {
         unique_lock lock(m_rwlock);
-        m_mapTicket.emplace(ticket_id, tx.GetHash());
-        m_mapTxid.emplace(tx.GetHash(), ticket_id);
+        if (!m_mapTxid.emplace(txid, ticket_id).second)
+            return;
+        m_mapTicket.emplace(ticket_id, txid);
+        if (ticket)
+        {
+            addTicketKeys(txid, *ticket);
+            m_mapTicketData.emplace(txid, move(ticket));
+        }
     }
 }
 
@@ -43,9 +161,15 @@ void CTicketTxMemPoolTracker::removeTx(const uint256& txid)
         // search in the range only for transaction with txid
         auto toEraseIt = find_if(it.first, it.second, [&](const auto item) -> bool { return item.second == txid; });
         // erase it
-        if (toEraseIt != m_mapTicket.end())
+        if (toEraseIt != it.second)
             m_mapTicket.erase(toEraseIt);
         m_mapTxid.erase(itTx);
+        auto itData = m_mapTicketData.find(txid);
+        if (itData != m_mapTicketData.end())
+        {
+            removeTicketKeys(txid, *itData->second);
+            m_mapTicketData.erase(itData);
+        }
     }
 }
 
@@ -81,3 +205,104 @@ size_t CTicketTxMemPoolTracker::count(const TicketID ticket_id) const noexcept
     shared_lock rlock(m_rwlock);
     return m_mapTicket.count(ticket_id);
 }
+
+/**
+ * Find first parsed ticket by key in the given key index.
+ * Should be called under m_rwlock.
+ * 
+ * \param mapKey - key index
+ * \param sKey - key to search for
+ * \return ticket or nullptr if not found
+ */
+mempool_ticket_t CTicketTxMemPoolTracker::findFirst(const mempool_keymap_t& mapKey, const string& sKey) const noexcept
+{
+    const auto it = mapKey.find(sKey);
+    if (it == mapKey.cend())
+        return nullptr;
+    const auto itData = m_mapTicketData.find(it->second);
+    if (itData == m_mapTicketData.cend())
+        return nullptr;
+    return itData->second;
+}
+
+/**
+ * List all parsed tickets by key in the given key index.
+ * Should be called under m_rwlock.
+ * 
+ * \param mapKey - key index
+ * \param sKey - key to search for
+ * \param vTicket - found tickets are appended to this vector
+ * \return number of tickets found
+ */
+size_t CTicketTxMemPoolTracker::listAll(const mempool_keymap_t& mapKey, const string& sKey, mempool_tickets_t& vTicket) const noexcept
+{
+    size_t nCount = 0;
+    const auto range = mapKey.equal_range(sKey);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const auto itData = m_mapTicketData.find(it->second);
+        if (itData == m_mapTicketData.cend())
+            continue;
+        vTicket.push_back(itData->second);
+        ++nCount;
+    }
+    return nCount;
+}
+
+/**
+ * Find ticket in the mempool by primary key.
+ * 
+ * \param ticket_id - ticket type
+ * \param sKeyOne - primary key
+ * \return ticket or nullptr if not found
+ */
+mempool_ticket_t CTicketTxMemPoolTracker::findTicket(const TicketID ticket_id, const string& sKeyOne) const noexcept
+{
+    shared_lock rlock(m_rwlock);
+    const auto pKeyIndex = getKeyIndex(ticket_id);
+    return pKeyIndex ? findFirst(pKeyIndex->mapKeyOne, sKeyOne) : nullptr;
+}
+
+/**
+ * Find ticket in the mempool by secondary key.
+ * 
+ * \param ticket_id - ticket type
+ * \param sKeyTwo - secondary key
+ * \return ticket or nullptr if not found
+ */
+mempool_ticket_t CTicketTxMemPoolTracker::findTicketBySecondaryKey(const TicketID ticket_id, const string& sKeyTwo) const noexcept
+{
+    shared_lock rlock(m_rwlock);
+    const auto pKeyIndex = getKeyIndex(ticket_id);
+    return pKeyIndex ? findFirst(pKeyIndex->mapKeyTwo, sKeyTwo) : nullptr;
+}
+
+/**
+ * List tickets in the mempool by primary key.
+ * 
+ * \param ticket_id - ticket type
+ * \param sKeyOne - primary key
+ * \param vTicket - found tickets are appended to this vector
+ * \return number of tickets found
+ */
+size_t CTicketTxMemPoolTracker::listTickets(const TicketID ticket_id, const string& sKeyOne, mempool_tickets_t& vTicket) const noexcept
+{
+    shared_lock rlock(m_rwlock);
+    const auto pKeyIndex = getKeyIndex(ticket_id);
+    return pKeyIndex ? listAll(pKeyIndex->mapKeyOne, sKeyOne, vTicket) : 0;
+}
+
+/**
+ * List tickets in the mempool by multi-value key.
+ * 
+ * \param ticket_id - ticket type
+ * \param sMVKey - multi-value key
+ * \param vTicket - found tickets are appended to this vector
+ * \return number of tickets found
+ */
+size_t CTicketTxMemPoolTracker::listTicketsByMVKey(const TicketID ticket_id, const string& sMVKey, mempool_tickets_t& vTicket) const noexcept
+{
+    shared_lock rlock(m_rwlock);
+    const auto pKeyIndex = getKeyIndex(ticket_id);
+    return pKeyIndex ? listAll(pKeyIndex->mapMVKey, sMVKey, vTicket) : 0;
+}
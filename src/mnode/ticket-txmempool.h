@@ -2,6 +2,7 @@
 // Copyright (c) 2021 The Pastel Core developers
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <memory>
 #include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
@@ -10,9 +11,14 @@
 #include <mnode/tickets/ticket.h>
 #include <mnode/tickets/ticket-types.h>
 
+// parsed ticket from the mempool transaction (shared with mempool processors, never modified)
+using mempool_ticket_t = std::shared_ptr<const CPastelTicket>;
+using mempool_tickets_t = std::vector<mempool_ticket_t>;
+
 /**
  * Track P2FMS transactions with Pastel Tickets accepted to the local memory pool.
- * 
+ * Tickets are parsed once when transaction is accepted to the mempool and
+ * indexed by ticket keys (KeyOne, KeyTwo, MV keys) per ticket type.
  */
 class CTicketTxMemPoolTracker : public ITxMemPoolTracker
 {
@@ -30,13 +36,43 @@ public:
     // get number of ticket transactions in mempool by ticket id
     virtual size_t count(const TicketID ticket_id) const noexcept;
 
+    // find first ticket in mempool by primary key
+    mempool_ticket_t findTicket(const TicketID ticket_id, const std::string& sKeyOne) const noexcept;
+    // find first ticket in mempool by secondary key
+    mempool_ticket_t findTicketBySecondaryKey(const TicketID ticket_id, const std::string& sKeyTwo) const noexcept;
+    // list tickets in mempool by primary key
+    size_t listTickets(const TicketID ticket_id, const std::string& sKeyOne, mempool_tickets_t& vTicket) const noexcept;
+    // list tickets in mempool by multi-value key
+    size_t listTicketsByMVKey(const TicketID ticket_id, const std::string& sMVKey, mempool_tickets_t& vTicket) const noexcept;
+
 protected:
     using mempool_txidmap_t = std::unordered_map<uint256, TicketID>;
     using mempool_ticketidmap_t = std::unordered_multimap<TicketID, uint256>;
+    using mempool_keymap_t = std::unordered_multimap<std::string, uint256>;
+
+    // ticket key indexes for one ticket type: key -> txid
+    typedef struct _ticket_key_index_t
+    {
+        mempool_keymap_t mapKeyOne;
+        mempool_keymap_t mapKeyTwo;
+        mempool_keymap_t mapMVKey;
+    } ticket_key_index_t;
+
     // read-write lock to protect access to maps
     mutable std::shared_mutex m_rwlock;
     // map of ticket transactions accepted into the local mempool: ticket id -> txid
     mempool_ticketidmap_t m_mapTicket;
-    // map of txid -> ticketm_mapTicket id
+    // map of txid -> ticket id
     mempool_txidmap_t m_mapTxid;
+    // map of txid -> parsed ticket
+    std::unordered_map<uint256, mempool_ticket_t> m_mapTicketData;
+    // key indexes per ticket id
+    std::unordered_map<TicketID, ticket_key_index_t> m_mapKeyIndex;
+
+    mempool_ticket_t parseTicket(const CTxMemPoolEntry& entry, TicketID &ticket_id) const noexcept;
+    void addTicketKeys(const uint256& txid, const CPastelTicket& ticket);
+    void removeTicketKeys(const uint256& txid, const CPastelTicket& ticket);
+    mempool_ticket_t findFirst(const mempool_keymap_t& mapKey, const std::string& sKey) const noexcept;
+    size_t listAll(const mempool_keymap_t& mapKey, const std::string& sKey, mempool_tickets_t& vTicket) const noexcept;
+    const ticket_key_index_t* getKeyIndex(const TicketID ticket_id) const noexcept;
 };
@@ -0,0 +1,57 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <string>
+#include <vector>
+
+#include <uint256.h>
+#include <serialize.h>
+#include <vector_types.h>
+
+/**
+ * Undo information for a ticket added to the ticket DB.
+ * Keeps the state of the ticket DB keys before the ticket was added.
+ */
+class CTicketUndo
+{
+public:
+    uint8_t nTicketID{0};         // ticket type
+    std::string sKeyOne;          // primary key of the added ticket
+    v_uint8 vPrevTicketData;      // serialized ticket stored before under the same primary key, empty if none
+    std::string sKeyTwo;          // secondary key of the added ticket, empty if ticket does not have secondary key
+    std::string sPrevKeyOne;      // primary key stored before under the same secondary key, empty if none
+    v_strings vNewMVKeys;         // multi-value keys that did not contain ticket primary key before
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream>
+    inline void SerializationOp(Stream& s, const SERIALIZE_ACTION ser_action)
+    {
+        READWRITE(nTicketID);
+        READWRITE(sKeyOne);
+        READWRITE(vPrevTicketData);
+        READWRITE(sKeyTwo);
+        READWRITE(sPrevKeyOne);
+        READWRITE(vNewMVKeys);
+    }
+};
+
+/**
+ * Undo information for all tickets of the block.
+ */
+class CTicketBlockUndo
+{
+public:
+    uint256 hashBlock;                    // hash of the block with tickets
+    std::vector<CTicketUndo> vTicketUndo; // undo information for the tickets in the order they were added
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream>
+    inline void SerializationOp(Stream& s, const SERIALIZE_ACTION ser_action)
+    {
+        READWRITE(hashBlock);
+        READWRITE(vTicketUndo);
+    }
+};
@@ -0,0 +1,105 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <main.h>
+#include <memusage.h>
+#include <random.h>
+#include <util.h>
+#include <crypto/sha256.h>
+#include <crypto/common.h>
+#include <mnode/mnode-controller.h>
+#include <mnode/ticket-validation-cache.h>
+
+using namespace std;
+
+CTicketValidationCache ticketValidationCache;
+
+CTicketValidationCache::CTicketValidationCache()
+{
+    GetRandBytes(m_nonce.begin(), m_nonce.size());
+}
+
+/**
+ * Compute cache entry for the ticket validated in the context of the current active chain tip.
+ * Validation of some tickets is relaxed while masternodes are not synced,
+ * so sync state is part of the entry as well.
+ * 
+ * \param sTxId - ticket txid
+ * \param nHeight - height the ticket is validated at
+ * \param nDepth - ticket validation depth (0 - ticket transaction itself, >0 - ticket referred by another ticket)
+ * \return cache entry
+ */
+uint256 CTicketValidationCache::ComputeEntry(const string& sTxId, const uint32_t nHeight, const uint32_t nDepth) const
+{
+    uint256 hashTip;
+    {
+        LOCK(cs_main);
+        if (chainActive.Tip())
+            hashTip = chainActive.Tip()->GetBlockHash();
+    }
+    unsigned char vHeight[4], vDepth[4];
+    WriteLE32(vHeight, nHeight);
+    WriteLE32(vDepth, nDepth);
+    const unsigned char nSynced = masterNodeCtrl.masternodeSync.IsSynced() ? 1 : 0;
+
+    uint256 entry;
+    CSHA256()
+        .Write(m_nonce.begin(), m_nonce.size())
+        .Write(reinterpret_cast<const unsigned char*>(sTxId.data()), sTxId.size())
+        .Write(vHeight, sizeof(vHeight))
+        .Write(vDepth, sizeof(vDepth))
+        .Write(hashTip.begin(), hashTip.size())
+        .Write(&nSynced, 1)
+        .Finalize(entry.begin());
+    return entry;
+}
+
+/**
+ * Check if ticket validation with this entry succeeded before.
+ * 
+ * \param entry - cache entry
+ * \return true if the ticket was successfully validated in the same context
+ */
+bool CTicketValidationCache::Get(const uint256& entry) const
+{
+    shared_lock rlock(m_rwlock);
+    return m_setValid.count(entry) > 0;
+}
+
+/**
+ * Remember successful ticket validation.
+ * Random entries are evicted if cache size exceeds -maxticketvalidationcachesize.
+ * 
+ * \param entry - cache entry
+ */
+void CTicketValidationCache::Set(const uint256& entry)
+{
+    const size_t nMaxCacheSize = GetArg("-maxticketvalidationcachesize", DEFAULT_MAX_TICKET_VALIDATION_CACHE_SIZE) * (static_cast<size_t>(1) << 20);
+    if (nMaxCacheSize == 0)
+        return;
+
+    unique_lock lock(m_rwlock);
+    while (memusage::DynamicUsage(m_setValid) > nMaxCacheSize)
+    {
+        const auto s = GetRand(m_setValid.bucket_count());
+        auto it = m_setValid.begin(s);
+        if (it != m_setValid.end(s))
+            m_setValid.erase(*it);
+    }
+    m_setValid.insert(entry);
+}
+
+/**
+ * Remove all cache entries.
+ */
+void CTicketValidationCache::Clear()
+{
+    unique_lock lock(m_rwlock);
+    m_setValid.clear();
+}
+
+size_t CTicketValidationCache::size() const noexcept
+{
+    shared_lock rlock(m_rwlock);
+    return m_setValid.size();
+}
@@ -0,0 +1,64 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <cstdint>
+#include <string>
+#include <shared_mutex>
+#include <unordered_set>
+
+#include <uint256.h>
+
+// limit ticket validation cache size to <n> MiB
+constexpr unsigned int DEFAULT_MAX_TICKET_VALIDATION_CACHE_SIZE = 10;
+
+/**
+ * Cache of the successful ticket validations.
+ * Used to avoid repeating expensive ticket validation (PastelID signatures, referred tickets lookup)
+ * for the same ticket several times: when it is accepted into memory pool and again when it is
+ * accepted into the blockchain, or when the same PastelID registration tickets are validated
+ * as signers of multiple tickets.
+ * 
+ * Entries are SHA256(nonce || ticket txid || height || depth || chain tip hash || synced flag).
+ * Ticket validation depends on the state of the active chain, so the result is valid only for the
+ * same chain tip - entries computed for the disconnected tips are never matched again.
+ * Only successful validations are cached - failed validation can succeed later
+ * (for example, when missing inputs arrive).
+ */
+class CTicketValidationCache
+{
+public:
+    CTicketValidationCache();
+
+    // compute cache entry for the ticket validated in the context of the current active chain tip
+    uint256 ComputeEntry(const std::string& sTxId, const uint32_t nHeight, const uint32_t nDepth) const;
+    // check if ticket validation with this entry succeeded before
+    bool Get(const uint256& entry) const;
+    // remember successful ticket validation
+    void Set(const uint256& entry);
+    // remove all cache entries
+    void Clear();
+    // number of cached entries
+    size_t size() const noexcept;
+
+protected:
+    /**
+     * Entries are already hashed with nonce,
+     * so no extra blinding in the set hash computation is needed.
+     */
+    class CTicketValidationCacheHasher
+    {
+    public:
+        size_t operator()(const uint256& key) const noexcept
+        {
+            return key.GetCheapHash();
+        }
+    };
+    using entry_set_t = std::unordered_set<uint256, CTicketValidationCacheHasher>;
+
+    uint256 m_nonce;
+    entry_set_t m_setValid;
+    mutable std::shared_mutex m_rwlock;
+};
+
+extern CTicketValidationCache ticketValidationCache;
@@ -0,0 +1,218 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <utilstrencodings.h>
+#include <str_utils.h>
+#include <vector_types.h>
+#include <mnode/tickets/nft-reg.h>
+#include <mnode/tickets/nft-search-props.h>
+
+using json = nlohmann::json;
+using namespace std;
+
+// app ticket properties used by fuzzy search, property index is stored in the trigram index
+static const v_strings FUZZY_PROPS = 
+{
+    "creator_name",
+    "nft_title",
+    "nft_series_name",
+    "nft_keyword_set",
+    "creator_written_statement"
+};
+constexpr auto NFT_PROP_THUMBNAIL_HASH = "thumbnail_hash";
+constexpr auto NFT_PROP_RARENESS_SCORE = "rareness_score";
+constexpr auto NFT_PROP_NSFW_SCORE = "nsfw_score";
+
+/**
+ * Decode and parse NFT registration app ticket json.
+ * NFT ticket and app ticket are base64-encoded json objects.
+ * 
+ * \param ticket - NFT registration ticket
+ * \param jApp - returns parsed app ticket json (empty if nft ticket has no app ticket)
+ * \param error - returns error message if any
+ * \return true if app ticket was parsed successfully or nft ticket has no app ticket
+ */
+bool CNFTSearchProps::ParseAppTicket(const CNFTRegTicket& ticket, json& jApp, string& error)
+{
+    bool bInvalid = false;
+    const string sData = DecodeBase64(ticket.ToStr(), &bInvalid);
+    if (bInvalid)
+    {
+        error = "failed to decode base64 encoded NFT ticket";
+        return false;
+    }
+    try
+    {
+        const json j = json::parse(sData);
+        if (!j.contains("app_ticket"))
+            return true;
+        const json& jAppTicketBase64 = j["app_ticket"];
+        if (!jAppTicketBase64.is_string())
+            return true;
+        const string sAppData = DecodeBase64(jAppTicketBase64.get<string>(), &bInvalid);
+        if (bInvalid)
+        {
+            error = "failed to decode base64 encoded NFT app ticket";
+            return false;
+        }
+        jApp = json::parse(sAppData);
+    } catch (const json::exception& ex)
+    {
+        error = strprintf("failed to parse NFT ticket json. %s", SAFE_SZ(ex.what()));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Extract search properties from the NFT registration ticket.
+ * 
+ * \param ticket - NFT registration ticket
+ * \param error - returns error message if any
+ * \return true if properties were extracted successfully
+ */
+bool CNFTSearchProps::Extract(const CNFTRegTicket& ticket, string& error)
+{
+    nTotalCopies = ticket.getTotalCopies();
+    json jApp;
+    if (!ParseAppTicket(ticket, jApp, error))
+        return false;
+    Extract(jApp);
+    return true;
+}
+
+/**
+ * Extract search properties from the parsed app ticket json.
+ * 
+ * \param jApp - app ticket json
+ */
+void CNFTSearchProps::Extract(const json& jApp)
+{
+    if (!jApp.is_object())
+        return;
+    auto getScore = [&](const char* szPropName, bool& bHasScore, uint32_t& nScore)
+    {
+        const auto it = jApp.find(szPropName);
+        bHasScore = (it != jApp.cend()) && it->is_number();
+        if (bHasScore)
+            nScore = it->get<uint32_t>();
+    };
+    getScore(NFT_PROP_RARENESS_SCORE, bHasRarenessScore, nRarenessScore);
+    getScore(NFT_PROP_NSFW_SCORE, bHasNsfwScore, nNsfwScore);
+    auto it = jApp.find(NFT_PROP_THUMBNAIL_HASH);
+    if ((it != jApp.cend()) && it->is_string())
+        it->get_to(sThumbnailHash);
+    string sValue;
+    for (const auto& sPropName : FUZZY_PROPS)
+    {
+        it = jApp.find(sPropName);
+        if ((it == jApp.cend()) || !it->is_string())
+            continue;
+        it->get_to(sValue);
+        vFuzzyProps.emplace_back(sPropName, lowercase(sValue));
+    }
+}
+
+/**
+ * Check if the app ticket property is extracted to the fuzzy search properties.
+ * 
+ * \param sPropName - app ticket property name
+ * \return true if property is one of the fuzzy search properties
+ */
+bool CNFTSearchProps::IsFuzzyProp(const string& sPropName) noexcept
+{
+    return GetFuzzyPropIndex(sPropName) >= 0;
+}
+
+/**
+ * Get index of the fuzzy search property.
+ * 
+ * \param sPropName - app ticket property name
+ * \return property index or -1 if property is not one of the fuzzy search properties
+ */
+int CNFTSearchProps::GetFuzzyPropIndex(const string& sPropName) noexcept
+{
+    const auto it = find(FUZZY_PROPS.cbegin(), FUZZY_PROPS.cend(), sPropName);
+    if (it == FUZZY_PROPS.cend())
+        return -1;
+    return static_cast<int>(distance(FUZZY_PROPS.cbegin(), it));
+}
+
+/**
+ * Add all trigrams of the lowercased value to the set.
+ * Trigrams are byte sequences - any substring of the value contains only trigrams of the value.
+ * 
+ * \param nPropIndex - fuzzy search property index
+ * \param sValue - lowercased property value
+ * \param setTrigrams - set of trigrams to add to
+ */
+void CNFTSearchProps::AddTrigrams(const uint8_t nPropIndex, const string& sValue, nft_trigram_set_t& setTrigrams)
+{
+    if (sValue.size() < NFT_TRIGRAM_SIZE)
+        return;
+    for (size_t i = 0; i + NFT_TRIGRAM_SIZE <= sValue.size(); ++i)
+        setTrigrams.emplace(nPropIndex, sValue.substr(i, NFT_TRIGRAM_SIZE));
+}
+
+/**
+ * Get trigrams of all fuzzy search properties.
+ * 
+ * \return set of trigrams
+ */
+nft_trigram_set_t CNFTSearchProps::GetTrigrams() const
+{
+    nft_trigram_set_t setTrigrams;
+    for (const auto& [sPropName, sValue] : vFuzzyProps)
+    {
+        const int nPropIndex = GetFuzzyPropIndex(sPropName);
+        if (nPropIndex >= 0)
+            AddTrigrams(static_cast<uint8_t>(nPropIndex), sValue, setTrigrams);
+    }
+    return setTrigrams;
+}
+
+/**
+ * Get trigrams stored in the trigram index.
+ * Fuzzy search filter skips NFTs that have no string value for the filtered property,
+ * empty trigram is added for such properties so these NFTs can be found in the index too.
+ * 
+ * \return set of trigrams
+ */
+nft_trigram_set_t CNFTSearchProps::GetIndexTrigrams() const
+{
+    nft_trigram_set_t setTrigrams = GetTrigrams();
+    for (size_t i = 0; i < FUZZY_PROPS.size(); ++i)
+    {
+        if (!GetFuzzyProp(FUZZY_PROPS[i]))
+            setTrigrams.emplace(static_cast<uint8_t>(i), "");
+    }
+    return setTrigrams;
+}
+
+/**
+ * Get lowercased value of the fuzzy search property.
+ * 
+ * \param sPropName - app ticket property name
+ * \return pointer to the property value or nullptr if property is not defined in the app ticket
+ */
+const string* CNFTSearchProps::GetFuzzyProp(const string& sPropName) const noexcept
+{
+    for (const auto& [sName, sValue] : vFuzzyProps)
+    {
+        if (sName == sPropName)
+            return &sValue;
+    }
+    return nullptr;
+}
+
+CNFTTrigramKey::CNFTTrigramKey(const nft_trigram_t& trigram, const string& sTxId) :
+    sPrefix(NFT_TRIGRAM_KEY_PREFIX),
+    nPropIndex(trigram.first),
+    sTrigram(trigram.second),
+    sRegTxId(sTxId)
+{}
+
+bool CNFTTrigramKey::IsValid() const noexcept
+{
+    return sPrefix == NFT_TRIGRAM_KEY_PREFIX;
+}
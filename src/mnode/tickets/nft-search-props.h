@@ -0,0 +1,103 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <string>
+#include <vector>
+#include <set>
+#include <json/json.hpp>
+
+#include <serialize.h>
+
+class CNFTRegTicket;
+
+// trigram of the fuzzy search property value: <fuzzy search property index, trigram>
+using nft_trigram_t = std::pair<uint8_t, std::string>;
+using nft_trigram_set_t = std::set<nft_trigram_t>;
+constexpr size_t NFT_TRIGRAM_SIZE = 3;
+constexpr auto NFT_TRIGRAM_KEY_PREFIX = "@T@";
+
+/**
+ * Decoded NFT registration ticket properties used by NFT search ('tickets tools searchthumbids').
+ * Extracted once when NFT registration ticket is added to the ticket DB,
+ * so the search does not have to read the registration transaction and decode nft & app tickets.
+ * Fuzzy search properties are stored lowercased.
+ */
+class CNFTSearchProps
+{
+public:
+    uint32_t nTotalCopies = 0;      // number of created copies
+    bool bHasRarenessScore = false; // true if app ticket has rareness_score
+    uint32_t nRarenessScore = 0;    // rareness score (0..1000)
+    bool bHasNsfwScore = false;     // true if app ticket has nsfw_score
+    uint32_t nNsfwScore = 0;        // nsfw score (0..1000)
+    std::string sThumbnailHash;     // thumbnail hash
+    // fuzzy search properties with string values defined in the app ticket: <property name, lowercased value>,
+    // non-string values are checked by the search in the app ticket
+    std::vector<std::pair<std::string, std::string>> vFuzzyProps;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream>
+    inline void SerializationOp(Stream& s, const SERIALIZE_ACTION ser_action)
+    {
+        READWRITE(nTotalCopies);
+        READWRITE(bHasRarenessScore);
+        READWRITE(nRarenessScore);
+        READWRITE(bHasNsfwScore);
+        READWRITE(nNsfwScore);
+        READWRITE(sThumbnailHash);
+        READWRITE(vFuzzyProps);
+    }
+
+    // extract search properties from the NFT registration ticket
+    bool Extract(const CNFTRegTicket& ticket, std::string& error);
+    // extract search properties from the parsed app ticket json
+    void Extract(const nlohmann::json& jApp);
+    // check if the app ticket property is extracted to the fuzzy search properties
+    static bool IsFuzzyProp(const std::string& sPropName) noexcept;
+    // get index of the fuzzy search property, returns -1 if property is not one of the fuzzy search properties
+    static int GetFuzzyPropIndex(const std::string& sPropName) noexcept;
+    // add all trigrams of the lowercased value to the set
+    static void AddTrigrams(const uint8_t nPropIndex, const std::string& sValue, nft_trigram_set_t& setTrigrams);
+    // get trigrams of all fuzzy search properties
+    nft_trigram_set_t GetTrigrams() const;
+    // get trigrams stored in the trigram index, including empty trigrams for the properties without string value
+    nft_trigram_set_t GetIndexTrigrams() const;
+    // get lowercased value of the fuzzy search property, returns nullptr if property is not defined
+    const std::string* GetFuzzyProp(const std::string& sPropName) const noexcept;
+
+    // decode and parse NFT registration app ticket json
+    static bool ParseAppTicket(const CNFTRegTicket& ticket, nlohmann::json& jApp, std::string& error);
+};
+
+/**
+ * Trigram index key: <"@T@", fuzzy search property index, trigram, NFT registration txid>.
+ * All keys for the same property trigram are stored together in the NFT ticket DB.
+ * Key with empty trigram lists NFTs that have no string value for the property -
+ * these NFTs are not filtered out by the property filter.
+ */
+class CNFTTrigramKey
+{
+public:
+    std::string sPrefix;     // NFT_TRIGRAM_KEY_PREFIX
+    uint8_t nPropIndex = 0;  // fuzzy search property index
+    std::string sTrigram;    // lowercased property value trigram
+    std::string sRegTxId;    // NFT registration ticket txid
+
+    CNFTTrigramKey() = default;
+    CNFTTrigramKey(const nft_trigram_t& trigram, const std::string& sTxId);
+
+    bool IsValid() const noexcept;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream>
+    inline void SerializationOp(Stream& s, const SERIALIZE_ACTION ser_action)
+    {
+        READWRITE(sPrefix);
+        READWRITE(nPropIndex);
+        READWRITE(sTrigram);
+        READWRITE(sRegTxId);
+    }
+};
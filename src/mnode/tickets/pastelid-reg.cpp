@@ -158,14 +158,16 @@ ticket_validation_t CPastelIDRegTicket::IsValid(const bool bPreReg, const uint32
                 //during transaction validation before ticket made in to the block_ticket.ticketBlock will == 0
                 if (_ticket.IsBlock(0) || currentHeight - _ticket.GetBlock() < masterNodeCtrl.MinTicketConfirmations)
                 {
-                    CMasternode mnInfo;
-                    if (!masterNodeCtrl.masternodeManager.Get(outpoint, mnInfo))
+                    const auto pMasternodes = masterNodeCtrl.masternodeManager.GetMasternodeSnapshot();
+                    const auto itMN = pMasternodes->find(outpoint);
+                    if (itMN == pMasternodes->cend())
                     {
                         tv.errorMsg = strprintf(
                             "Unknown Masternode - [%s]. PastelID - [%s]", 
                             outpoint.ToStringShort(), pastelID);
                         break;
                     }
+                    const auto& mnInfo = itMN->second;
                     if (!mnInfo.IsEnabled())
                     {
                         tv.errorMsg = strprintf(
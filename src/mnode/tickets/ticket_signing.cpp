@@ -10,6 +10,7 @@
 #include <mnode/tickets/pastelid-reg.h>
 #include <mnode/tickets/ticket_signing.h>
 #include <mnode/mnode-controller.h>
+#include <mnode/ticket-validation-cache.h>
 
 using json = nlohmann::json;
 using namespace std;
@@ -168,7 +169,18 @@ ticket_validation_t CTicketSigning::validate_signatures(const uint32_t nDepth, c
         }
             
         // 2. PastelIDs are valid
-        tv = pastelIdRegTicket.IsValid(false, ++nCurDepth);
+        // the same PastelIDs sign many tickets - check validation cache first
+        // cache entry should be computed for the same depth the PastelID ticket is validated with
+        ++nCurDepth;
+        const uint256 cacheEntry = ticketValidationCache.ComputeEntry(pastelIdRegTicket.GetTxId(), pastelIdRegTicket.GetBlock(), nCurDepth);
+        if (ticketValidationCache.Get(cacheEntry))
+            tv.setValid();
+        else
+        {
+            tv = pastelIdRegTicket.IsValid(false, nCurDepth);
+            if (!tv.IsNotValid())
+                ticketValidationCache.Set(cacheEntry);
+        }
         if (tv.IsNotValid())
         {
             tv.errorMsg = strprintf(
@@ -209,11 +221,8 @@ ticket_validation_t CTicketSigning::validate_signatures(const uint32_t nDepth, c
             // 4. Masternodes beyond these PastelIDs, were in the top 10 at the block when the registration happened
             if (masterNodeCtrl.masternodeSync.IsSynced()) // ticket needs synced MNs
             {
-                auto topBlockMNs = masterNodeCtrl.masternodeManager.GetTopMNsForBlock(nCreatorHeight, true);
-                const auto foundIt = find_if(topBlockMNs.cbegin(), topBlockMNs.cend(), [&pastelIdRegTicket](CMasternode const& mn)
-                    {
-                        return mn.vin.prevout == pastelIdRegTicket.outpoint;
-                    });
+                const auto topBlockMNs = masterNodeCtrl.masternodeManager.GetTopMNsForBlock(nCreatorHeight, true);
+                const auto foundIt = find(topBlockMNs.cbegin(), topBlockMNs.cend(), pastelIdRegTicket.outpoint);
 
                 if (foundIt == topBlockMNs.cend()) //not found
                 {
@@ -230,9 +239,19 @@ ticket_validation_t CTicketSigning::validate_signatures(const uint32_t nDepth, c
         return tv;
 
     // 5. Signatures matches included PastelIDs (signature verification is slower - hence separate loop)
+    // all signatures are verified in parallel
+    vector<CPastelID::verify_item_t> vVerifyItems(SIGN_COUNT);
+    for (auto mnIndex = SIGN_PRINCIPAL; mnIndex < SIGN_COUNT; ++mnIndex)
+    {
+        auto& item = vVerifyItems[mnIndex];
+        item.psText = &sTicketToValidate;
+        item.sSignature = vector_to_string(m_vTicketSignature[mnIndex]);
+        item.sPastelID = m_vPastelID[mnIndex];
+    }
+    const v_bools vVerified = CPastelID::VerifyBatch(vVerifyItems);
     for (auto mnIndex = SIGN_PRINCIPAL; mnIndex < SIGN_COUNT; ++mnIndex)
     {
-        if (!CPastelID::Verify(sTicketToValidate, vector_to_string(m_vTicketSignature[mnIndex]), m_vPastelID[mnIndex]))
+        if (!vVerified[mnIndex])
         {
             tv.state = TICKET_VALIDATION_STATE::INVALID;
             tv.errorMsg = strprintf(
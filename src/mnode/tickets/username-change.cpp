@@ -270,11 +270,9 @@ bool CChangeUsernameTicket::isUsernameBad(const string& username, string& error)
     // Check if contains bad words (swear, racist,...)
     string lowercaseUsername = username;
     lowercase(lowercaseUsername);
-    for (const auto& elem : UsernameBadWords::Singleton().wordSet) {
-        if (lowercaseUsername.find(elem) != string::npos) {
-            error = "Invalid username, should NOT contains swear, racist... words";
-            return true;
-        }
+    if (UsernameBadWords::Singleton().HasBadWord(lowercaseUsername)) {
+        error = "Invalid username, should NOT contains swear, racist... words";
+        return true;
     }
 
     return false;
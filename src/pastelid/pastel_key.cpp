@@ -1,12 +1,21 @@
 // Copyright (c) 2018-2021 The Pastel Core developers
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include "base58.h"
 #include "fs.h"
+#include "util.h"
 #include "key_io.h"
 #include "str_utils.h"
 #include "pastelid/pastel_key.h"
 #include "pastelid/ed.h"
+#include "pastelid/pubkey_cache.h"
 #include "pastelid/secure_container.h"
 #include "mnode/mnode-controller.h"
 #include <mnode/tickets/pastelid-reg.h>
@@ -16,6 +25,126 @@ using namespace legroast;
 using namespace ed_crypto;
 using namespace secure_container;
 
+namespace
+{
+/**
+ * Pool of the worker threads used to verify signatures and to process LegRoast signature rounds in parallel.
+ * Threads are created on first use, calling thread takes part in the processing.
+ */
+class CVerifyWorkerPool
+{
+public:
+    static CVerifyWorkerPool& Instance()
+    {
+        static CVerifyWorkerPool pool;
+        return pool;
+    }
+
+    ~CVerifyWorkerPool()
+    {
+        {
+            lock_guard<mutex> lck(m_mtx);
+            m_bStop = true;
+        }
+        m_cv.notify_all();
+        for (auto& t : m_vWorkers)
+            t.join();
+    }
+
+    size_t GetWorkerCount() const noexcept { return m_vWorkers.size(); }
+
+    // call fn(i) for all i in [0, nCount)
+    void ParallelFor(const size_t nCount, const function<void(const size_t)>& fn)
+    {
+        auto pJob = make_shared<job_t>(fn, nCount);
+        {
+            lock_guard<mutex> lck(m_mtx);
+            m_jobs.push_back(pJob);
+        }
+        m_cv.notify_all();
+        run(*pJob);
+        {
+            unique_lock<mutex> lck(pJob->mtx);
+            pJob->cvDone.wait(lck, [&]() { return pJob->nDone == nCount; });
+        }
+        lock_guard<mutex> lck(m_mtx);
+        m_jobs.erase(std::remove(m_jobs.begin(), m_jobs.end(), pJob), m_jobs.end());
+    }
+
+private:
+    typedef struct _job_t
+    {
+        const function<void(const size_t)>& fn;
+        const size_t nCount;
+        atomic<size_t> nNext;
+        atomic<size_t> nDone;
+        mutex mtx;
+        condition_variable cvDone;
+
+        _job_t(const function<void(const size_t)>& f, const size_t n) :
+            fn(f), nCount(n), nNext(0), nDone(0)
+        {}
+    } job_t;
+
+    mutex m_mtx;
+    condition_variable m_cv;
+    deque<shared_ptr<job_t>> m_jobs;
+    vector<thread> m_vWorkers;
+    bool m_bStop = false;
+
+    CVerifyWorkerPool()
+    {
+        const size_t nThreads = min<size_t>(max(GetNumCores(), 1), MAX_PASTELID_VERIFY_THREADS);
+        // calling thread is used as one of the workers
+        for (size_t i = 1; i < nThreads; ++i)
+            m_vWorkers.emplace_back(&CVerifyWorkerPool::worker, this);
+    }
+
+    static void run(job_t& job)
+    {
+        size_t i;
+        while ((i = job.nNext++) < job.nCount)
+        {
+            job.fn(i);
+            if (++job.nDone == job.nCount)
+            {
+                lock_guard<mutex> lck(job.mtx);
+                job.cvDone.notify_all();
+            }
+        }
+    }
+
+    void worker()
+    {
+        RenameThread("pastel-verify");
+        while (true)
+        {
+            shared_ptr<job_t> pJob;
+            {
+                unique_lock<mutex> lck(m_mtx);
+                m_cv.wait(lck, [this]() { return m_bStop || !m_jobs.empty(); });
+                if (m_bStop)
+                    return;
+                pJob = m_jobs.front();
+                // all items of the job are taken - remove it from the queue
+                if (pJob->nNext >= pJob->nCount)
+                {
+                    m_jobs.pop_front();
+                    continue;
+                }
+            }
+            run(*pJob);
+        }
+    }
+};
+} // namespace
+
+// process LegRoast signature rounds using persistent worker pool
+static void LegRoastParallelFor(const size_t nCount, const function<void(const size_t)>& fn)
+{
+    CVerifyWorkerPool::Instance().ParallelFor(nCount, fn);
+}
+
 /**
 * Generate new PastelID (EdDSA448) and LegRoast public/private key pairs.
 * Create new secure container to store all items associated with PastelID.
@@ -122,28 +251,20 @@ string CPastelID::Sign(const string& sText, const string& sPastelID, SecureStrin
     string error;
     try
     {
-        const auto sFilePath = GetSecureContFilePath(sPastelID);
-        CSecureContainer cont;
-        CLegRoast<algorithm::Legendre_Middle> LegRoastKey;
-        string sED448pkey;
-        // first try to read file as a secure container
-        // returns false if file content does not start with secure container prefix
-        bool bRead = cont.read_from_file(sFilePath, sPassPhrase);
-        if (!bRead)
+        const bool bLegRoast = alg == SIGN_ALGORITHM::legroast;
+        secure_key_t vPrivateKey;
+        // use private key from the signing session if PastelID is unlocked,
+        // otherwise read it from the secure container
+        if (!pastelIDSessionStore.GetKey(sPastelID, sPassPhrase, bLegRoast, vPrivateKey))
         {
-            // for backward compatibility try to read ed448 private key from PKCS8 encrypted file
-            SecureString sPassPhraseNew(sPassPhrase);
-            if (!ProcessEd448_PastelKeyFile(error, sFilePath, sPassPhrase, move(sPassPhraseNew)))
-                throw runtime_error(error);
-            bRead = cont.read_from_file(sFilePath, sPassPhrase);
+            secure_key_t vEd448Key, vLegRoastKey;
+            ReadPrivateKeys(sPastelID, sPassPhrase, vEd448Key, vLegRoastKey);
+            vPrivateKey = move(bLegRoast ? vLegRoastKey : vEd448Key);
         }
-        if (!bRead)
-            throw runtime_error(strprintf("Cannot access secure container '%s'", sFilePath));
         switch (alg)
         {
             case SIGN_ALGORITHM::ed448: {
-                sED448pkey = cont.extract_secure_data_string(SECURE_ITEM_TYPE::pkey_ed448);
-                const auto key = ed_crypto::key_dsa448::create_from_raw_private(reinterpret_cast<const unsigned char*>(sED448pkey.data()), sED448pkey.size());
+                const auto key = ed_crypto::key_dsa448::create_from_raw_private(vPrivateKey.data(), vPrivateKey.size());
                 // sign with ed448 key
                 ed_crypto::buffer sigBuf = ed_crypto::crypto_sign::sign(sText, key);
                 sSignature = fBase64 ? sigBuf.Base64() : sigBuf.str();
@@ -151,9 +272,10 @@ string CPastelID::Sign(const string& sText, const string& sPastelID, SecureStrin
 
             case SIGN_ALGORITHM::legroast:
             {
-                v_uint8 pkey = cont.extract_secure_data(SECURE_ITEM_TYPE::pkey_legroast);
-                if (!LegRoastKey.set_private_key(error, pkey.data(), pkey.size()))
+                CLegRoast<algorithm::Legendre_Middle> LegRoastKey;
+                if (!LegRoastKey.set_private_key(error, vPrivateKey.data(), vPrivateKey.size()))
                     throw runtime_error(error);
+                LegRoastKey.set_threads(GetLegRoastThreads(), LegRoastParallelFor);
                 if (!LegRoastKey.sign(error, reinterpret_cast<const unsigned char*>(sText.data()), sText.length()))
                     throw runtime_error(strprintf("Failed to sign text message with the LegRoast private key. %s", error));
                 sSignature = LegRoastKey.get_signature();
@@ -170,6 +292,90 @@ string CPastelID::Sign(const string& sText, const string& sPastelID, SecureStrin
     return sSignature;
 }
 
+/**
+ * Read private keys from the secure container associated with PastelID.
+ * Converts old PKCS8 ed448 key file to the secure container if needed.
+ * throws runtime_error exception if secure container can't be accessed.
+ * 
+ * \param sPastelID - locally stored PastelID
+ * \param sPassPhrase - passphrase used to access private keys
+ * \param vEd448Key - returns ed448 private key
+ * \param vLegRoastKey - returns LegRoast private key
+ */
+void CPastelID::ReadPrivateKeys(const string& sPastelID, const SecureString& sPassPhrase, secure_key_t& vEd448Key, secure_key_t& vLegRoastKey)
+{
+    string error;
+    const auto sFilePath = GetSecureContFilePath(sPastelID);
+    CSecureContainer cont;
+    // first try to read file as a secure container
+    // returns false if file content does not start with secure container prefix
+    bool bRead = cont.read_from_file(sFilePath, sPassPhrase);
+    if (!bRead)
+    {
+        // for backward compatibility try to read ed448 private key from PKCS8 encrypted file
+        SecureString sPassPhraseNew(sPassPhrase);
+        if (!ProcessEd448_PastelKeyFile(error, sFilePath, sPassPhrase, move(sPassPhraseNew)))
+            throw runtime_error(error);
+        bRead = cont.read_from_file(sFilePath, sPassPhrase);
+    }
+    if (!bRead)
+        throw runtime_error(strprintf("Cannot access secure container '%s'", sFilePath));
+    for (const auto &[type, vKey] : { make_pair(SECURE_ITEM_TYPE::pkey_ed448, &vEd448Key), make_pair(SECURE_ITEM_TYPE::pkey_legroast, &vLegRoastKey) })
+    {
+        v_uint8 vData = cont.extract_secure_data(type);
+        vKey->assign(vData.cbegin(), vData.cend());
+        memory_cleanse(vData.data(), vData.size());
+    }
+}
+
+/**
+ * Unlock PastelID: start signing session.
+ * Decrypted private keys are stored in the locked memory for nTimeout seconds,
+ * "Sign" with the same passphrase does not need to access secure container during this time.
+ * 
+ * \param error - returns error message in case of failure
+ * \param sPastelID - locally stored PastelID
+ * \param sPassPhrase - passphrase used to access private keys
+ * \param nTimeout - session timeout in seconds, should not exceed MAX_PASTELID_UNLOCK_TIMEOUT
+ * \return true if PastelID was unlocked
+ */
+bool CPastelID::Unlock(string &error, const string& sPastelID, SecureString&& sPassPhrase, const int64_t nTimeout)
+{
+    bool bRet = false;
+    try
+    {
+        error.clear();
+        if (nTimeout <= 0)
+        {
+            error = "Timeout should be positive";
+            return false;
+        }
+        if (nTimeout > MAX_PASTELID_UNLOCK_TIMEOUT)
+        {
+            error = strprintf("Timeout should not exceed %d seconds", MAX_PASTELID_UNLOCK_TIMEOUT);
+            return false;
+        }
+        secure_key_t vEd448Key, vLegRoastKey;
+        ReadPrivateKeys(sPastelID, sPassPhrase, vEd448Key, vLegRoastKey);
+        pastelIDSessionStore.Unlock(sPastelID, sPassPhrase, move(vEd448Key), move(vLegRoastKey), GetTime() + nTimeout);
+        bRet = true;
+    } catch (const exception& ex) {
+        error = strprintf("Cannot unlock PastelID [%s]. %s", sPastelID, ex.what());
+    }
+    return bRet;
+}
+
+/**
+ * Lock PastelID: remove decrypted private keys from memory.
+ * 
+ * \param sPastelID - PastelID
+ * \return true if PastelID was unlocked
+ */
+bool CPastelID::Lock(const string& sPastelID)
+{
+    return pastelIDSessionStore.Lock(sPastelID);
+}
+
 /**
 * Verify signature with the public key associated with PastelID.
 * 
@@ -181,6 +387,22 @@ string CPastelID::Sign(const string& sText, const string& sPastelID, SecureStrin
 * \return true if signature is correct
 */
 bool CPastelID::Verify(const string& sText, const string& sSignature, const string& sPastelID, const SIGN_ALGORITHM alg, const bool fBase64)
+{
+    return VerifyEx(sText, sSignature, sPastelID, alg, fBase64, GetLegRoastThreads());
+}
+
+/**
+ * Number of threads used to process LegRoast signature rounds in parallel (-legroastthreads).
+ * Signature is the same as produced in serial mode, rounds are processed serially by default.
+ */
+uint32_t CPastelID::GetLegRoastThreads() noexcept
+{
+    const int64_t nThreads = GetArg("-legroastthreads", DEFAULT_LEGROAST_THREADS);
+    return static_cast<uint32_t>(max<int64_t>(1, min<int64_t>(nThreads, MAX_LEGROAST_THREADS)));
+}
+
+bool CPastelID::VerifyEx(const string& sText, const string& sSignature, const string& sPastelID,
+    const SIGN_ALGORITHM alg, const bool fBase64, const uint32_t nLegRoastThreads)
 {
     bool bRet = false;
     string error;
@@ -190,53 +412,32 @@ bool CPastelID::Verify(const string& sText, const string& sSignature, const stri
         {
             case SIGN_ALGORITHM::ed448:
             {
-                v_uint8 vRawPubKey;
-                if (!DecodePastelID(sPastelID, vRawPubKey))
-                    return false;
                 // use EdDSA448 public key to verify signature
-                auto key = ed_crypto::key_dsa448::create_from_raw_public(vRawPubKey.data(), vRawPubKey.size());
+                // EVP_PKEY is created only once for the PastelID and cached
+                auto pKey = pastelIDPubKeyCache.GetEd448Key(sPastelID);
+                if (!pKey)
+                {
+                    v_uint8 vRawPubKey;
+                    if (!DecodePastelID(sPastelID, vRawPubKey))
+                        return false;
+                    pKey = make_shared<const key_dsa448>(key_dsa448::create_from_raw_public(vRawPubKey.data(), vRawPubKey.size()));
+                    pastelIDPubKeyCache.SetEd448Key(sPastelID, pKey);
+                }
                 if (fBase64)
-                    bRet = ed_crypto::crypto_sign::verify_base64(sText, sSignature, key);
+                    bRet = ed_crypto::crypto_sign::verify_base64(sText, sSignature, *pKey);
                 else
-                    bRet = ed_crypto::crypto_sign::verify(sText, sSignature, key);
+                    bRet = ed_crypto::crypto_sign::verify(sText, sSignature, *pKey);
             } break;
 
             case SIGN_ALGORITHM::legroast:
             {
-                constexpr auto LRERR_PREFIX = "Cannot verify signature with LegRoast algorithm. ";
-                string sLegRoastPubKey;
                 v_uint8 vLRPubKey;
-                CSecureContainer cont;
-                const auto sFilePath = GetSecureContFilePath(sPastelID);
-                // check if this PastelID is stored locally
-                // if yes - read LegRoast public key from the secure container (no passphrase needed)
-                // if no - lookup ID Registration ticket in the blockchain and get LegRoast pubkey from the ticket
-                if (fs::exists(sFilePath))
-                {
-                    // read public items from the secure container file
-                    if (!cont.read_public_from_file(error, sFilePath))
-                        throw runtime_error(strprintf("%sLegRoast public key was not found in the secure container associated with PastelID [%s]. %s", 
-                            LRERR_PREFIX, sPastelID, error));
-                    // retrieve encoded LegRoast public key
-                    if (!cont.get_public_data(PUBLIC_ITEM_TYPE::pubkey_legroast, sLegRoastPubKey))
-                        throw runtime_error(strprintf("%sLegRoast public key associated with the PastelID [%s] was not found", LRERR_PREFIX, sPastelID));
-                } else {
-                    CPastelIDRegTicket regTicket;
-                    if (!CPastelIDRegTicket::FindTicketInDb(sPastelID, regTicket))
-                        throw runtime_error(strprintf("%sPastelID [%s] is not stored locally and PastelID registration ticket was not found in the blockchain", 
-                            LRERR_PREFIX, sPastelID));
-                    if (regTicket.pq_key.empty())
-                        throw runtime_error(strprintf("%sPastelID [%s] registration ticket [txid=%s] was found in the blockchain, but LegRoast public key is empty", 
-                            LRERR_PREFIX, regTicket.GetTxId()));
-                    sLegRoastPubKey = move(regTicket.pq_key);
-                }
-                // decode base58-encoded LegRoast public key
-                string error;
-                if (DecodeLegRoastPubKey(sLegRoastPubKey, vLRPubKey))
+                if (GetLegRoastPubKey(sPastelID, vLRPubKey))
                 {
                     bool bValid = false;
                     // verify signature
                     CLegRoast<algorithm::Legendre_Middle> LegRoast;
+                    LegRoast.set_threads(nLegRoastThreads, LegRoastParallelFor);
                     if (LegRoast.set_public_key(error, vLRPubKey.data(), vLRPubKey.size()))
                     {
 	                    if (fBase64)
@@ -259,6 +460,93 @@ bool CPastelID::Verify(const string& sText, const string& sSignature, const stri
     return bRet;
 }
 
+/**
+ * Get decoded LegRoast public key associated with PastelID.
+ * throws runtime_error if LegRoast public key can't be found.
+ * 
+ * \param sPastelID - PastelID
+ * \param vLRPubKey - returns decoded LegRoast public key
+ * \return false if LegRoast public key can't be decoded
+ */
+bool CPastelID::GetLegRoastPubKey(const string& sPastelID, v_uint8& vLRPubKey)
+{
+    if (pastelIDPubKeyCache.GetLegRoastKey(sPastelID, vLRPubKey))
+        return true;
+
+    constexpr auto LRERR_PREFIX = "Cannot verify signature with LegRoast algorithm. ";
+    string error;
+    string sLegRoastPubKey;
+    CSecureContainer cont;
+    const auto sFilePath = GetSecureContFilePath(sPastelID);
+    // check if this PastelID is stored locally
+    // if yes - read LegRoast public key from the secure container (no passphrase needed)
+    // if no - lookup ID Registration ticket in the blockchain and get LegRoast pubkey from the ticket
+    if (fs::exists(sFilePath))
+    {
+        // read public items from the secure container file
+        if (!cont.read_public_from_file(error, sFilePath))
+            throw runtime_error(strprintf("%sLegRoast public key was not found in the secure container associated with PastelID [%s]. %s", 
+                LRERR_PREFIX, sPastelID, error));
+        // retrieve encoded LegRoast public key
+        if (!cont.get_public_data(PUBLIC_ITEM_TYPE::pubkey_legroast, sLegRoastPubKey))
+            throw runtime_error(strprintf("%sLegRoast public key associated with the PastelID [%s] was not found", LRERR_PREFIX, sPastelID));
+    } else {
+        CPastelIDRegTicket regTicket;
+        if (!CPastelIDRegTicket::FindTicketInDb(sPastelID, regTicket))
+            throw runtime_error(strprintf("%sPastelID [%s] is not stored locally and PastelID registration ticket was not found in the blockchain", 
+                LRERR_PREFIX, sPastelID));
+        if (regTicket.pq_key.empty())
+            throw runtime_error(strprintf("%sPastelID [%s] registration ticket [txid=%s] was found in the blockchain, but LegRoast public key is empty", 
+                LRERR_PREFIX, sPastelID, regTicket.GetTxId()));
+        sLegRoastPubKey = move(regTicket.pq_key);
+    }
+    // decode base58-encoded LegRoast public key
+    if (!DecodeLegRoastPubKey(sLegRoastPubKey, vLRPubKey))
+        return false;
+    pastelIDPubKeyCache.SetLegRoastKey(sPastelID, vLRPubKey);
+    return true;
+}
+
+/**
+ * Verify multiple signatures in parallel.
+ * Exceptions thrown by the signature verification are treated as invalid signature.
+ * 
+ * \param vItems - signature verification requests
+ * \param pvErrors - optional, returns verification error messages for each request
+ * \return verification results for each request
+ */
+v_bools CPastelID::VerifyBatch(const vector<verify_item_t>& vItems, v_strings* pvErrors)
+{
+    const size_t nCount = vItems.size();
+    v_uint8 vResults(nCount, 0);
+    v_strings vErrors(nCount);
+    const bool bUsePool = nCount > 1 && CVerifyWorkerPool::Instance().GetWorkerCount();
+    // signatures are already verified in parallel - do not split LegRoast rounds between threads
+    const uint32_t nLegRoastThreads = bUsePool ? 1 : GetLegRoastThreads();
+    const function<void(const size_t)> fnVerify = [&](const size_t i)
+    {
+        const auto& item = vItems[i];
+        try
+        {
+            if (!item.psText)
+                throw runtime_error("Text to verify is not defined");
+            vResults[i] = VerifyEx(*item.psText, item.sSignature, item.sPastelID, item.alg, item.fBase64, nLegRoastThreads) ? 1 : 0;
+        } catch (const exception& ex) {
+            vErrors[i] = ex.what();
+        }
+    };
+    if (bUsePool)
+        CVerifyWorkerPool::Instance().ParallelFor(nCount, fnVerify);
+    else
+    {
+        for (size_t i = 0; i < nCount; ++i)
+            fnVerify(i);
+    }
+    if (pvErrors)
+        *pvErrors = move(vErrors);
+    return v_bools(vResults.cbegin(), vResults.cend());
+}
+
 /**
 * Get PastelIDs stored locally in pastelkeys (pastelkeysdir option).
 * 
@@ -351,6 +639,9 @@ bool CPastelID::ChangePassphrase(std::string &error, const std::string& sPastelI
         const string sFilePath = GetSecureContFilePath(sPastelId);
         CSecureContainer cont;
         bRet = cont.change_passphrase(sFilePath, move(sOldPassphrase), move(sNewPassphrase));
+        // signing session was started with the old passphrase
+        if (bRet)
+            Lock(sPastelId);
     } catch (const exception& ex) {
         sError = ex.what();
     }
@@ -8,6 +8,7 @@
 #include "map_types.h"
 #include "legroast.h"
 #include "fs.h"
+#include "pastelid/pastelid_session.h"
 
 #include <unordered_map>
 
@@ -16,6 +17,14 @@ using pastelid_store_t = mu_strings;
 
 constexpr auto SIGN_ALG_ED448 = "ed448";
 constexpr auto SIGN_ALG_LEGROAST = "legroast";
+// max number of threads used to verify signatures in parallel
+constexpr size_t MAX_PASTELID_VERIFY_THREADS = 8;
+// max number of threads used to process LegRoast signature rounds in parallel
+constexpr uint32_t MAX_LEGROAST_THREADS = 8;
+// number of threads used to process LegRoast signature rounds by default (serial mode)
+constexpr uint32_t DEFAULT_LEGROAST_THREADS = 1;
+// max PastelID unlock timeout in seconds (~3 years), keeps unlock time and timer delay in int64_t range
+constexpr int64_t MAX_PASTELID_UNLOCK_TIMEOUT = 100'000'000;
 
 class CPastelID
 {
@@ -33,6 +42,16 @@ public:
         legroast = 2
     };
 
+    // signature verification request for VerifyBatch
+    typedef struct _verify_item_t
+    {
+        const std::string* psText = nullptr; // text to verify signature for (not owned)
+        std::string sSignature;              // signature
+        std::string sPastelID;               // PastelID
+        SIGN_ALGORITHM alg = SIGN_ALGORITHM::ed448;
+        bool fBase64 = false;                // if true, signature is base64-encoded
+    } verify_item_t;
+
     // Generate new PastelID(EdDSA448) and LegRoast public / private key pairs.
     static pastelid_store_t CreateNewPastelKeys(SecureString&& passPhrase);
     // Get signing algorithm enum by name.
@@ -43,11 +62,17 @@ public:
     // Verify signature with the public key associated with PastelID.
     static bool Verify(const std::string& sText, const std::string& sSignature, const std::string& sPastelID, 
         const SIGN_ALGORITHM alg = SIGN_ALGORITHM::ed448, const bool fBase64 = false);
+    // Verify multiple signatures in parallel.
+    static v_bools VerifyBatch(const std::vector<verify_item_t>& vItems, v_strings* pvErrors = nullptr);
     static pastelid_store_t GetStoredPastelIDs(const bool bPastelIdOnly = true, std::string *psPastelID = nullptr);
     // Validate passphrase via secure container or pkcs8 format
     static bool isValidPassphrase(const std::string& sPastelId, const SecureString& strKeyPass) noexcept;
     // Change passphrase used to encrypt the secure container
     static bool ChangePassphrase(std::string &error, const std::string& sPastelId, SecureString&& sOldPassphrase, SecureString&& sNewPassphrase);
+    // Unlock PastelID: keep decrypted private keys in memory for nTimeout seconds
+    static bool Unlock(std::string &error, const std::string& sPastelID, SecureString&& sPassPhrase, const int64_t nTimeout);
+    // Lock PastelID: remove decrypted private keys from memory
+    static bool Lock(const std::string& sPastelID);
     // read ed448 private key from PKCS8 file (olf format)
     static bool ProcessEd448_PastelKeyFile(std::string& error, const std::string& sFilePath, const SecureString& sOldPassPhrase, SecureString &&sNewPassPhrase);
 
@@ -60,6 +85,15 @@ protected:
     static bool DecodeLegRoastPubKey(const std::string& sLRKey, v_uint8& vData);
 
  private:
+    // get decoded LegRoast public key associated with PastelID (cached)
+    static bool GetLegRoastPubKey(const std::string& sPastelID, v_uint8& vLRPubKey);
+    // verify signature, LegRoast rounds are processed using nLegRoastThreads threads
+    static bool VerifyEx(const std::string& sText, const std::string& sSignature, const std::string& sPastelID,
+        const SIGN_ALGORITHM alg, const bool fBase64, const uint32_t nLegRoastThreads);
+    // get number of threads to use for LegRoast sign/verify
+    static uint32_t GetLegRoastThreads() noexcept;
+    // read private keys from the secure container
+    static void ReadPrivateKeys(const std::string& sPastelID, const SecureString& sPassPhrase, secure_key_t& vEd448Key, secure_key_t& vLegRoastKey);
     // get full path for the secure container based on Pastel ID
     static fs::path GetSecureContFilePathEx(const std::string& sPastelID, const bool bCreateDirs = false);
     // get full path for the secure container based on Pastel ID
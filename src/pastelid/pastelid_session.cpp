@@ -0,0 +1,129 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <crypto/hmac_sha256.h>
+#include <random.h>
+#include <utiltime.h>
+#include <pastelid/pastelid_session.h>
+
+using namespace std;
+
+CPastelIDSessionStore pastelIDSessionStore;
+
+CPastelIDSessionStore::CPastelIDSessionStore()
+{
+    GetRandBytes(m_hashKey.begin(), m_hashKey.size());
+}
+
+uint256 CPastelIDSessionStore::HashPassPhrase(const SecureString& sPassPhrase) const noexcept
+{
+    uint256 hash;
+    CHMAC_SHA256(m_hashKey.begin(), m_hashKey.size())
+        .Write(reinterpret_cast<const unsigned char*>(sPassPhrase.data()), sPassPhrase.size())
+        .Finalize(hash.begin());
+    return hash;
+}
+
+/**
+ * Start new signing session for PastelID or prolong existing one.
+ *
+ * \param sPastelID - PastelID
+ * \param sPassPhrase - passphrase used to decrypt the secure container
+ * \param vEd448Key - ed448 private key
+ * \param vLegRoastKey - LegRoast private key
+ * \param nUnlockedUntil - session expiration time
+ */
+void CPastelIDSessionStore::Unlock(const string& sPastelID, const SecureString& sPassPhrase,
+    secure_key_t&& vEd448Key, secure_key_t&& vLegRoastKey, const int64_t nUnlockedUntil)
+{
+    LOCK(m_cs);
+    purgeExpired(GetTime());
+    auto& session = m_mapSessions[sPastelID];
+    session.vEd448Key = move(vEd448Key);
+    session.vLegRoastKey = move(vLegRoastKey);
+    session.hashPassPhrase = HashPassPhrase(sPassPhrase);
+    session.nUnlockedUntil = nUnlockedUntil;
+}
+
+/**
+ * Get private key from the active signing session.
+ *
+ * \param sPastelID - PastelID
+ * \param sPassPhrase - passphrase, should match the one used to unlock PastelID
+ * \param bLegRoast - if true - return LegRoast private key, otherwise ed448
+ * \param vKey - returns private key
+ * \return true if PastelID is unlocked, passphrase matches and key is found
+ */
+bool CPastelIDSessionStore::GetKey(const string& sPastelID, const SecureString& sPassPhrase, const bool bLegRoast, secure_key_t& vKey)
+{
+    LOCK(m_cs);
+    purgeExpired(GetTime());
+    const auto it = m_mapSessions.find(sPastelID);
+    if (it == m_mapSessions.end())
+        return false;
+    if (it->second.hashPassPhrase != HashPassPhrase(sPassPhrase))
+        return false;
+    const auto& vSessionKey = bLegRoast ? it->second.vLegRoastKey : it->second.vEd448Key;
+    if (vSessionKey.empty())
+        return false;
+    vKey = vSessionKey;
+    return true;
+}
+
+/**
+ * Lock PastelID - remove signing session.
+ * Keys are cleansed by secure allocator.
+ *
+ * \param sPastelID - PastelID
+ * \return true if PastelID was unlocked
+ */
+bool CPastelIDSessionStore::Lock(const string& sPastelID)
+{
+    LOCK(m_cs);
+    return m_mapSessions.erase(sPastelID) > 0;
+}
+
+void CPastelIDSessionStore::LockAll()
+{
+    LOCK(m_cs);
+    m_mapSessions.clear();
+}
+
+/**
+ * Remove expired signing sessions.
+ * Called on each session access, so keys of the expired sessions are not kept
+ * in memory even if the scheduled lock was not executed.
+ *
+ * \return number of removed sessions
+ */
+size_t CPastelIDSessionStore::PurgeExpired()
+{
+    LOCK(m_cs);
+    return purgeExpired(GetTime());
+}
+
+size_t CPastelIDSessionStore::purgeExpired(const int64_t nNow)
+{
+    AssertLockHeld(m_cs);
+    size_t nRemoved = 0;
+    for (auto it = m_mapSessions.begin(); it != m_mapSessions.end();)
+    {
+        if (it->second.nUnlockedUntil <= nNow)
+        {
+            it = m_mapSessions.erase(it);
+            ++nRemoved;
+        } else
+            ++it;
+    }
+    return nRemoved;
+}
+
+int64_t CPastelIDSessionStore::GetUnlockedUntil(const string& sPastelID)
+{
+    LOCK(m_cs);
+    purgeExpired(GetTime());
+    const auto it = m_mapSessions.find(sPastelID);
+    if (it == m_mapSessions.cend())
+        return 0;
+    return it->second.nUnlockedUntil;
+}
@@ -0,0 +1,60 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sync.h>
+#include <uint256.h>
+#include <support/allocators/secure.h>
+
+// private key data allocated in the locked (non-swappable) memory pool
+using secure_key_t = std::vector<unsigned char, secure_allocator<unsigned char>>;
+
+/**
+ * Store for the unlocked PastelID private keys (signing sessions).
+ * Secure container key derivation (Argon2) is done only once in "pastelid unlock",
+ * decrypted keys are kept in the locked memory until session expires or explicitly locked.
+ * Passphrase is still required to sign, it is verified against keyed hash stored in the session.
+ */
+class CPastelIDSessionStore
+{
+public:
+    CPastelIDSessionStore();
+
+    // start new session or prolong existing one
+    void Unlock(const std::string& sPastelID, const SecureString& sPassPhrase,
+        secure_key_t&& vEd448Key, secure_key_t&& vLegRoastKey, const int64_t nUnlockedUntil);
+    // get private key from the active session
+    bool GetKey(const std::string& sPastelID, const SecureString& sPassPhrase, const bool bLegRoast, secure_key_t& vKey);
+    // lock session (remove private keys)
+    bool Lock(const std::string& sPastelID);
+    // lock all sessions
+    void LockAll();
+    // remove expired sessions
+    size_t PurgeExpired();
+    // get session expiration time, 0 if PastelID is locked
+    int64_t GetUnlockedUntil(const std::string& sPastelID);
+
+private:
+    typedef struct _session_t
+    {
+        secure_key_t vEd448Key;       // ed448 private key
+        secure_key_t vLegRoastKey;    // LegRoast private key
+        uint256 hashPassPhrase;       // keyed hash of the passphrase
+        int64_t nUnlockedUntil;       // session expiration time
+    } session_t;
+
+    mutable CCriticalSection m_cs;
+    std::unordered_map<std::string, session_t> m_mapSessions;
+    // random key used to hash passphrases
+    uint256 m_hashKey;
+
+    uint256 HashPassPhrase(const SecureString& sPassPhrase) const noexcept;
+    // remove sessions expired at nNow, m_cs must be held
+    size_t purgeExpired(const int64_t nNow);
+};
+
+extern CPastelIDSessionStore pastelIDSessionStore;
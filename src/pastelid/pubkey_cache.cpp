@@ -0,0 +1,95 @@
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <pastelid/pubkey_cache.h>
+
+using namespace std;
+
+CPastelIDPubKeyCache pastelIDPubKeyCache;
+
+CPastelIDPubKeyCache::pubkey_entry_t* CPastelIDPubKeyCache::find(const string& sPastelID)
+{
+    const auto it = m_mapEntries.find(sPastelID);
+    if (it == m_mapEntries.end())
+        return nullptr;
+    // move entry to the front of the LRU list
+    m_lruList.splice(m_lruList.begin(), m_lruList, it->second);
+    return &it->second->second;
+}
+
+CPastelIDPubKeyCache::pubkey_entry_t& CPastelIDPubKeyCache::emplace(const string& sPastelID)
+{
+    auto pEntry = find(sPastelID);
+    if (pEntry)
+        return *pEntry;
+    while (!m_lruList.empty() && m_lruList.size() >= m_nMaxSize)
+    {
+        m_mapEntries.erase(m_lruList.back().first);
+        m_lruList.pop_back();
+    }
+    m_lruList.emplace_front(sPastelID, pubkey_entry_t());
+    m_mapEntries.emplace(sPastelID, m_lruList.begin());
+    return m_lruList.front().second;
+}
+
+/**
+ * Get cached ed448 public key.
+ *
+ * \param sPastelID - PastelID
+ * \return ed448 public key or nullptr if not found in cache
+ */
+CPastelIDPubKeyCache::ed448_key_ptr CPastelIDPubKeyCache::GetEd448Key(const string& sPastelID)
+{
+    LOCK(m_cs);
+    const auto pEntry = find(sPastelID);
+    return pEntry ? pEntry->pEd448Key : nullptr;
+}
+
+void CPastelIDPubKeyCache::SetEd448Key(const string& sPastelID, const ed448_key_ptr& pKey)
+{
+    LOCK(m_cs);
+    emplace(sPastelID).pEd448Key = pKey;
+}
+
+/**
+ * Get cached decoded LegRoast public key.
+ *
+ * \param sPastelID - PastelID
+ * \param vKey - returns LegRoast public key
+ * \return true if LegRoast public key found in cache
+ */
+bool CPastelIDPubKeyCache::GetLegRoastKey(const string& sPastelID, v_uint8& vKey)
+{
+    LOCK(m_cs);
+    const auto pEntry = find(sPastelID);
+    if (!pEntry || pEntry->vLegRoastKey.empty())
+        return false;
+    vKey = pEntry->vLegRoastKey;
+    return true;
+}
+
+void CPastelIDPubKeyCache::SetLegRoastKey(const string& sPastelID, const v_uint8& vKey)
+{
+    LOCK(m_cs);
+    emplace(sPastelID).vLegRoastKey = vKey;
+}
+
+void CPastelIDPubKeyCache::ClearLegRoastKeys()
+{
+    LOCK(m_cs);
+    for (auto& [sPastelID, entry] : m_lruList)
+        entry.vLegRoastKey.clear();
+}
+
+void CPastelIDPubKeyCache::Clear()
+{
+    LOCK(m_cs);
+    m_mapEntries.clear();
+    m_lruList.clear();
+}
+
+size_t CPastelIDPubKeyCache::size() const
+{
+    LOCK(m_cs);
+    return m_lruList.size();
+}
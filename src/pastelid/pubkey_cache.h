@@ -0,0 +1,66 @@
+#pragma once
+// Copyright (c) 2022 The Pastel Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or https://www.opensource.org/licenses/mit-license.php.
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <sync.h>
+#include <vector_types.h>
+#include <pastelid/ed.h>
+
+// max number of PastelIDs in the public key cache
+constexpr size_t DEFAULT_PASTELID_PUBKEY_CACHE_SIZE = 1000;
+
+/**
+ * LRU cache of the decoded PastelID public keys.
+ * Ticket validation verifies signatures of the same masternode PastelIDs over and over,
+ * cache saves base58 decoding, EVP_PKEY creation and LegRoast public key lookup (secure container or ticket DB).
+ * EVP_PKEY objects are used read-only and can be shared by multiple verification threads.
+ */
+class CPastelIDPubKeyCache
+{
+public:
+    using ed448_key_ptr = std::shared_ptr<const ed_crypto::key_dsa448>;
+
+    explicit CPastelIDPubKeyCache(const size_t nMaxSize = DEFAULT_PASTELID_PUBKEY_CACHE_SIZE) noexcept :
+        m_nMaxSize(nMaxSize)
+    {}
+
+    // get cached ed448 public key
+    ed448_key_ptr GetEd448Key(const std::string& sPastelID);
+    // add ed448 public key to the cache
+    void SetEd448Key(const std::string& sPastelID, const ed448_key_ptr& pKey);
+    // get cached decoded LegRoast public key
+    bool GetLegRoastKey(const std::string& sPastelID, v_uint8& vKey);
+    // add decoded LegRoast public key to the cache
+    void SetLegRoastKey(const std::string& sPastelID, const v_uint8& vKey);
+    // remove all LegRoast public keys (they are looked up in the ticket DB and can be changed by reorg)
+    void ClearLegRoastKeys();
+    void Clear();
+    size_t size() const;
+
+private:
+    typedef struct _pubkey_entry_t
+    {
+        ed448_key_ptr pEd448Key;  // ed448 public key (EVP_PKEY), decoded from PastelID
+        v_uint8 vLegRoastKey;     // decoded LegRoast public key
+    } pubkey_entry_t;
+
+    using lru_list_t = std::list<std::pair<std::string, pubkey_entry_t>>;
+
+    mutable CCriticalSection m_cs;
+    const size_t m_nMaxSize;
+    lru_list_t m_lruList; // most recently used entries at the front
+    std::unordered_map<std::string, lru_list_t::iterator> m_mapEntries;
+
+    // find entry and move it to the front of the LRU list
+    pubkey_entry_t* find(const std::string& sPastelID);
+    // find or create entry, evict least recently used entries
+    pubkey_entry_t& emplace(const std::string& sPastelID);
+};
+
+extern CPastelIDPubKeyCache pastelIDPubKeyCache;
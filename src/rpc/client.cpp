@@ -108,6 +108,7 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "zcrawjoinsplit", 4 },
     { "zcbenchmark", 1 },
     { "zcbenchmark", 2 },
+    { "zcbenchmark", 3 },
     { "getnextblocksubsidy", 0},
     { "getblocksubsidy", 0},
     { "z_listaddresses", 0},
@@ -8,6 +8,7 @@
 #include "consensus/upgrades.h"
 #include "consensus/consensus.h"
 #include "core_io.h"
+#include "datacompressor.h"
 #include "init.h"
 #include "key_io.h"
 #include "main.h"
@@ -22,6 +23,7 @@
 #include "walletdb.h"
 #include "primitives/transaction.h"
 #include "zcbenchmarks.h"
+#include "legroast.h"
 #include "script/interpreter.h"
 #include "zcash/Address.hpp"
 #include "utfcpp/utf8.h"
@@ -2791,6 +2793,19 @@ UniValue zc_benchmark(const UniValue& params, bool fHelp)
             "Runs a benchmark of the selected type samplecount times,\n"
             "returning the running times of each sample.\n"
             "\n"
+            "ticketcompress|ticketdecompress benchmarks accept optional payload size in KB (default: 256)\n"
+            "and zstd compression level (default: 0 - adaptive level selection).\n"
+            "\n"
+            "PastelID and ticket benchmarks:\n"
+            "  ed448sign, ed448verify                       - PastelID ed448 signature\n"
+            "  legroastkeygen, legroastsign, legroastverify - LegRoast, optional algorithm name\n"
+            "        (legendre_fast, legendre_middle[default], legendre_compact, power_fast, power_middle, power_compact)\n"
+            "  securecontainerload                          - PastelID secure container load (key derivation + decryption)\n"
+            "  p2fmscreate, p2fmsparse                      - P2FMS scripts creation/transaction parsing, optional payload size in KB (default: 256)\n"
+            "  ticketvalidate                               - full validation of the registered ticket, ticket txid is required\n"
+            "String arguments (algorithm name, txid) should be passed to pastel-cli as JSON strings,\n"
+            "for example: zcbenchmark legroastsign 10 '\"power_fast\"'\n"
+            "\n"
             "Output: [\n"
             "  {\n"
             "    \"runningtime\": runningtime\n"
@@ -2858,6 +2873,46 @@ UniValue zc_benchmark(const UniValue& params, bool fHelp)
             sample_times.push_back(benchmark_verify_sapling_spend());
         } else if (benchmarktype == "verifysaplingoutput") {
             sample_times.push_back(benchmark_verify_sapling_output());
+        } else if (benchmarktype == "ed448sign") {
+            sample_times.push_back(benchmark_ed448_sign());
+        } else if (benchmarktype == "ed448verify") {
+            sample_times.push_back(benchmark_ed448_verify());
+        } else if (benchmarktype == "legroastkeygen" || benchmarktype == "legroastsign" || benchmarktype == "legroastverify") {
+            legroast::algorithm alg = legroast::algorithm::Legendre_Middle;
+            if (params.size() >= 3 && !GetLegRoastAlgorithmByName(params[2].get_str(), alg))
+                throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid LegRoast algorithm");
+            if (benchmarktype == "legroastkeygen")
+                sample_times.push_back(benchmark_legroast_keygen(alg));
+            else if (benchmarktype == "legroastsign")
+                sample_times.push_back(benchmark_legroast_sign(alg));
+            else
+                sample_times.push_back(benchmark_legroast_verify(alg));
+        } else if (benchmarktype == "securecontainerload") {
+            sample_times.push_back(benchmark_secure_container_load());
+        } else if (benchmarktype == "p2fmscreate" || benchmarktype == "p2fmsparse") {
+            const int nSizeKB = params.size() >= 3 ? params[2].get_int() : 256;
+            if (nSizeKB <= 0)
+                throw JSONRPCError(RPC_TYPE_ERROR, "Invalid payload size");
+            if (benchmarktype == "p2fmscreate")
+                sample_times.push_back(benchmark_p2fms_create(static_cast<size_t>(nSizeKB) * 1024));
+            else
+                sample_times.push_back(benchmark_p2fms_parse(static_cast<size_t>(nSizeKB) * 1024));
+        } else if (benchmarktype == "ticketvalidate") {
+            if (params.size() < 3)
+                throw JSONRPCError(RPC_INVALID_PARAMETER, "Ticket txid is required");
+            sample_times.push_back(benchmark_ticket_validate(ParseHashV(params[2], "txid")));
+        } else if (benchmarktype == "ticketcompress" || benchmarktype == "ticketdecompress") {
+            // payload size in KB and compression level
+            const int nSizeKB = params.size() >= 3 ? params[2].get_int() : 256;
+            const int nCompressLevel = params.size() >= 4 ? params[3].get_int() : 0;
+            if (nSizeKB <= 0)
+                throw JSONRPCError(RPC_TYPE_ERROR, "Invalid payload size");
+            if (nCompressLevel < 0 || nCompressLevel > ZSTD_DEFAULT_COMPRESS_LEVEL)
+                throw JSONRPCError(RPC_TYPE_ERROR, "Invalid compression level");
+            if (benchmarktype == "ticketcompress")
+                sample_times.push_back(benchmark_ticket_compress(static_cast<size_t>(nSizeKB) * 1024, nCompressLevel));
+            else
+                sample_times.push_back(benchmark_ticket_decompress(static_cast<size_t>(nSizeKB) * 1024, nCompressLevel));
         } else {
             throw JSONRPCError(RPC_TYPE_ERROR, "Invalid benchmarktype");
         }
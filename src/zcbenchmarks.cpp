@@ -21,10 +21,17 @@
 #include "script/sign.h"
 #include "sodium.h"
 #include "streams.h"
+#include "datacompressor.h"
+#include "random.h"
+#include "utilstrencodings.h"
 #include "txdb.h"
 #include "utiltest.h"
 #include <vector_types.h>
 #include "wallet/wallet.h"
+#include "mnode/ticket-processor.h"
+#include "legroast.h"
+#include "pastelid/ed.h"
+#include "pastelid/secure_container.h"
 
 #include "zcbenchmarks.h"
 
@@ -499,3 +506,323 @@ double benchmark_verify_sapling_output()
     }
     return timer_stop(tv_start);
 }
+
+/**
+ * Generate ticket-like payload: base64-encoded json with the list of random hashes
+ * (similar to NFT registration ticket with app ticket and rq_ids).
+ * 
+ * \param nDataSize - payload size in bytes
+ * \return payload
+ */
+static string generate_ticket_payload(const size_t nDataSize)
+{
+    string sJson = R"({"nft_ticket_version":1,"author":")" + GetRandHash().GetHex() + R"(","blocknum":123456,"block_hash":")" +
+        GetRandHash().GetHex() + R"(","copies":10,"royalty":0.1,"green":false,"app_ticket":{"creator_name":"Pastel","nft_type":"image","rq_ids":[)";
+    // base64 encoding increases data size by 4/3
+    while (sJson.size() * 4 / 3 < nDataSize)
+        sJson += "\"" + GetRandHash().GetHex() + "\",";
+    sJson += "]}}";
+    string sPayload = EncodeBase64(sJson);
+    sPayload.resize(nDataSize);
+    return sPayload;
+}
+
+/**
+ * Benchmark ticket data compression.
+ * 
+ * \param nDataSize - payload size in bytes
+ * \param nCompressLevel - zstd compression level, 0 - adaptive mode with default latency budget
+ * \return compression time
+ */
+double benchmark_ticket_compress(const size_t nDataSize, const int nCompressLevel)
+{
+    CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+    data_stream << generate_ticket_payload(nDataSize);
+    if (nCompressLevel)
+        data_stream.SetCompressLevel(nCompressLevel);
+    else
+        data_stream.SetAdaptiveCompressLevel(DEFAULT_TICKET_COMPRESS_LATENCY_MS);
+
+    string error;
+    struct timeval tv_start;
+    timer_start(tv_start);
+    if (!data_stream.CompressData(error, 0, [](CSerializeData::iterator start, CSerializeData::iterator end) {}))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to compress data. %s", error));
+    const double t = timer_stop(tv_start);
+    LogPrint("bench", "%s: [%zu]->[%zu] bytes, level %d, %.3fs\n", __func__, nDataSize, data_stream.size(), data_stream.GetCompressLevel(), t);
+    return t;
+}
+
+/**
+ * Benchmark ticket data decompression.
+ * 
+ * \param nDataSize - payload size in bytes
+ * \param nCompressLevel - zstd compression level, 0 - adaptive mode with default latency budget
+ * \return decompression time
+ */
+double benchmark_ticket_decompress(const size_t nDataSize, const int nCompressLevel)
+{
+    CCompressedDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+    data_stream << generate_ticket_payload(nDataSize);
+    if (nCompressLevel)
+        data_stream.SetCompressLevel(nCompressLevel);
+    else
+        data_stream.SetAdaptiveCompressLevel(DEFAULT_TICKET_COMPRESS_LATENCY_MS);
+
+    string error;
+    if (!data_stream.CompressData(error, 0, [](CSerializeData::iterator start, CSerializeData::iterator end) {}))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to compress data. %s", error));
+    const bool bCompressed = data_stream.IsCompressed();
+    CSerializeData vData(data_stream.begin(), data_stream.end());
+
+    struct timeval tv_start;
+    timer_start(tv_start);
+    if (!data_stream.SetData(error, bCompressed, 0, move(vData)))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to decompress data. %s", error));
+    return timer_stop(tv_start);
+}
+
+/**
+ * Benchmark ed448 signing (PastelID signature).
+ * 
+ * \return signing time
+ */
+double benchmark_ed448_sign()
+{
+    const auto key = ed_crypto::key_dsa448::generate_key();
+    const string sText = GetRandHash().GetHex();
+
+    struct timeval tv_start;
+    timer_start(tv_start);
+    const auto signature = ed_crypto::crypto_sign::sign(sText, key);
+    return timer_stop(tv_start);
+}
+
+/**
+ * Benchmark ed448 signature verification, including public key creation from the raw data.
+ * 
+ * \return verification time
+ */
+double benchmark_ed448_verify()
+{
+    const auto key = ed_crypto::key_dsa448::generate_key();
+    const string sText = GetRandHash().GetHex();
+    const string sSignature = ed_crypto::crypto_sign::sign(sText, key).str();
+    const v_uint8 vRawPubKey = key.public_key_raw().data();
+
+    struct timeval tv_start;
+    timer_start(tv_start);
+    const auto pubKey = ed_crypto::key_dsa448::create_from_raw_public(vRawPubKey.data(), vRawPubKey.size());
+    if (!ed_crypto::crypto_sign::verify(sText, sSignature, pubKey))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Failed to verify ed448 signature");
+    return timer_stop(tv_start);
+}
+
+/**
+ * Get LegRoast algorithm by name.
+ * 
+ * \param sAlgorithm - algorithm name (legendre_fast, legendre_middle, ...)
+ * \param alg - returns LegRoast algorithm
+ * \return true if algorithm name is valid
+ */
+bool GetLegRoastAlgorithmByName(const string& sAlgorithm, legroast::algorithm& alg)
+{
+    for (uint32_t i = 0; i < legroast::to_index(legroast::algorithm::COUNT); ++i)
+    {
+        const auto a = static_cast<legroast::algorithm>(i);
+        if (sAlgorithm == legroast::GetLegRoastAlgorithmName(a))
+        {
+            alg = a;
+            return true;
+        }
+    }
+    return false;
+}
+
+typedef enum class _LEGROAST_BENCH_OP
+{
+    keygen,
+    sign,
+    verify
+} LEGROAST_BENCH_OP;
+
+template <legroast::algorithm alg>
+static double benchmark_legroast_op(const LEGROAST_BENCH_OP op)
+{
+    string error;
+    const string sText = GetRandHash().GetHex();
+    const auto pText = reinterpret_cast<const unsigned char*>(sText.data());
+    struct timeval tv_start;
+
+    legroast::CLegRoast<alg> lr;
+    if (op == LEGROAST_BENCH_OP::keygen)
+    {
+        timer_start(tv_start);
+        lr.keygen();
+        return timer_stop(tv_start);
+    }
+    lr.keygen();
+    if (op == LEGROAST_BENCH_OP::sign)
+    {
+        timer_start(tv_start);
+        if (!lr.sign(error, pText, sText.size()))
+            throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to sign with LegRoast. %s", error));
+        return timer_stop(tv_start);
+    }
+    if (!lr.sign(error, pText, sText.size()))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to sign with LegRoast. %s", error));
+    const string sSignature = lr.get_signature();
+    const string sPubKey = lr.get_public_key();
+
+    timer_start(tv_start);
+    legroast::CLegRoast<alg> lrVerify;
+    if (!lrVerify.set_public_key(error, reinterpret_cast<const unsigned char*>(sPubKey.data()), sPubKey.size()) ||
+        !lrVerify.set_signature(error, reinterpret_cast<const unsigned char*>(sSignature.data()), sSignature.size()) ||
+        !lrVerify.verify(error, pText, sText.size()))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to verify LegRoast signature. %s", error));
+    return timer_stop(tv_start);
+}
+
+static double benchmark_legroast(const legroast::algorithm alg, const LEGROAST_BENCH_OP op)
+{
+    switch (alg)
+    {
+        case legroast::algorithm::Legendre_Fast:
+            return benchmark_legroast_op<legroast::algorithm::Legendre_Fast>(op);
+        case legroast::algorithm::Legendre_Middle:
+            return benchmark_legroast_op<legroast::algorithm::Legendre_Middle>(op);
+        case legroast::algorithm::Legendre_Compact:
+            return benchmark_legroast_op<legroast::algorithm::Legendre_Compact>(op);
+        case legroast::algorithm::Power_Fast:
+            return benchmark_legroast_op<legroast::algorithm::Power_Fast>(op);
+        case legroast::algorithm::Power_Middle:
+            return benchmark_legroast_op<legroast::algorithm::Power_Middle>(op);
+        case legroast::algorithm::Power_Compact:
+            return benchmark_legroast_op<legroast::algorithm::Power_Compact>(op);
+        default:
+            break;
+    }
+    throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid LegRoast algorithm");
+}
+
+double benchmark_legroast_keygen(const legroast::algorithm alg)
+{
+    return benchmark_legroast(alg, LEGROAST_BENCH_OP::keygen);
+}
+
+double benchmark_legroast_sign(const legroast::algorithm alg)
+{
+    return benchmark_legroast(alg, LEGROAST_BENCH_OP::sign);
+}
+
+double benchmark_legroast_verify(const legroast::algorithm alg)
+{
+    return benchmark_legroast(alg, LEGROAST_BENCH_OP::verify);
+}
+
+/**
+ * Benchmark loading of the PastelID secure container (passphrase key derivation + decryption).
+ * Secure container with ed448 and LegRoast private keys is created in the temp directory.
+ * 
+ * \return secure container load time
+ */
+double benchmark_secure_container_load()
+{
+    using namespace secure_container;
+
+    const SecureString sPassPhrase("benchmark-passphrase");
+    const auto key = ed_crypto::key_dsa448::generate_key();
+    legroast::CLegRoast<legroast::algorithm::Legendre_Middle> lr;
+    lr.keygen();
+
+    const fs::path containerPath = GetTempPath() / fs::unique_path("pastel-bench-%%%%-%%%%");
+    CSecureContainer cont;
+    cont.add_secure_item_vector(SECURE_ITEM_TYPE::pkey_ed448, key.private_key_raw().data());
+    cont.add_secure_item_vector(SECURE_ITEM_TYPE::pkey_legroast, lr.get_private_key());
+    if (!cont.write_to_file(containerPath.string(), SecureString(sPassPhrase)))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Failed to write secure container");
+
+    double t = 0;
+    try
+    {
+        struct timeval tv_start;
+        timer_start(tv_start);
+        CSecureContainer contRead;
+        const bool bRead = contRead.read_from_file(containerPath.string(), sPassPhrase);
+        t = timer_stop(tv_start);
+        if (!bRead)
+            throw JSONRPCError(RPC_INTERNAL_ERROR, "Failed to read secure container");
+    } catch (...) {
+        fs::remove(containerPath);
+        throw;
+    }
+    fs::remove(containerPath);
+    return t;
+}
+
+/**
+ * Benchmark creation of the P2FMS scripts from the ticket data.
+ * 
+ * \param nDataSize - ticket data size in bytes
+ * \return P2FMS scripts creation time
+ */
+double benchmark_p2fms_create(const size_t nDataSize)
+{
+    CDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+    data_stream << generate_ticket_payload(nDataSize);
+
+    vector<CScript> vOutScripts;
+    struct timeval tv_start;
+    timer_start(tv_start);
+    CPastelTicketProcessor::CreateP2FMSScripts(data_stream, vOutScripts);
+    return timer_stop(tv_start);
+}
+
+/**
+ * Benchmark parsing of the P2FMS transaction.
+ * 
+ * \param nDataSize - ticket data size in bytes
+ * \return P2FMS transaction parsing time
+ */
+double benchmark_p2fms_parse(const size_t nDataSize)
+{
+    CDataStream data_stream(SER_NETWORK, DATASTREAM_VERSION);
+    data_stream << generate_ticket_payload(nDataSize);
+
+    vector<CScript> vOutScripts;
+    CPastelTicketProcessor::CreateP2FMSScripts(data_stream, vOutScripts);
+    CMutableTransaction tx;
+    tx.vout.reserve(vOutScripts.size());
+    for (const auto& script : vOutScripts)
+        tx.vout.emplace_back(1, script);
+    const CTransaction txParse(tx);
+
+    string error;
+    CSerializeData vOutputData;
+    struct timeval tv_start;
+    timer_start(tv_start);
+    if (!CPastelTicketProcessor::ParseP2FMSTransaction(txParse, vOutputData, error))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Failed to parse P2FMS transaction. %s", error));
+    return timer_stop(tv_start);
+}
+
+/**
+ * Benchmark full validation of the ticket registered in the blockchain.
+ * 
+ * \param txid - ticket transaction id
+ * \return ticket validation time
+ */
+double benchmark_ticket_validate(const uint256& txid)
+{
+    const auto ticket = CPastelTicketProcessor::GetTicket(txid);
+    if (!ticket)
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("Ticket [txid=%s] not found", txid.GetHex()));
+
+    struct timeval tv_start;
+    timer_start(tv_start);
+    const auto tv = ticket->IsValid(false, 0);
+    const double t = timer_stop(tv_start);
+    if (tv.IsNotValid())
+        LogPrint("bench", "%s: ticket [txid=%s] is not valid. %s\n", __func__, txid.GetHex(), tv.errorMsg);
+    return t;
+}
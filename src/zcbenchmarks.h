@@ -5,6 +5,14 @@
 #include <sys/time.h>
 #endif
 #include <stdlib.h>
+#include <string>
+
+#include <uint256.h>
+
+namespace legroast
+{
+enum class algorithm : uint32_t;
+}
 
 extern double benchmark_sleep();
 extern double benchmark_solve_equihash();
@@ -19,5 +27,17 @@ extern double benchmark_create_sapling_spend();
 extern double benchmark_create_sapling_output();
 extern double benchmark_verify_sapling_spend();
 extern double benchmark_verify_sapling_output();
+extern double benchmark_ticket_compress(const size_t nDataSize, const int nCompressLevel);
+extern double benchmark_ticket_decompress(const size_t nDataSize, const int nCompressLevel);
+extern double benchmark_ed448_sign();
+extern double benchmark_ed448_verify();
+extern bool GetLegRoastAlgorithmByName(const std::string& sAlgorithm, legroast::algorithm& alg);
+extern double benchmark_legroast_keygen(const legroast::algorithm alg);
+extern double benchmark_legroast_sign(const legroast::algorithm alg);
+extern double benchmark_legroast_verify(const legroast::algorithm alg);
+extern double benchmark_secure_container_load();
+extern double benchmark_p2fms_create(const size_t nDataSize);
+extern double benchmark_p2fms_parse(const size_t nDataSize);
+extern double benchmark_ticket_validate(const uint256& txid);
 
 #endif